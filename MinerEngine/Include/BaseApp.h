@@ -65,7 +65,8 @@ private:
 	XMMATRIX                            m_Projection;
 	//XMFLOAT4                            m_vMeshColor;// (0.7f, 0.7f, 0.7f, 1.0f);
 
-	std::vector<EU::TSharedPointer<Actor>> m_actors;
+	// Lista de actores sobre memoria virtual: crece sin copias y sin mover los punteros
+	EU::TVirtualArray<EU::TSharedPointer<Actor>> m_actors{ 1 << 20, EU::MemoryTag::ECS };
 	EU::TSharedPointer<Actor> m_Printstream;
 
 
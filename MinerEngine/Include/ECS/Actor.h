@@ -96,15 +96,15 @@ public:
    * @brief Obtiene el nombre del actor.
    * @return Nombre actual del actor.
    */
-  std::string 
-  getName() { return m_name; }
+  const EU::FName& 
+  getName() const { return m_name; }
 
   /**
    * @brief Establece el nombre del actor.
    * @param name Nuevo nombre para el actor.
    */
   void 
-  setName(const std::string& name) { m_name = name; }
+  setName(const EU::FName& name) { m_name = name; }
 
   /**
    * @brief Establece las texturas del actor.
@@ -146,8 +146,7 @@ private:
   //BlendState m_blendstate;               ///< Estado de blending usado por el actor.
   //Rasterizer m_rasterizer;               ///< Estado de rasterizacin usado por el actor.
   SamplerState m_sampler;                ///< Estado de muestreo de texturas.
-  CBChangesEveryFrame m_model;           ///< Constante de buffer para transformaciones por frame.
-  Buffer m_modelBuffer;                  ///< Constant buffer que contiene @c m_model.
+  Buffer m_modelBuffer;                  ///< Constant buffer por frame (world + color).
 
   // Recursos para sombras
   ShaderProgram m_shaderShadow;          ///< Shader program usado para renderizar sombras.
@@ -157,6 +156,6 @@ private:
   CBChangesEveryFrame m_cbShadow;        ///< Constant buffer especfico de sombras.
 
   XMFLOAT4 m_LightPos;                   ///< Posicin de la luz usada para proyectar sombras.
-  std::string m_name = "Actor";          ///< Nombre identificador del actor.
+  EU::FName m_name = "Actor";            ///< Nombre identificador del actor (internado).
   bool castShadow = true;                ///< Indica si el actor proyecta sombras.
 };
@@ -8,9 +8,11 @@ class DeviceContext;
  *
  * La clase Component define la interfaz bsica que todos los componentes deben implementar,
  * permitiendo actualizar y renderizar el componente, as como obtener su tipo.
+ * El recuento de referencias es intrusivo (EU::TRefCounted): las entidades los guardan en
+ * EU::TRefPtr sin reservar un bloque de control por componente.
  */
 class 
-Component {
+Component : public EU::TRefCounted<> {
 public:
   /**
    * @brief Constructor por defecto.
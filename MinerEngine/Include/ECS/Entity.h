@@ -47,33 +47,32 @@ public:
   /**
    * @brief Agrega un componente a la entidad.
    * @tparam T Tipo del componente, debe derivar de Component.
-   * @param component Puntero compartido al componente que se va a agregar.
+   * @param component Referencia al componente que se va a agregar.
    */
   template <typename T> void
-    addComponent(EU::TSharedPointer<T> component) {
+    addComponent(EU::TRefPtr<T> component) {
     static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
-    m_components.push_back(component.template dynamic_pointer_cast<Component>());
+    m_components.Add(EU::TRefPtr<Component>(component));
   }
 
   /**
    * @brief Obtiene un componente de la entidad por su tipo.
    * @tparam T Tipo del componente a obtener.
-   * @return Puntero compartido al componente si se encuentra, nullptr en caso contrario.
+   * @return Referencia al componente si se encuentra, nullptr en caso contrario.
    */
   template<typename T>
-  EU::TSharedPointer<T>
+  EU::TRefPtr<T>
     getComponent() {
     for (auto& component : m_components) {
-      EU::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
-      if (specificComponent) {
-        return specificComponent;
+      if (T* specificComponent = dynamic_cast<T*>(component.get())) {
+        return EU::TRefPtr<T>(specificComponent);
       }
     }
-    return EU::TSharedPointer<T>();
+    return EU::TRefPtr<T>();
   }
 private:
 protected:
   bool m_isActive;
   int m_id;
-  std::vector<EU::TSharedPointer<Component>> m_components;
+  EU::TInlineArray<EU::TRefPtr<Component>, 4> m_components;
 };
\ No newline at end of file
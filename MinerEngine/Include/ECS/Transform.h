@@ -1,14 +1,16 @@
 #pragma once
 #include "Prerequisites.h"
 #include "EngineUtilities/Vectors/Vector3.h"
+#include "EngineUtilities/Vectors/Quaternion.h"
 #include "Component.h"
 
+// Componente de posicin, rotacin y escala; sus instancias salen de EU::TPool<Transform>
 class 
-Transform : public Component {
+Transform : public Component, public EU::TPoolAllocated<Transform> {
 public:
   // Constructor que inicializa posicin, rotacin y escala por defecto
   Transform() : position(), 
-                rotation(), 
+                orientation(), 
                 scale(), 
                 matrix(), 
                 Component(ComponentType::TRANSFORM) {}
@@ -25,15 +27,19 @@ public:
   // @param deltaTime: Tiempo transcurrido desde la ltima actualizacin
   void 
   update(float deltaTime) override {
-    // Aplicar escala
-    XMMATRIX scaleMatrix = XMMatrixScaling(scale.x, scale.y, scale.z);
-    // Aplicar rotacion
-    XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
-    // Aplicar traslacion
-    XMMATRIX translationMatrix = XMMatrixTranslation(position.x, position.y, position.z);
-
-    // Componer la matriz final en el orden: scale -> rotation -> translation
-    matrix = scaleMatrix * rotationMatrix * translationMatrix;
+    // Componer scale -> rotation -> translation sin multiplicar matrices: con vectores fila,
+    // S * R escala cada fila de la matriz del cuaternio y T solo ocupa la fila 3
+    EU::Matrix4x4 world = orientation.toMatrix();
+    for (int column = 0; column < 3; ++column) {
+      world.m[0][column] *= scale.x;
+      world.m[1][column] *= scale.y;
+      world.m[2][column] *= scale.z;
+    }
+    world.m[3][0] = position.x;
+    world.m[3][1] = position.y;
+    world.m[3][2] = position.z;
+
+    matrix = XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(world.m));
   }
 
   // Renderiza el objeto Transform
@@ -56,12 +62,19 @@ public:
 
   // Mtodos de acceso a los datos de rotacin
   // Retorna la rotacin actual
-  const EU::Vector3&
-  getRotation() const { return rotation; }
+  const EU::Quaternion&
+  getOrientation() const { return orientation; }
 
   // Establece una nueva rotacin
   void 
-  setRotation(const EU::Vector3& newRot) { rotation = newRot; }
+  setOrientation(const EU::Quaternion& newOrientation) { orientation = newOrientation; }
+
+  // Establece la rotacin a partir de ngulos de Euler en radianes (x = pitch, y = yaw, z = roll),
+  // igual que XMMatrixRotationRollPitchYaw; la conversin se hace solo aqu, no en cada update
+  void 
+  setRotation(const EU::Vector3& newRot) {
+    orientation = EU::Quaternion::fromRollPitchYaw(newRot.x, newRot.y, newRot.z);
+  }
 
   // Mtodos de acceso a los datos de escala
   // Retorna la escala actual
@@ -77,7 +90,7 @@ public:
                const EU::Vector3& newRot,
                const EU::Vector3& newSca) {
     position = newPos;
-    rotation = newRot;
+    setRotation(newRot);
     scale = newSca;
   }
 
@@ -88,7 +101,7 @@ public:
 
 private:
   EU::Vector3 position;  // Posicin del objeto
-  EU::Vector3 rotation;  // Rotacin del objeto
+  EU::Quaternion orientation;  // Rotacin del objeto
   EU::Vector3 scale;     // Escala del objeto
 
 public:
@@ -26,8 +26,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
 */
-#pragma EU
-namespace EngineUtilities {
+#pragma once
+namespace EU {
   /**
  * @brief A 2x2 matrix class.
  *
@@ -43,10 +43,9 @@ namespace EngineUtilities {
      *
      * Initializes the matrix to the identity matrix.
      */
-    Matrix2x2() {
-      m[0][0] = 1; m[0][1] = 0;
-      m[1][0] = 0; m[1][1] = 1;
-    }
+    constexpr Matrix2x2()
+      : m{ { 1, 0 },
+           { 0, 1 } } {}
 
     /**
      * @brief Parameterized constructor.
@@ -58,10 +57,9 @@ namespace EngineUtilities {
      * @param a21 Element at row 2, column 1.
      * @param a22 Element at row 2, column 2.
      */
-    Matrix2x2(float a11, float a12, float a21, float a22) {
-      m[0][0] = a11; m[0][1] = a12;
-      m[1][0] = a21; m[1][1] = a22;
-    }
+    constexpr Matrix2x2(float a11, float a12, float a21, float a22)
+      : m{ { a11, a12 },
+           { a21, a22 } } {}
 
     /**
      * @brief Adds another matrix to this matrix.
@@ -69,7 +67,7 @@ namespace EngineUtilities {
      * @param other The matrix to add.
      * @return The result of the addition.
      */
-    Matrix2x2 operator+(const Matrix2x2& other) const {
+    constexpr Matrix2x2 operator+(const Matrix2x2& other) const {
       return Matrix2x2(
         m[0][0] + other.m[0][0], m[0][1] + other.m[0][1],
         m[1][0] + other.m[1][0], m[1][1] + other.m[1][1]
@@ -82,7 +80,7 @@ namespace EngineUtilities {
      * @param other The matrix to subtract.
      * @return The result of the subtraction.
      */
-    Matrix2x2 operator-(const Matrix2x2& other) const {
+    constexpr Matrix2x2 operator-(const Matrix2x2& other) const {
       return Matrix2x2(
         m[0][0] - other.m[0][0], m[0][1] - other.m[0][1],
         m[1][0] - other.m[1][0], m[1][1] - other.m[1][1]
@@ -95,7 +93,7 @@ namespace EngineUtilities {
      * @param other The matrix to multiply by.
      * @return The result of the multiplication.
      */
-    Matrix2x2 operator*(const Matrix2x2& other) const {
+    constexpr Matrix2x2 operator*(const Matrix2x2& other) const {
       return Matrix2x2(
         m[0][0] * other.m[0][0] + m[0][1] * other.m[1][0], m[0][0] * other.m[0][1] + m[0][1] * other.m[1][1],
         m[1][0] * other.m[0][0] + m[1][1] * other.m[1][0], m[1][0] * other.m[0][1] + m[1][1] * other.m[1][1]
@@ -108,7 +106,7 @@ namespace EngineUtilities {
      * @param scalar The scalar to multiply by.
      * @return The result of the multiplication.
      */
-    Matrix2x2 operator*(float scalar) const {
+    constexpr Matrix2x2 operator*(float scalar) const {
       return Matrix2x2(
         m[0][0] * scalar, m[0][1] * scalar,
         m[1][0] * scalar, m[1][1] * scalar
@@ -120,7 +118,7 @@ namespace EngineUtilities {
      *
      * @return The determinant of the matrix.
      */
-    float determinant() const {
+    constexpr float determinant() const {
       return m[0][0] * m[1][1] - m[0][1] * m[1][0];
     }
 
@@ -129,7 +127,7 @@ namespace EngineUtilities {
      *
      * @return The inverse of the matrix.
      */
-    Matrix2x2 inverse() const {
+    constexpr Matrix2x2 inverse() const {
       float det = determinant();
       if (det == 0) {
         // Handle non-invertible matrix gracefully.
@@ -141,5 +139,35 @@ namespace EngineUtilities {
         -m[1][0] * invDet, m[0][0] * invDet
       );
     }
+
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The matrix to compare with.
+     * @return True if every element is equal, false otherwise.
+     */
+    constexpr bool operator==(const Matrix2x2& other) const {
+      for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+          if (m[i][j] != other.m[i][j]) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The matrix to compare with.
+     * @return True if any element differs, false otherwise.
+     */
+    constexpr bool operator!=(const Matrix2x2& other) const {
+      return !(*this == other);
+    }
   };
+
+  static_assert(Matrix2x2(1, 2, 3, 4) * Matrix2x2(1, 2, 3, 4).inverse() == Matrix2x2(), "Matrix2x2: resultado incorrecto");
+  static_assert((Matrix2x2(1, 2, 3, 4) + Matrix2x2() - Matrix2x2()) * 2.0f == Matrix2x2(2, 4, 6, 8), "Matrix2x2: resultado incorrecto");
 }
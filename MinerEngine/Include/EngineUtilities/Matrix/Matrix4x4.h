@@ -27,38 +27,37 @@
  * SOFTWARE.
 */
 #pragma once
+#include "EngineUtilities/Utilities/VectorRegister.h"
+#include "EngineUtilities/Vectors/Vector4.h"
+
+EU_FLOAT_PRECISE_BEGIN
 namespace EU {
   /**
  * @brief A 4x4 matrix class.
  *
  * This class represents a 4x4 matrix and provides basic matrix operations such as
  * addition, subtraction, multiplication, determinant calculation, and inversion.
+ *
+ * The matrix is row-major and uses row vectors (v' = v * M), the same convention as
+ * XMMATRIX, so the translation lives in row 3. Each row is 16-byte aligned and is
+ * processed as one VectorRegister. The constructors are constexpr and the operators
+ * EU_SIMD_CONSTEXPR, so constant matrices (axis conversions, bias, projection presets)
+ * can be built and combined at compile time with the same bits as at run time.
  */
-  class Matrix4x4 {
+  class alignas(16) Matrix4x4 {
   public:
     float m[4][4]; /**< The elements of the matrix. */
 
-    // Default constructor initializes to identity matrix
-    Matrix4x4() {
-      for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < 4; ++j) {
-          m[i][j] = (i == j) ? 1.0f : 0.0f;
-        }
-      }
-    }
-
     /**
      * @brief Default constructor.
      *
      * Initializes the matrix to the identity matrix.
      */
-    Matrix4x4() {
-      m[0][0] = 1; m[0][1] = 0; m[0][2] = 0; m[0][3] = 0;
-      m[1][0] = 0; m[1][1] = 1; m[1][2] = 0; m[1][3] = 0;
-      m[2][0] = 0; m[2][1] = 0; m[2][2] = 1; m[2][3] = 0;
-      m[3][0] = 0; m[3][1] = 0; m[3][2] = 0; m[3][3] = 1;
-    }
-
+    constexpr Matrix4x4()
+      : m{ { 1, 0, 0, 0 },
+           { 0, 1, 0, 0 },
+           { 0, 0, 1, 0 },
+           { 0, 0, 0, 1 } } {}
 
     /**
      * @brief Parameterized constructor.
@@ -82,23 +81,33 @@ namespace EU {
      * @param a43 Element at row 4, column 3.
      * @param a44 Element at row 4, column 4.
      */
-    Matrix4x4(float a11, float a12, float a13, float a14,
+    constexpr Matrix4x4(float a11, float a12, float a13, float a14,
       float a21, float a22, float a23, float a24,
       float a31, float a32, float a33, float a34,
-      float a41, float a42, float a43, float a44) {
-      m[0][0] = a11; m[0][1] = a12; m[0][2] = a13; m[0][3] = a14;
-      m[1][0] = a21; m[1][1] = a22; m[1][2] = a23; m[1][3] = a24;
-      m[2][0] = a31; m[2][1] = a32; m[2][2] = a33; m[2][3] = a34;
-      m[3][0] = a41; m[3][1] = a42; m[3][2] = a43; m[3][3] = a44;
+      float a41, float a42, float a43, float a44)
+      : m{ { a11, a12, a13, a14 },
+           { a21, a22, a23, a24 },
+           { a31, a32, a33, a34 },
+           { a41, a42, a43, a44 } } {}
+
+    /**
+     * @brief Builds the matrix from four row registers.
+     */
+    Matrix4x4(VectorRegister r0, VectorRegister r1, VectorRegister r2, VectorRegister r3) {
+      VectorStore(r0, m[0]);
+      VectorStore(r1, m[1]);
+      VectorStore(r2, m[2]);
+      VectorStore(r3, m[3]);
     }
 
-    // Copy constructor
-    Matrix4x4(const Matrix4x4& other) {
-      for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < 4; ++j) {
-          m[i][j] = other.m[i][j];
-        }
-      }
+    /**
+     * @brief Loads a row into a SIMD register.
+     *
+     * @param index The row index (0-3).
+     * @return The register holding the row.
+     */
+    VectorRegister row(int index) const {
+      return VectorLoad(m[index]);
     }
 
     /**
@@ -107,13 +116,20 @@ namespace EU {
      * @param other The matrix to add.
      * @return The result of the addition.
      */
-    Matrix4x4 operator+(const Matrix4x4& other) const {
-      return Matrix4x4(
-        m[0][0] + other.m[0][0], m[0][1] + other.m[0][1], m[0][2] + other.m[0][2], m[0][3] + other.m[0][3],
-        m[1][0] + other.m[1][0], m[1][1] + other.m[1][1], m[1][2] + other.m[1][2], m[1][3] + other.m[1][3],
-        m[2][0] + other.m[2][0], m[2][1] + other.m[2][1], m[2][2] + other.m[2][2], m[2][3] + other.m[2][3],
-        m[3][0] + other.m[3][0], m[3][1] + other.m[3][1], m[3][2] + other.m[3][2], m[3][3] + other.m[3][3]
-      );
+    EU_SIMD_CONSTEXPR Matrix4x4 operator+(const Matrix4x4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        Matrix4x4 result;
+        for (int i = 0; i < 4; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            result.m[i][j] = m[i][j] + other.m[i][j];
+          }
+        }
+        return result;
+      }
+      return Matrix4x4(VectorAdd(row(0), other.row(0)),
+                       VectorAdd(row(1), other.row(1)),
+                       VectorAdd(row(2), other.row(2)),
+                       VectorAdd(row(3), other.row(3)));
     }
 
     /**
@@ -122,43 +138,126 @@ namespace EU {
      * @param other The matrix to subtract.
      * @return The result of the subtraction.
      */
-    Matrix4x4 operator-(const Matrix4x4& other) const {
-      return Matrix4x4(
-        m[0][0] - other.m[0][0], m[0][1] - other.m[0][1], m[0][2] - other.m[0][2], m[0][3] - other.m[0][3],
-        m[1][0] - other.m[1][0], m[1][1] - other.m[1][1], m[1][2] - other.m[1][2], m[1][3] - other.m[1][3],
-        m[2][0] - other.m[2][0], m[2][1] - other.m[2][1], m[2][2] - other.m[2][2], m[2][3] - other.m[2][3],
-        m[3][0] - other.m[3][0], m[3][1] - other.m[3][1], m[3][2] - other.m[3][2], m[3][3] - other.m[3][3]
-      );
+    EU_SIMD_CONSTEXPR Matrix4x4 operator-(const Matrix4x4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        Matrix4x4 result;
+        for (int i = 0; i < 4; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            result.m[i][j] = m[i][j] - other.m[i][j];
+          }
+        }
+        return result;
+      }
+      return Matrix4x4(VectorSubtract(row(0), other.row(0)),
+                       VectorSubtract(row(1), other.row(1)),
+                       VectorSubtract(row(2), other.row(2)),
+                       VectorSubtract(row(3), other.row(3)));
     }
 
     /**
      * @brief Multiplies this matrix by another matrix.
      *
+     * Each result row is a linear combination of the rows of other, accumulated in
+     * the same order as the scalar formula: ((a0*b0 + a1*b1) + a2*b2) + a3*b3.
+     *
      * @param other The matrix to multiply by.
      * @return The result of the multiplication.
      */
-    Matrix4x4 operator*(const Matrix4x4& other) const {
-      return Matrix4x4(
-        m[0][0] * other.m[0][0] + m[0][1] * other.m[1][0] + m[0][2] * other.m[2][0] + m[0][3] * other.m[3][0],
-        m[0][0] * other.m[0][1] + m[0][1] * other.m[1][1] + m[0][2] * other.m[2][1] + m[0][3] * other.m[3][1],
-        m[0][0] * other.m[0][2] + m[0][1] * other.m[1][2] + m[0][2] * other.m[2][2] + m[0][3] * other.m[3][2],
-        m[0][0] * other.m[0][3] + m[0][1] * other.m[1][3] + m[0][2] * other.m[2][3] + m[0][3] * other.m[3][3],
-
-        m[1][0] * other.m[0][0] + m[1][1] * other.m[1][0] + m[1][2] * other.m[2][0] + m[1][3] * other.m[3][0],
-        m[1][0] * other.m[0][1] + m[1][1] * other.m[1][1] + m[1][2] * other.m[2][1] + m[1][3] * other.m[3][1],
-        m[1][0] * other.m[0][2] + m[1][1] * other.m[1][2] + m[1][2] * other.m[2][2] + m[1][3] * other.m[3][2],
-        m[1][0] * other.m[0][3] + m[1][1] * other.m[1][3] + m[1][2] * other.m[2][3] + m[1][3] * other.m[3][3],
-
-        m[2][0] * other.m[0][0] + m[2][1] * other.m[1][0] + m[2][2] * other.m[2][0] + m[2][3] * other.m[3][0],
-        m[2][0] * other.m[0][1] + m[2][1] * other.m[1][1] + m[2][2] * other.m[2][1] + m[2][3] * other.m[3][1],
-        m[2][0] * other.m[0][2] + m[2][1] * other.m[1][2] + m[2][2] * other.m[2][2] + m[2][3] * other.m[3][2],
-        m[2][0] * other.m[0][3] + m[2][1] * other.m[1][3] + m[2][2] * other.m[2][3] + m[2][3] * other.m[3][3],
-
-        m[3][0] * other.m[0][0] + m[3][1] * other.m[1][0] + m[3][2] * other.m[2][0] + m[3][3] * other.m[3][0],
-        m[3][0] * other.m[0][1] + m[3][1] * other.m[1][1] + m[3][2] * other.m[2][1] + m[3][3] * other.m[3][1],
-        m[3][0] * other.m[0][2] + m[3][1] * other.m[1][2] + m[3][2] * other.m[2][2] + m[3][3] * other.m[3][2],
-        m[3][0] * other.m[0][3] + m[3][1] * other.m[1][3] + m[3][2] * other.m[2][3] + m[3][3] * other.m[3][3]
-      );
+    EU_SIMD_CONSTEXPR Matrix4x4 operator*(const Matrix4x4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        Matrix4x4 result;
+        for (int i = 0; i < 4; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            result.m[i][j] = combineColumn(m[i][0], m[i][1], m[i][2], m[i][3], other, j);
+          }
+        }
+        return result;
+      }
+      const VectorRegister b0 = other.row(0);
+      const VectorRegister b1 = other.row(1);
+      const VectorRegister b2 = other.row(2);
+      const VectorRegister b3 = other.row(3);
+      return Matrix4x4(combineRows(row(0), b0, b1, b2, b3),
+                       combineRows(row(1), b0, b1, b2, b3),
+                       combineRows(row(2), b0, b1, b2, b3),
+                       combineRows(row(3), b0, b1, b2, b3));
+    }
+
+    /**
+     * @brief Transforms a row vector by this matrix (v * M).
+     *
+     * @param v The vector to transform.
+     * @return The transformed vector.
+     */
+    EU_SIMD_CONSTEXPR Vector4 transform(const Vector4& v) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(combineColumn(v.x, v.y, v.z, v.w, *this, 0),
+                       combineColumn(v.x, v.y, v.z, v.w, *this, 1),
+                       combineColumn(v.x, v.y, v.z, v.w, *this, 2),
+                       combineColumn(v.x, v.y, v.z, v.w, *this, 3));
+      }
+      return Vector4(combineRows(v.toRegister(), row(0), row(1), row(2), row(3)));
+    }
+
+    /**
+     * @brief Returns the transposed matrix.
+     *
+     * @return The transpose of the matrix.
+     */
+    EU_SIMD_CONSTEXPR Matrix4x4 transpose() const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Matrix4x4(m[0][0], m[1][0], m[2][0], m[3][0],
+                         m[0][1], m[1][1], m[2][1], m[3][1],
+                         m[0][2], m[1][2], m[2][2], m[3][2],
+                         m[0][3], m[1][3], m[2][3], m[3][3]);
+      }
+      VectorRegister r0 = row(0);
+      VectorRegister r1 = row(1);
+      VectorRegister r2 = row(2);
+      VectorRegister r3 = row(3);
+      VectorTranspose4x4(r0, r1, r2, r3);
+      return Matrix4x4(r0, r1, r2, r3);
+    }
+
+    /**
+     * @brief Inverts an affine matrix (last column 0, 0, 0, 1).
+     *
+     * Much cheaper than a general inverse: the 3x3 block is inverted with cross
+     * products (adjugate / determinant) and the translation with one combination of
+     * rows. Rotation, scale (including non-uniform) and shear are supported; projection
+     * matrices are not. A singular matrix returns the identity.
+     *
+     * @return The inverse of the matrix.
+     */
+    Matrix4x4 inverseAffine() const {
+      const VectorRegister a = row(0);
+      const VectorRegister b = row(1);
+      const VectorRegister c = row(2);
+
+      // The columns of the inverse are the cross products of the rows.
+      VectorRegister r0 = VectorCross3(b, c);
+      VectorRegister r1 = VectorCross3(c, a);
+      VectorRegister r2 = VectorCross3(a, b);
+      const float det = VectorDot4(a, r0);
+      if (det == 0.0f) {
+        return Matrix4x4();
+      }
+
+      VectorRegister r3 = VectorZero();
+      VectorTranspose4x4(r0, r1, r2, r3);
+      const VectorRegister invDet = VectorSplat(1.0f / det);
+      r0 = VectorMultiply(r0, invDet);
+      r1 = VectorMultiply(r1, invDet);
+      r2 = VectorMultiply(r2, invDet);
+
+      // Translation: -t * R^-1, with w = 1.
+      const VectorRegister t = row(3);
+      VectorRegister translation = VectorMultiply(VectorReplicate<0>(t), r0);
+      translation = VectorMultiplyAdd(VectorReplicate<1>(t), r1, translation);
+      translation = VectorMultiplyAdd(VectorReplicate<2>(t), r2, translation);
+      r3 = VectorAdd(VectorNegate(translation), VectorSet(0.0f, 0.0f, 0.0f, 1.0f));
+
+      return Matrix4x4(r0, r1, r2, r3);
     }
 
     /**
@@ -166,7 +265,7 @@ namespace EU {
      *
      * @return The determinant of the matrix.
      */
-    float determinant() const {
+    constexpr float determinant() const {
       return
         m[0][0] * (
           m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
@@ -247,6 +346,65 @@ namespace EU {
     //  );
     //}
 
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The matrix to compare with.
+     * @return True if every element is equal, false otherwise.
+     */
+    constexpr bool operator==(const Matrix4x4& other) const {
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          if (m[i][j] != other.m[i][j]) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The matrix to compare with.
+     * @return True if any element differs, false otherwise.
+     */
+    constexpr bool operator!=(const Matrix4x4& other) const {
+      return !(*this == other);
+    }
+
+  private:
+    /**
+     * @brief Scalar form of combineRows for one column:
+     *        ((c0 * b[0][j] + c1 * b[1][j]) + c2 * b[2][j]) + c3 * b[3][j].
+     */
+    static constexpr float combineColumn(float c0, float c1, float c2, float c3,
+                                         const Matrix4x4& b, int j) {
+      return c0 * b.m[0][j] + c1 * b.m[1][j] + c2 * b.m[2][j] + c3 * b.m[3][j];
+    }
 
+    /**
+     * @brief Computes coeffs.x * r0 + coeffs.y * r1 + coeffs.z * r2 + coeffs.w * r3.
+     */
+    static VectorRegister combineRows(VectorRegister coeffs,
+                                      VectorRegister r0, VectorRegister r1,
+                                      VectorRegister r2, VectorRegister r3) {
+      VectorRegister result = VectorMultiply(VectorReplicate<0>(coeffs), r0);
+      result = VectorMultiplyAdd(VectorReplicate<1>(coeffs), r1, result);
+      result = VectorMultiplyAdd(VectorReplicate<2>(coeffs), r2, result);
+      result = VectorMultiplyAdd(VectorReplicate<3>(coeffs), r3, result);
+      return result;
+    }
   };
-}
\ No newline at end of file
+
+  static_assert(Matrix4x4().determinant() == 1.0f, "Matrix4x4: resultado incorrecto");
+#if EU_HAS_CONSTANT_EVALUATED
+  static_assert(Matrix4x4(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16) * Matrix4x4() ==
+                Matrix4x4(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16), "Matrix4x4: resultado incorrecto");
+  static_assert(Matrix4x4(0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 5, 6, 7, 1).transform(Vector4(1, 2, 3, 1)) ==
+                Vector4(3, 7, 10, 1), "Matrix4x4::transform: resultado incorrecto");
+  static_assert(Matrix4x4(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16).transpose().m[0][3] == 13.0f &&
+                (Matrix4x4() + Matrix4x4() - Matrix4x4()) == Matrix4x4(), "Matrix4x4: resultado incorrecto");
+#endif
+}
+EU_FLOAT_PRECISE_END
@@ -0,0 +1,336 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../Structures/TSpan.h"
+#include "MemoryTracker.h"
+
+namespace EU {
+	/**
+	 * @brief Asignador lineal (bump): cada reserva avanza un cursor sobre un bloque contiguo.
+	 *
+	 * No libera reservas sueltas; Reset() las invalida todas de golpe en O(1). Si el bloque
+	 * principal se llena, las reservas siguientes van a bloques de desbordamiento y, en el
+	 * siguiente Reset(), el bloque principal crece para que quepa todo lo usado. As, tras unos
+	 * pocos ciclos de calentamiento, un uso estable no vuelve a pedir memoria al sistema.
+	 *
+	 * Sus bloques se atribuyen a MemoryTag::Transient.
+	 *
+	 * No ejecuta destructores: solo debe guardar datos trivialmente destructibles.
+	 * No es seguro entre hilos.
+	 */
+	class LinearArena
+	{
+	public:
+		LinearArena() = default;
+
+		/**
+		 * @brief Crea la arena con un bloque principal de Capacity bytes.
+		 */
+		explicit LinearArena(size_t Capacity)
+		{
+			Reserve(Capacity);
+		}
+
+		~LinearArena()
+		{
+			FreeOverflow();
+			TaggedMemory::Free(Base);
+		}
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		/**
+		 * @brief Asegura un bloque principal de al menos Capacity bytes.
+		 *
+		 * Invalida todas las reservas vivas.
+		 */
+		void Reserve(size_t NewCapacity)
+		{
+			FreeOverflow();
+			if (NewCapacity > Capacity)
+			{
+				TaggedMemory::Free(Base);
+				Base = static_cast<uint8_t*>(TaggedMemory::Allocate(NewCapacity, alignof(std::max_align_t), MemoryTag::Transient));
+				Capacity = NewCapacity;
+			}
+			Offset = 0;
+		}
+
+		/**
+		 * @brief Reserva Size bytes alineados a Alignment (potencia de dos).
+		 *
+		 * @return Memoria sin inicializar, vlida hasta el prximo Reset().
+		 */
+		void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+		{
+			const uintptr_t Start = reinterpret_cast<uintptr_t>(Base);
+			const uintptr_t Aligned = AlignUp(Start + Offset, Alignment);
+			if (Base != nullptr && Aligned + Size <= Start + Capacity)
+			{
+				Offset = static_cast<size_t>(Aligned + Size - Start);
+				return reinterpret_cast<void*>(Aligned);
+			}
+			return AllocateOverflow(Size, Alignment);
+		}
+
+		/**
+		 * @brief Invalida todas las reservas.
+		 *
+		 * Si hubo desbordamiento, el bloque principal crece para cubrir lo usado en este ciclo.
+		 */
+		void Reset()
+		{
+			if (OverflowHead != nullptr)
+			{
+				const size_t Needed = Offset + OverflowBytes;
+				Reserve(AlignUp(Needed + Needed / 4, 4096));
+			}
+			Offset = 0;
+		}
+
+		/**
+		 * @brief Bytes usados del bloque principal ms los servidos desde desbordamiento.
+		 */
+		size_t GetUsed() const { return Offset + OverflowBytes; }
+
+		/**
+		 * @brief Tamao del bloque principal.
+		 */
+		size_t GetCapacity() const { return Capacity; }
+
+		/**
+		 * @brief Indica si alguna reserva de este ciclo no cupo en el bloque principal.
+		 */
+		bool HasOverflowed() const { return OverflowHead != nullptr; }
+
+	private:
+		/**
+		 * @brief Cabecera de un bloque de desbordamiento; los datos van justo detrs.
+		 */
+		struct FOverflowChunk
+		{
+			FOverflowChunk* Next;
+			size_t Size;
+		};
+
+		static uintptr_t AlignUp(uintptr_t Value, size_t Alignment)
+		{
+			return (Value + (Alignment - 1)) & ~static_cast<uintptr_t>(Alignment - 1);
+		}
+
+		void* AllocateOverflow(size_t Size, size_t Alignment)
+		{
+			uintptr_t Aligned = AlignUp(reinterpret_cast<uintptr_t>(OverflowCursor), Alignment);
+			if (OverflowCursor == nullptr || Aligned + Size > reinterpret_cast<uintptr_t>(OverflowEnd))
+			{
+				const size_t MinChunk = Capacity > 4096 ? Capacity / 2 : 4096;
+				const size_t Needed = Size + Alignment + sizeof(FOverflowChunk);
+				const size_t ChunkSize = Needed > MinChunk ? Needed : MinChunk;
+
+				FOverflowChunk* Chunk = static_cast<FOverflowChunk*>(
+					TaggedMemory::Allocate(ChunkSize, alignof(std::max_align_t), MemoryTag::Transient));
+				Chunk->Next = OverflowHead;
+				Chunk->Size = ChunkSize;
+				OverflowHead = Chunk;
+				OverflowCursor = reinterpret_cast<uint8_t*>(Chunk + 1);
+				OverflowEnd = reinterpret_cast<uint8_t*>(Chunk) + ChunkSize;
+				Aligned = AlignUp(reinterpret_cast<uintptr_t>(OverflowCursor), Alignment);
+			}
+			OverflowBytes += static_cast<size_t>(Aligned + Size - reinterpret_cast<uintptr_t>(OverflowCursor));
+			OverflowCursor = reinterpret_cast<uint8_t*>(Aligned + Size);
+			return reinterpret_cast<void*>(Aligned);
+		}
+
+		void FreeOverflow()
+		{
+			while (OverflowHead != nullptr)
+			{
+				FOverflowChunk* Next = OverflowHead->Next;
+				TaggedMemory::Free(OverflowHead);
+				OverflowHead = Next;
+			}
+			OverflowCursor = nullptr;
+			OverflowEnd = nullptr;
+			OverflowBytes = 0;
+		}
+
+		uint8_t* Base = nullptr;                  ///< Bloque principal.
+		size_t Capacity = 0;                      ///< Tamao del bloque principal.
+		size_t Offset = 0;                        ///< Cursor dentro del bloque principal.
+
+		FOverflowChunk* OverflowHead = nullptr;   ///< Bloques de desbordamiento de este ciclo.
+		uint8_t* OverflowCursor = nullptr;        ///< Cursor dentro del ltimo bloque de desbordamiento.
+		uint8_t* OverflowEnd = nullptr;           ///< Fin del ltimo bloque de desbordamiento.
+		size_t OverflowBytes = 0;                 ///< Bytes servidos desde desbordamiento en este ciclo.
+	};
+
+	/**
+	 * @brief Memoria temporal por frame: N arenas lineales que se reciclan en rotacin.
+	 *
+	 * BeginFrame() pasa a la siguiente arena y la vaca. Con N arenas, lo reservado en un frame
+	 * sigue siendo vlido durante los N - 1 frames siguientes; con el valor por defecto (2) los
+	 * datos del frame anterior siguen vivos mientras otro hilo (por ejemplo, el de render) los consume.
+	 *
+	 * Pensada para el hilo principal; no es segura entre hilos. Solo admite tipos trivialmente
+	 * destructibles, porque las arenas no ejecutan destructores.
+	 */
+	class FrameArena
+	{
+	public:
+		static constexpr uint32_t MaxBuffers = 4;  ///< Mximo de arenas en rotacin.
+
+		/**
+		 * @brief Crea NumBuffers arenas de BytesPerFrame bytes cada una.
+		 */
+		explicit FrameArena(size_t BytesPerFrame = 256 * 1024, uint32_t NumBuffers = 2)
+			: NumBuffers(NumBuffers < 1 ? 1 : (NumBuffers > MaxBuffers ? MaxBuffers : NumBuffers))
+		{
+			for (uint32_t i = 0; i < this->NumBuffers; ++i)
+			{
+				Buffers[i].Reserve(BytesPerFrame);
+			}
+		}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/**
+		 * @brief Arena de frame global del motor.
+		 */
+		static FrameArena& Get()
+		{
+			static FrameArena Instance;
+			return Instance;
+		}
+
+		/**
+		 * @brief Empieza un frame nuevo: avanza a la siguiente arena y la vaca.
+		 *
+		 * Invalida lo reservado hace NumBuffers frames.
+		 */
+		void BeginFrame()
+		{
+			++FrameNumber;
+			Current = static_cast<uint32_t>(FrameNumber % NumBuffers);
+			Buffers[Current].Reset();
+		}
+
+		/**
+		 * @brief Reserva Size bytes sin inicializar en la arena del frame actual.
+		 */
+		void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+		{
+			return Buffers[Current].Allocate(Size, Alignment);
+		}
+
+		/**
+		 * @brief Construye un T en la arena del frame actual.
+		 */
+		template<typename T, typename... Args>
+		T* New(Args&&... args)
+		{
+			static_assert(std::is_trivially_destructible<T>::value,
+				"FrameArena no ejecuta destructores");
+			return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		/**
+		 * @brief Construye Count elementos T() contiguos en la arena del frame actual.
+		 */
+		template<typename T>
+		TSpan<T> NewArray(size_t Count)
+		{
+			static_assert(std::is_trivially_destructible<T>::value,
+				"FrameArena no ejecuta destructores");
+			if (Count == 0)
+			{
+				return TSpan<T>();
+			}
+			T* Data = static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+			for (size_t i = 0; i < Count; ++i)
+			{
+				::new (Data + i) T();
+			}
+			return TSpan<T>(Data, Count);
+		}
+
+		/**
+		 * @brief Nmero de frames iniciados con BeginFrame().
+		 */
+		uint64_t GetFrameNumber() const { return FrameNumber; }
+
+		/**
+		 * @brief Nmero de arenas en rotacin.
+		 */
+		uint32_t GetNumBuffers() const { return NumBuffers; }
+
+		/**
+		 * @brief Arena del frame actual (para consultar uso o capacidad).
+		 */
+		const LinearArena& GetCurrentArena() const { return Buffers[Current]; }
+
+	private:
+		LinearArena Buffers[MaxBuffers];  ///< Arenas en rotacin (solo se usan las NumBuffers primeras).
+		uint32_t NumBuffers;              ///< Arenas activas.
+		uint32_t Current = 0;             ///< Arena del frame actual.
+		uint64_t FrameNumber = 0;         ///< Frames iniciados.
+	};
+
+	// EXAMPLE
+
+	/*
+	struct FDrawKey
+	{
+		uint64_t Key;
+		uint32_t ActorIndex;
+	};
+
+	int main() {
+
+		FrameArena Arena(64 * 1024);
+
+		for (int Frame = 0; Frame < 3; ++Frame) {
+			Arena.BeginFrame();                                  // Vaca la arena de hace dos frames.
+
+			TSpan<FDrawKey> Keys = Arena.NewArray<FDrawKey>(128); // Sin malloc en rgimen estable.
+			XMFLOAT4* Color = Arena.New<XMFLOAT4>(1.0f, 1.0f, 1.0f, 1.0f);
+
+			std::cout << Arena.GetCurrentArena().GetUsed() << std::endl;
+		}
+
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,459 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <type_traits>
+#include "../Utilities/Platform.h"
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+/**
+ * @brief EU_MEMORY_TRACKING activa las cabeceras de TaggedMemory y los contadores de MemoryTracker.
+ *
+ * Por defecto vale 1 en Debug y Profile y 0 en Release (NDEBUG sin PROFILE), la configuracin
+ * de distribucin del vcxproj: ah TaggedMemory reserva directamente del sistema, sin cabecera
+ * ni atmicos, y MemoryTracker solo devuelve ceros. Se puede forzar con /D EU_MEMORY_TRACKING=0
+ * o 1, pero con el mismo valor en todo el programa (un bloque se libera segn cmo se reserv).
+ */
+#if !defined(EU_MEMORY_TRACKING)
+#if defined(NDEBUG) && !defined(PROFILE)
+#define EU_MEMORY_TRACKING 0
+#else
+#define EU_MEMORY_TRACKING 1
+#endif
+#endif
+
+namespace EU {
+	/**
+	 * @brief Subsistema al que se atribuye una reserva de memoria.
+	 */
+	enum class MemoryTag : uint8_t
+	{
+		Untagged,   ///< Sin mbito activo.
+		Mesh,       ///< Vrtices e ndices de mallas en CPU.
+		Texture,    ///< Pxeles decodificados (stb_image) y datos de texturas.
+		ECS,        ///< Actores, componentes y sus pools.
+		Loader,     ///< Temporales de carga de modelos y escenas.
+		Transient,  ///< Memoria por frame (FrameArena).
+		Count
+	};
+
+	/**
+	 * @brief Nombre legible de una etiqueta (el que se usa en el JSON).
+	 */
+	inline const char* GetMemoryTagName(MemoryTag Tag)
+	{
+		static const char* const Names[] = { "Untagged", "Mesh", "Texture", "ECS", "Loader", "Transient" };
+		static_assert(sizeof(Names) / sizeof(Names[0]) == static_cast<size_t>(MemoryTag::Count),
+			"Falta el nombre de alguna MemoryTag");
+		return Names[static_cast<size_t>(Tag)];
+	}
+
+	/**
+	 * @brief Instantnea de los contadores de una etiqueta.
+	 */
+	struct FMemoryTagStats
+	{
+		uint64_t LiveBytes = 0;           ///< Bytes reservados y an no liberados.
+		uint64_t PeakBytes = 0;           ///< Mximo de LiveBytes desde el arranque.
+		uint64_t NumAllocations = 0;      ///< Reservas totales desde el arranque.
+		uint64_t FrameAllocations = 0;    ///< Reservas durante el ltimo frame completo.
+		uint64_t BudgetBytes = 0;         ///< Presupuesto (0 = sin presupuesto).
+	};
+
+	/**
+	 * @brief Contadores de memoria por etiqueta, seguros entre hilos y consultables en tiempo real.
+	 *
+	 * Los alimenta TaggedMemory::Allocate/Free, por donde pasan los contenedores de EngineUtilities,
+	 * los bloques de control de los punteros compartidos, los pools, la FrameArena y stb_image.
+	 * Los contadores son atmicos relajados: las lecturas son coherentes por campo, no entre campos.
+	 * Cada etiqueta ocupa su propia lnea de cach, as que los hilos que reservan con etiquetas
+	 * distintas (ECS en el hilo de juego, Texture en el de carga) no se invalidan entre s.
+	 */
+	class MemoryTracker
+	{
+	public:
+		static MemoryTracker& Get()
+		{
+			static MemoryTracker Instance;
+			return Instance;
+		}
+
+		void OnAllocate(MemoryTag Tag, size_t Size)
+		{
+#if EU_MEMORY_TRACKING
+			FCounters& Counters = Tags[static_cast<size_t>(Tag)];
+			const uint64_t Live = Counters.LiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+			uint64_t Peak = Counters.PeakBytes.load(std::memory_order_relaxed);
+			while (Live > Peak && !Counters.PeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed))
+			{
+			}
+			Counters.NumAllocations.fetch_add(1, std::memory_order_relaxed);
+			Counters.CurrentFrameAllocations.fetch_add(1, std::memory_order_relaxed);
+#else
+			(void)Tag;
+			(void)Size;
+#endif
+		}
+
+		void OnFree(MemoryTag Tag, size_t Size)
+		{
+#if EU_MEMORY_TRACKING
+			Tags[static_cast<size_t>(Tag)].LiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+#else
+			(void)Tag;
+			(void)Size;
+#endif
+		}
+
+		/**
+		 * @brief Cierra el frame: publica las reservas por frame y reinicia el contador.
+		 */
+		void BeginFrame()
+		{
+			for (FCounters& Counters : Tags)
+			{
+				Counters.LastFrameAllocations.store(
+					Counters.CurrentFrameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @brief Fija el presupuesto de una etiqueta en bytes (0 lo desactiva).
+		 */
+		void SetBudget(MemoryTag Tag, uint64_t BudgetBytes)
+		{
+			Tags[static_cast<size_t>(Tag)].BudgetBytes.store(BudgetBytes, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Indica si la etiqueta supera su presupuesto.
+		 */
+		bool IsOverBudget(MemoryTag Tag) const
+		{
+			const FMemoryTagStats Stats = GetStats(Tag);
+			return Stats.BudgetBytes != 0 && Stats.LiveBytes > Stats.BudgetBytes;
+		}
+
+		FMemoryTagStats GetStats(MemoryTag Tag) const
+		{
+			const FCounters& Counters = Tags[static_cast<size_t>(Tag)];
+			FMemoryTagStats Stats;
+			Stats.LiveBytes = Counters.LiveBytes.load(std::memory_order_relaxed);
+			Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+			Stats.NumAllocations = Counters.NumAllocations.load(std::memory_order_relaxed);
+			Stats.FrameAllocations = Counters.LastFrameAllocations.load(std::memory_order_relaxed);
+			Stats.BudgetBytes = Counters.BudgetBytes.load(std::memory_order_relaxed);
+			return Stats;
+		}
+
+		/**
+		 * @brief Serializa los contadores de todas las etiquetas a JSON.
+		 */
+		std::string ToJson() const
+		{
+			std::string Json = "{\n  \"tags\": [\n";
+			char Line[320];
+			for (size_t i = 0; i < static_cast<size_t>(MemoryTag::Count); ++i)
+			{
+				const MemoryTag Tag = static_cast<MemoryTag>(i);
+				const FMemoryTagStats Stats = GetStats(Tag);
+				snprintf(Line, sizeof(Line),
+					"    { \"name\": \"%s\", \"liveBytes\": %llu, \"peakBytes\": %llu, \"allocations\": %llu, "
+					"\"frameAllocations\": %llu, \"budgetBytes\": %llu, \"overBudget\": %s }%s\n",
+					GetMemoryTagName(Tag),
+					static_cast<unsigned long long>(Stats.LiveBytes),
+					static_cast<unsigned long long>(Stats.PeakBytes),
+					static_cast<unsigned long long>(Stats.NumAllocations),
+					static_cast<unsigned long long>(Stats.FrameAllocations),
+					static_cast<unsigned long long>(Stats.BudgetBytes),
+					IsOverBudget(Tag) ? "true" : "false",
+					i + 1 < static_cast<size_t>(MemoryTag::Count) ? "," : "");
+				Json += Line;
+			}
+			Json += "  ]\n}\n";
+			return Json;
+		}
+
+		/**
+		 * @brief Escribe ToJson() en un archivo.
+		 * @return false si no se pudo abrir el archivo.
+		 */
+		bool DumpJson(const char* Path) const
+		{
+			std::ofstream File(Path, std::ios::binary);
+			if (!File)
+			{
+				return false;
+			}
+			File << ToJson();
+			return static_cast<bool>(File);
+		}
+
+	private:
+		struct alignas(CacheLineSize) FCounters
+		{
+			std::atomic<uint64_t> LiveBytes{ 0 };
+			std::atomic<uint64_t> PeakBytes{ 0 };
+			std::atomic<uint64_t> NumAllocations{ 0 };
+			std::atomic<uint64_t> CurrentFrameAllocations{ 0 };
+			std::atomic<uint64_t> LastFrameAllocations{ 0 };
+			std::atomic<uint64_t> BudgetBytes{ 0 };
+		};
+
+		static_assert(sizeof(FCounters) == CacheLineSize, "Los contadores de una etiqueta deben ocupar una lnea de cach");
+
+		FCounters Tags[static_cast<size_t>(MemoryTag::Count)];
+	};
+
+	/**
+	 * @brief Etiqueta activa en este hilo para las reservas que no indican una explcitamente.
+	 */
+	inline MemoryTag& CurrentMemoryTag()
+	{
+		static thread_local MemoryTag Tag = MemoryTag::Untagged;
+		return Tag;
+	}
+
+	/**
+	 * @brief Activa una etiqueta durante su mbito y restaura la anterior al salir (se pueden anidar).
+	 */
+	class FScopedMemoryTag
+	{
+	public:
+		explicit FScopedMemoryTag(MemoryTag Tag) : Previous(CurrentMemoryTag())
+		{
+			CurrentMemoryTag() = Tag;
+		}
+
+		~FScopedMemoryTag()
+		{
+			CurrentMemoryTag() = Previous;
+		}
+
+		FScopedMemoryTag(const FScopedMemoryTag&) = delete;
+		FScopedMemoryTag& operator=(const FScopedMemoryTag&) = delete;
+
+	private:
+		MemoryTag Previous;
+	};
+
+	/**
+	 * @brief Reservas etiquetadas: cada bloque lleva delante una cabecera con su tamao y etiqueta,
+	 * as que Free no necesita que se le repitan.
+	 *
+	 * Con EU_MEMORY_TRACKING = 0 no hay cabecera: Allocate pide el bloque alineado al sistema
+	 * (_aligned_malloc o posix_memalign) y Free lo devuelve tal cual.
+	 */
+	namespace TaggedMemory {
+		struct FHeader
+		{
+			size_t Size;        ///< Bytes pedidos por el usuario.
+			uint32_t Offset;    ///< Distancia desde el inicio del bloque real hasta el puntero devuelto.
+			MemoryTag Tag;
+		};
+
+		constexpr size_t MinHeaderSpace = 16;
+		static_assert(sizeof(FHeader) <= MinHeaderSpace, "La cabecera debe caber en MinHeaderSpace");
+
+		/**
+		 * @brief Reserva Size bytes alineados a Alignment y los atribuye a Tag.
+		 */
+		inline void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t), MemoryTag Tag = CurrentMemoryTag())
+		{
+#if !EU_MEMORY_TRACKING
+			(void)Tag;
+			const size_t BlockAlignment = Alignment > MinHeaderSpace ? Alignment : MinHeaderSpace;
+#if defined(_MSC_VER)
+			void* Block = _aligned_malloc(Size != 0 ? Size : 1, BlockAlignment);
+#else
+			void* Block = nullptr;
+			if (posix_memalign(&Block, BlockAlignment, Size != 0 ? Size : 1) != 0)
+			{
+				Block = nullptr;
+			}
+#endif
+			if (Block == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return Block;
+#else
+			const size_t HeaderSpace = Alignment > MinHeaderSpace ? Alignment : MinHeaderSpace;
+			uint8_t* Block = HeaderSpace > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+				? static_cast<uint8_t*>(::operator new(HeaderSpace + Size, std::align_val_t(HeaderSpace)))
+				: static_cast<uint8_t*>(::operator new(HeaderSpace + Size));
+			uint8_t* User = Block + HeaderSpace;
+
+			FHeader* Header = reinterpret_cast<FHeader*>(User) - 1;
+			Header->Size = Size;
+			Header->Offset = static_cast<uint32_t>(HeaderSpace);
+			Header->Tag = Tag;
+
+			MemoryTracker::Get().OnAllocate(Tag, Size);
+			return User;
+#endif
+		}
+
+		/**
+		 * @brief Libera un bloque de Allocate (nullptr se ignora).
+		 */
+		inline void Free(void* Memory)
+		{
+			if (Memory == nullptr)
+			{
+				return;
+			}
+#if !EU_MEMORY_TRACKING
+#if defined(_MSC_VER)
+			_aligned_free(Memory);
+#else
+			std::free(Memory);
+#endif
+#else
+			const FHeader* Header = static_cast<const FHeader*>(Memory) - 1;
+			MemoryTracker::Get().OnFree(Header->Tag, Header->Size);
+
+			const size_t HeaderSpace = Header->Offset;
+			uint8_t* Block = static_cast<uint8_t*>(Memory) - HeaderSpace;
+			if (HeaderSpace > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				::operator delete(Block, std::align_val_t(HeaderSpace));
+			}
+			else
+			{
+				::operator delete(Block);
+			}
+#endif
+		}
+
+		/**
+		 * @brief Cambia el tamao de un bloque conservando su contenido, etiqueta y alineacin.
+		 *
+		 * Sin EU_MEMORY_TRACKING no se conoce la alineacin original: solo admite bloques reservados
+		 * con alineacin <= MinHeaderSpace (los de stb_image piden 16).
+		 */
+		inline void* Reallocate(void* Memory, size_t NewSize)
+		{
+			if (Memory == nullptr)
+			{
+				return Allocate(NewSize);
+			}
+#if !EU_MEMORY_TRACKING
+#if defined(_MSC_VER)
+			void* NewMemory = _aligned_realloc(Memory, NewSize != 0 ? NewSize : 1, MinHeaderSpace);
+#else
+			void* NewMemory = std::realloc(Memory, NewSize != 0 ? NewSize : 1);
+#endif
+			if (NewMemory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return NewMemory;
+#else
+			const FHeader* Header = static_cast<const FHeader*>(Memory) - 1;
+			void* NewMemory = Allocate(NewSize, Header->Offset, Header->Tag);
+			memcpy(NewMemory, Memory, Header->Size < NewSize ? Header->Size : NewSize);
+			Free(Memory);
+			return NewMemory;
+#endif
+		}
+	}
+
+	/**
+	 * @brief Asignador compatible con la biblioteca estndar que reserva con una etiqueta fija.
+	 *
+	 * @tparam T Tipo de los elementos.
+	 * @tparam Tag Etiqueta a la que se atribuyen las reservas.
+	 */
+	template<typename T, MemoryTag Tag>
+	struct TTaggedAllocator
+	{
+		using value_type = T;
+		using is_always_equal = std::true_type;  ///< Sin estado: cualquier instancia libera lo de otra.
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TTaggedAllocator<U, Tag>;
+		};
+
+		TTaggedAllocator() = default;
+
+		template<typename U>
+		TTaggedAllocator(const TTaggedAllocator<U, Tag>&) {}
+
+		T* allocate(size_t Count)
+		{
+			return static_cast<T*>(TaggedMemory::Allocate(Count * sizeof(T), alignof(T), Tag));
+		}
+
+		void deallocate(T* Memory, size_t)
+		{
+			TaggedMemory::Free(Memory);
+		}
+
+		template<typename U>
+		bool operator==(const TTaggedAllocator<U, Tag>&) const { return true; }
+
+		template<typename U>
+		bool operator!=(const TTaggedAllocator<U, Tag>&) const { return false; }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		MemoryTracker::Get().SetBudget(MemoryTag::Mesh, 64 * 1024 * 1024);
+
+		{
+			FScopedMemoryTag Scope(MemoryTag::Loader);
+			TArray<int> Temporary;                           // Se atribuye a Loader.
+			Temporary.Add(1);
+		}
+
+		std::vector<float, TTaggedAllocator<float, MemoryTag::Mesh>> Positions(1024);
+
+		std::cout << MemoryTracker::Get().GetStats(MemoryTag::Mesh).LiveBytes << std::endl;  // 4096
+		MemoryTracker::Get().DumpJson("MemoryReport.json");
+		return 0;
+	}
+	*/
+}
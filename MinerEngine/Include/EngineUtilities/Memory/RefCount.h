@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "MemoryTracker.h"
+
+namespace EU {
+	/**
+	 * @brief Indica si un recuento de referencias debe ser seguro entre hilos.
+	 */
+	enum class RefCountMode
+	{
+		ThreadSafe,    ///< Operaciones atmicas; el puntero puede compartirse entre hilos.
+		NotThreadSafe  ///< Enteros normales; solo para objetos que nunca salen de un hilo.
+	};
+
+	/**
+	 * @brief Contador de referencias con la sincronizacin mnima necesaria.
+	 *
+	 * Incrementar solo necesita atomicidad (relaxed): quien incrementa ya tiene una referencia.
+	 * Decrementar usa acq_rel para que quien libera el objeto vea todas las escrituras previas
+	 * de los dems propietarios.
+	 */
+	template<RefCountMode Mode>
+	class TRefCounter
+	{
+	private:
+		std::atomic<int32_t> Count;
+
+	public:
+		explicit TRefCounter(int32_t Initial) : Count(Initial) {}
+
+		void Increment()
+		{
+			Count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @return El valor tras decrementar.
+		 */
+		int32_t Decrement()
+		{
+			return Count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		}
+
+		/**
+		 * @brief Incrementa solo si el valor no es cero (para promover una referencia dbil).
+		 *
+		 * @return false si el valor ya era cero.
+		 */
+		bool IncrementIfNotZero()
+		{
+			int32_t Current = Count.load(std::memory_order_relaxed);
+			while (Current != 0)
+			{
+				if (Count.compare_exchange_weak(Current, Current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		int32_t Load() const
+		{
+			return Count.load(std::memory_order_acquire);
+		}
+	};
+
+	/**
+	 * @brief Versin no atmica del contador.
+	 */
+	template<>
+	class TRefCounter<RefCountMode::NotThreadSafe>
+	{
+	private:
+		int32_t Count;
+
+	public:
+		explicit TRefCounter(int32_t Initial) : Count(Initial) {}
+
+		void Increment() { ++Count; }
+		int32_t Decrement() { return --Count; }
+
+		bool IncrementIfNotZero()
+		{
+			if (Count == 0)
+			{
+				return false;
+			}
+			++Count;
+			return true;
+		}
+
+		int32_t Load() const { return Count; }
+	};
+
+	/**
+	 * @brief Bloque de control compartido por los TSharedPointer y TWeakPointer de un mismo objeto.
+	 *
+	 * Strong cuenta los punteros compartidos; al llegar a cero se destruye el objeto.
+	 * Weak cuenta los punteros dbiles ms uno mientras Strong sea mayor que cero; al llegar a cero
+	 * se libera el bloque. As un puntero dbil puede comprobar Strong sin que el bloque desaparezca.
+	 */
+	template<RefCountMode Mode>
+	class TControlBlock
+	{
+	private:
+		TRefCounter<Mode> Strong;
+		TRefCounter<Mode> Weak;
+
+	protected:
+		/**
+		 * @brief Destruye el objeto gestionado (Strong ha llegado a cero).
+		 */
+		virtual void DestroyObject() = 0;
+
+		/**
+		 * @brief Libera el propio bloque (Weak ha llegado a cero).
+		 */
+		virtual void DestroyBlock() = 0;
+
+	public:
+		TControlBlock() : Strong(1), Weak(1) {}
+		virtual ~TControlBlock() = default;
+
+		TControlBlock(const TControlBlock&) = delete;
+		TControlBlock& operator=(const TControlBlock&) = delete;
+
+		/**
+		 * @brief Los bloques (y los objetos de MakeShared) se reservan con la etiqueta de memoria activa.
+		 */
+		static void* operator new(size_t Size) { return TaggedMemory::Allocate(Size); }
+		static void* operator new(size_t Size, std::align_val_t Alignment) { return TaggedMemory::Allocate(Size, static_cast<size_t>(Alignment)); }
+		static void* operator new(size_t, void* Place) noexcept { return Place; }
+		static void operator delete(void* Memory) { TaggedMemory::Free(Memory); }
+		static void operator delete(void* Memory, std::align_val_t) { TaggedMemory::Free(Memory); }
+		static void operator delete(void*, void*) noexcept {}
+
+		void AddStrong() { Strong.Increment(); }
+
+		void ReleaseStrong()
+		{
+			if (Strong.Decrement() == 0)
+			{
+				DestroyObject();
+				if (Weak.Load() == 1)
+				{
+					DestroyBlock();  ///< Sin punteros dbiles: nadie ms puede tocar el bloque, ahorramos un RMW atmico.
+				}
+				else
+				{
+					ReleaseWeak();  ///< La referencia dbil implcita de los punteros compartidos.
+				}
+			}
+		}
+
+		bool TryAddStrong() { return Strong.IncrementIfNotZero(); }
+
+		void AddWeak() { Weak.Increment(); }
+
+		void ReleaseWeak()
+		{
+			if (Weak.Decrement() == 0)
+			{
+				DestroyBlock();
+			}
+		}
+
+		int32_t GetStrongCount() const { return Strong.Load(); }
+	};
+
+	/**
+	 * @brief Bloque de control para un objeto reservado aparte (constructor desde puntero crudo).
+	 */
+	template<typename T, RefCountMode Mode>
+	class TPointerControlBlock : public TControlBlock<Mode>
+	{
+	private:
+		T* Object;
+
+	protected:
+		void DestroyObject() override { delete Object; }
+		void DestroyBlock() override { delete this; }
+
+	public:
+		explicit TPointerControlBlock(T* Object) : Object(Object) {}
+	};
+
+	/**
+	 * @brief Bloque de control que contiene el objeto en la misma reserva (MakeShared).
+	 */
+	template<typename T, RefCountMode Mode>
+	class TInlineControlBlock : public TControlBlock<Mode>
+	{
+	private:
+		alignas(T) unsigned char Storage[sizeof(T)];
+
+	protected:
+		void DestroyObject() override { GetManagedObject()->~T(); }
+		void DestroyBlock() override { delete this; }
+
+	public:
+		template<typename... Args>
+		explicit TInlineControlBlock(Args&&... args)
+		{
+			new (Storage) T(std::forward<Args>(args)...);
+		}
+
+		T* GetManagedObject() { return reinterpret_cast<T*>(Storage); }
+	};
+}
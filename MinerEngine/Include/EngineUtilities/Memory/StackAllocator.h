@@ -0,0 +1,233 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "MemoryTracker.h"
+#include "VirtualArena.h"
+
+namespace EU {
+	/**
+	 * @brief Asignador de pila con marcadores para memoria temporal (importacin de modelos, etc.).
+	 *
+	 * Reservar es mover un cursor; liberar hasta un marcador devuelve de golpe todo lo reservado
+	 * despus. Free() solo retrocede el cursor si el puntero es la ltima reserva. Un std::vector
+	 * que crece pide el bloque nuevo antes de soltar el viejo, as que el viejo ya no es el ltimo
+	 * y queda como hueco hasta el siguiente FreeToMarker(): los arrays temporales deben hacer
+	 * reserve() con el tamao final antes de llenarse.
+	 *
+	 * Vive sobre una VirtualArena: las pginas confirmadas se conservan entre usos, de modo que
+	 * cargar cien modelos seguidos reutiliza la misma memoria en vez de pedirla al sistema cada vez.
+	 * Trim() las devuelve si hace falta.
+	 *
+	 * No es seguro entre hilos; cada hilo tiene la suya en GetThreadLocal().
+	 */
+	class StackAllocator
+	{
+	public:
+		using FMarker = size_t;  ///< Posicin del cursor devuelta por GetMarker().
+
+		/**
+		 * @brief Reserva por defecto: 1 GB de direcciones en 64 bits, 64 MB en 32 bits.
+		 */
+		static constexpr size_t DefaultReserveSize = sizeof(void*) == 8 ? (size_t(1) << 30) : (size_t(64) << 20);
+
+		/**
+		 * @brief Crea la pila sobre un rango virtual de ReserveSize bytes atribuido a Tag.
+		 */
+		explicit StackAllocator(size_t ReserveSize = DefaultReserveSize, MemoryTag Tag = MemoryTag::Loader)
+			: Arena(ReserveSize, Tag)
+		{
+		}
+
+		StackAllocator(const StackAllocator&) = delete;
+		StackAllocator& operator=(const StackAllocator&) = delete;
+
+		/**
+		 * @brief Pila temporal del hilo actual (creada en el primer uso).
+		 */
+		static StackAllocator& GetThreadLocal()
+		{
+			static thread_local StackAllocator Instance;
+			return Instance;
+		}
+
+		/**
+		 * @brief Reserva Size bytes alineados a Alignment en la cima de la pila.
+		 *
+		 * @return nullptr si se agota el rango reservado.
+		 */
+		void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+		{
+			const FMarker Before = Arena.GetUsed();
+			void* Memory = Arena.Allocate(Size, Alignment);
+			if (Memory != nullptr)
+			{
+				LastAllocation = Memory;
+				LastMarker = Before;
+			}
+			return Memory;
+		}
+
+		/**
+		 * @brief Libera una reserva; solo recupera memoria si es la ltima (la cima de la pila).
+		 *
+		 * Las dems se recuperan al volver a un marcador anterior a ellas.
+		 */
+		void Free(void* Memory)
+		{
+			if (Memory != nullptr && Memory == LastAllocation)
+			{
+				Arena.Rewind(LastMarker);
+				LastAllocation = nullptr;
+			}
+		}
+
+		/**
+		 * @brief Posicin actual de la cima.
+		 */
+		FMarker GetMarker() const
+		{
+			return Arena.GetUsed();
+		}
+
+		/**
+		 * @brief Libera todo lo reservado despus de Marker.
+		 */
+		void FreeToMarker(FMarker Marker)
+		{
+			Arena.Rewind(Marker);
+			LastAllocation = nullptr;
+		}
+
+		/**
+		 * @brief Devuelve al sistema las pginas por encima de la cima actual.
+		 */
+		void Trim()
+		{
+			Arena.Shrink(Arena.GetUsed());
+		}
+
+		size_t GetUsed() const { return Arena.GetUsed(); }
+		size_t GetCommitted() const { return Arena.GetCommitted(); }
+
+	private:
+		VirtualArena Arena;
+		void* LastAllocation = nullptr;  ///< ltima reserva (la nica que Free recupera).
+		FMarker LastMarker = 0;          ///< Cima antes de LastAllocation, incluido el relleno de alineacin.
+	};
+
+	/**
+	 * @brief Guarda un marcador al construirse y libera hasta l al destruirse.
+	 */
+	class FScopedStackMarker
+	{
+	public:
+		explicit FScopedStackMarker(StackAllocator& Stack = StackAllocator::GetThreadLocal())
+			: Stack(Stack), Marker(Stack.GetMarker())
+		{
+		}
+
+		~FScopedStackMarker()
+		{
+			Stack.FreeToMarker(Marker);
+		}
+
+		FScopedStackMarker(const FScopedStackMarker&) = delete;
+		FScopedStackMarker& operator=(const FScopedStackMarker&) = delete;
+
+	private:
+		StackAllocator& Stack;
+		StackAllocator::FMarker Marker;
+	};
+
+	/**
+	 * @brief Asignador compatible con la biblioteca estndar que reserva en la pila temporal del hilo.
+	 *
+	 * Los contenedores que lo usan deben destruirse antes de que su FScopedStackMarker libere la pila.
+	 *
+	 * @tparam T Tipo de los elementos.
+	 */
+	template<typename T>
+	struct TStackStdAllocator
+	{
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TStackStdAllocator<U>;
+		};
+
+		TStackStdAllocator() : Stack(&StackAllocator::GetThreadLocal()) {}
+		explicit TStackStdAllocator(StackAllocator& Stack) : Stack(&Stack) {}
+
+		template<typename U>
+		TStackStdAllocator(const TStackStdAllocator<U>& Other) : Stack(Other.Stack) {}
+
+		T* allocate(size_t Count)
+		{
+			void* Memory = Stack->Allocate(Count * sizeof(T), alignof(T));
+			if (Memory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return static_cast<T*>(Memory);
+		}
+
+		void deallocate(T* Memory, size_t)
+		{
+			Stack->Free(Memory);
+		}
+
+		template<typename U>
+		bool operator==(const TStackStdAllocator<U>& Other) const { return Stack == Other.Stack; }
+
+		template<typename U>
+		bool operator!=(const TStackStdAllocator<U>& Other) const { return Stack != Other.Stack; }
+
+		StackAllocator* Stack;  ///< Pila de la que se reserva.
+	};
+
+	// EXAMPLE
+
+	/*
+	HRESULT ImportModel(const std::string& FileName) {
+
+		FScopedStackMarker Scratch;                      // Todo lo temporal se libera al salir.
+
+		std::vector<XMFLOAT3, TStackStdAllocator<XMFLOAT3>> Positions;
+		std::vector<XMFLOAT2, TStackStdAllocator<XMFLOAT2>> TexCoords;
+		// ... leer el archivo y llenar los arrays ...
+
+		return S_OK;                                     // La siguiente carga reutiliza las mismas pginas.
+	}
+	*/
+}
@@ -0,0 +1,409 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include "../Structures/TArray.h"
+#include "../Utilities/Platform.h"
+#include "MemoryTracker.h"
+#include "TSharedPointer.h"
+#include "TUniquePtr.h"
+
+namespace EU {
+	/**
+	 * @brief Pool de bloques de tamao fijo para objetos de tipo T.
+	 *
+	 * La memoria se pide en slabs grandes alineados a lnea de cach y se reparte en bloques
+	 * contiguos, as que los objetos de un mismo tipo quedan juntos en memoria. Los bloques libres
+	 * forman una lista enlazada dentro de los propios bloques.
+	 *
+	 * Cada hilo guarda una cach local de bloques libres: reservar y liberar no toca ningn cerrojo
+	 * mientras la cach tenga bloques o espacio. Cuando se vaca o se llena, se intercambia un lote
+	 * de bloques con la lista global protegida por un mutex.
+	 *
+	 * Hay un pool por tipo (TPool<T>::Get()). Los slabs no se devuelven al sistema hasta que el pool
+	 * se destruye al cerrar el programa, por lo que ningn objeto del pool debe sobrevivir a ese punto.
+	 * Cada slab se atribuye a la etiqueta de memoria activa cuando se reserva.
+	 *
+	 * @tparam T Tipo de los objetos (define tamao y alineacin del bloque).
+	 */
+	template<typename T>
+	class TPool
+	{
+	private:
+		struct FFreeBlock
+		{
+			FFreeBlock* Next;
+		};
+
+		static constexpr size_t BlockAlignment = alignof(T) > alignof(FFreeBlock) ? alignof(T) : alignof(FFreeBlock);
+		static constexpr size_t RawBlockSize = sizeof(T) > sizeof(FFreeBlock) ? sizeof(T) : sizeof(FFreeBlock);
+		static constexpr size_t SlabAlignment = BlockAlignment > CacheLineSize ? BlockAlignment : CacheLineSize;
+
+		static constexpr uint32_t CacheCapacity = 64;  ///< Bloques mximos en la cach de un hilo.
+		static constexpr uint32_t BatchSize = 32;      ///< Bloques que se mueven de golpe entre cach y lista global.
+
+		/**
+		 * @brief Cach de bloques libres de un hilo; al terminar el hilo devuelve sus bloques al pool.
+		 */
+		struct FThreadCache
+		{
+			FFreeBlock* Head = nullptr;
+			uint32_t Count = 0;
+
+			~FThreadCache()
+			{
+				if (Head != nullptr)
+				{
+					TPool::Get().ReleaseBatch(Head, Count);
+					// Los bloques ya son de la lista global: que ningn uso posterior los vuelva a soltar.
+					Head = nullptr;
+					Count = 0;
+				}
+			}
+		};
+
+	public:
+		static constexpr size_t BlockSize = (RawBlockSize + BlockAlignment - 1) & ~(BlockAlignment - 1);  ///< Tamao de cada bloque.
+		static constexpr size_t SlabSize = BlockSize * 256 > 64 * 1024 ? BlockSize * 256 : 64 * 1024;    ///< Bytes por slab.
+		static constexpr size_t BlocksPerSlab = SlabSize / BlockSize;                                   ///< Bloques por slab.
+
+		TPool() = default;
+
+		~TPool()
+		{
+			for (void* Slab : Slabs)
+			{
+				TaggedMemory::Free(Slab);
+			}
+		}
+
+		TPool(const TPool&) = delete;
+		TPool& operator=(const TPool&) = delete;
+
+		/**
+		 * @brief Pool compartido de todos los T.
+		 */
+		static TPool& Get()
+		{
+			static TPool Instance;
+			return Instance;
+		}
+
+		/**
+		 * @brief Reserva un bloque sin construir, alineado a alignof(T).
+		 */
+		void* Allocate()
+		{
+			FThreadCache& Cache = GetThreadCache();
+			if (Cache.Head == nullptr)
+			{
+				Cache.Count = AcquireBatch(Cache.Head);
+			}
+			FFreeBlock* Block = Cache.Head;
+			Cache.Head = Block->Next;
+			--Cache.Count;
+			return Block;
+		}
+
+		/**
+		 * @brief Devuelve un bloque obtenido con Allocate (desde cualquier hilo).
+		 */
+		void Deallocate(void* Memory)
+		{
+			if (Memory == nullptr)
+			{
+				return;
+			}
+			FThreadCache& Cache = GetThreadCache();
+			FFreeBlock* Block = static_cast<FFreeBlock*>(Memory);
+			Block->Next = Cache.Head;
+			Cache.Head = Block;
+			if (++Cache.Count >= CacheCapacity)
+			{
+				// Devolver la mitad ms antigua: se deja la parte caliente en la cach.
+				FFreeBlock* Last = Cache.Head;
+				for (uint32_t i = 1; i < CacheCapacity - BatchSize; ++i)
+				{
+					Last = Last->Next;
+				}
+				FFreeBlock* Batch = Last->Next;
+				Last->Next = nullptr;
+				Cache.Count = CacheCapacity - BatchSize;
+				ReleaseBatch(Batch, BatchSize);
+			}
+		}
+
+		/**
+		 * @brief Reserva un bloque y construye un T en l.
+		 */
+		template<typename... Args>
+		T* New(Args&&... args)
+		{
+			void* Memory = Allocate();
+			try
+			{
+				return ::new (Memory) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				Deallocate(Memory);
+				throw;
+			}
+		}
+
+		/**
+		 * @brief Destruye un objeto creado con New y devuelve su bloque.
+		 */
+		void Delete(T* Object)
+		{
+			if (Object != nullptr)
+			{
+				Object->~T();
+				Deallocate(Object);
+			}
+		}
+
+		/**
+		 * @brief Nmero de slabs reservados hasta ahora.
+		 */
+		size_t GetNumSlabs() const
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			return Slabs.Num();
+		}
+
+	private:
+		static FThreadCache& GetThreadCache()
+		{
+			static thread_local FThreadCache Cache;
+			return Cache;
+		}
+
+		/**
+		 * @brief Saca hasta BatchSize bloques de la lista global (o de un slab nuevo).
+		 * @return Nmero de bloques enlazados desde OutHead (al menos uno).
+		 */
+		uint32_t AcquireBatch(FFreeBlock*& OutHead)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			FFreeBlock* Head = nullptr;
+			uint32_t Count = 0;
+			while (Count < BatchSize && FreeList != nullptr)
+			{
+				FFreeBlock* Block = FreeList;
+				FreeList = Block->Next;
+				Block->Next = Head;
+				Head = Block;
+				++Count;
+			}
+			if (Count < BatchSize)
+			{
+				if (SlabCursor == SlabEnd)
+				{
+					void* Slab = TaggedMemory::Allocate(SlabSize, SlabAlignment);
+					Slabs.Add(Slab);
+					SlabCursor = static_cast<uint8_t*>(Slab);
+					SlabEnd = SlabCursor + BlocksPerSlab * BlockSize;
+				}
+				// Los bloques nuevos se enlazan en orden descendente para que la cach los entregue
+				// en orden ascendente de direccin.
+				uint32_t Fresh = BatchSize - Count;
+				const uint32_t Remaining = static_cast<uint32_t>((SlabEnd - SlabCursor) / BlockSize);
+				Fresh = Fresh < Remaining ? Fresh : Remaining;
+				for (uint32_t i = Fresh; i > 0; --i)
+				{
+					FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(SlabCursor + (i - 1) * BlockSize);
+					Block->Next = Head;
+					Head = Block;
+				}
+				SlabCursor += Fresh * BlockSize;
+				Count += Fresh;
+			}
+			OutHead = Head;
+			return Count;
+		}
+
+		/**
+		 * @brief Devuelve a la lista global una cadena de Count bloques.
+		 */
+		void ReleaseBatch(FFreeBlock* Head, uint32_t Count)
+		{
+			FFreeBlock* Tail = Head;
+			for (uint32_t i = 1; i < Count; ++i)
+			{
+				Tail = Tail->Next;
+			}
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Tail->Next = FreeList;
+			FreeList = Head;
+		}
+
+		mutable std::mutex Mutex;           ///< Protege FreeList, el slab actual y Slabs.
+		FFreeBlock* FreeList = nullptr;     ///< Bloques libres compartidos entre hilos.
+		uint8_t* SlabCursor = nullptr;      ///< Siguiente bloque sin usar del slab actual.
+		uint8_t* SlabEnd = nullptr;         ///< Fin del slab actual.
+		TArray<void*> Slabs;                ///< Todos los slabs reservados.
+	};
+
+	/**
+	 * @brief Base CRTP que hace que new/delete de Derived usen TPool<Derived>.
+	 *
+	 * Sirve tambin para objetos con recuento intrusivo (TRefCounted): su "delete this" llega al
+	 * operator delete de la clase ms derivada. Una subclase de Derived con otro tamao vuelve al
+	 * heap global.
+	 *
+	 * @tparam Derived La clase que hereda de TPoolAllocated<Derived>.
+	 */
+	template<typename Derived>
+	class TPoolAllocated
+	{
+	public:
+		static void* operator new(size_t Size)
+		{
+			if (Size != sizeof(Derived))
+			{
+				return ::operator new(Size);
+			}
+			return TPool<Derived>::Get().Allocate();
+		}
+
+		static void operator delete(void* Memory, size_t Size)
+		{
+			if (Size != sizeof(Derived))
+			{
+				::operator delete(Memory);
+				return;
+			}
+			TPool<Derived>::Get().Deallocate(Memory);
+		}
+
+		/**
+		 * @brief Placement new: declarar operator new en la clase oculta el global.
+		 */
+		static void* operator new(size_t, void* Place) noexcept
+		{
+			return Place;
+		}
+
+		static void operator delete(void*, void*) noexcept {}
+	};
+
+	/**
+	 * @brief Bloque de control de MakePooledShared: objeto y contadores en un bloque de TPool.
+	 */
+	template<typename T, RefCountMode Mode>
+	class TPooledControlBlock : public TControlBlock<Mode>
+	{
+	private:
+		alignas(T) unsigned char Storage[sizeof(T)];
+
+	protected:
+		void DestroyObject() override { GetManagedObject()->~T(); }
+		void DestroyBlock() override { TPool<TPooledControlBlock>::Get().Delete(this); }
+
+	public:
+		template<typename... Args>
+		explicit TPooledControlBlock(Args&&... args)
+		{
+			new (Storage) T(std::forward<Args>(args)...);
+		}
+
+		T* GetManagedObject() { return reinterpret_cast<T*>(Storage); }
+	};
+
+	/**
+	 * @brief Como MakeShared, pero el bloque (objeto + contadores) sale de un TPool.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Seguridad entre hilos del recuento (atmico por defecto).
+	 * @param args Argumentos del constructor del objeto gestionado.
+	 * @return Un TSharedPointer que gestiona el nuevo objeto.
+	 */
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename... Args>
+	TSharedPointer<T, Mode> MakePooledShared(Args&&... args)
+	{
+		TPooledControlBlock<T, Mode>* block =
+			TPool<TPooledControlBlock<T, Mode>>::Get().New(std::forward<Args>(args)...);
+		return TSharedPointer<T, Mode>(block->GetManagedObject(), block);
+	}
+
+	/**
+	 * @brief Borrador de TUniquePtr que destruye el objeto y devuelve su bloque a TPool<T>.
+	 *
+	 * No tiene estado (el pool es nico por tipo), as que TUniquePtr<T, TPoolDelete<T>> ocupa
+	 * lo mismo que un puntero.
+	 */
+	template<typename T>
+	struct TPoolDelete
+	{
+		void operator()(T* Object) const
+		{
+			TPool<T>::Get().Delete(Object);
+		}
+	};
+
+	/**
+	 * @brief Como MakeUnique, pero el objeto sale de TPool<T> y vuelve a l al destruirse.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @param args Argumentos del constructor del objeto gestionado.
+	 * @return Un TUniquePtr con borrador TPoolDelete<T>.
+	 */
+	template<typename T, typename... Args>
+	TUniquePtr<T, TPoolDelete<T>> MakePooledUnique(Args&&... args)
+	{
+		return TUniquePtr<T, TPoolDelete<T>>(TPool<T>::Get().New(std::forward<Args>(args)...));
+	}
+
+	// EXAMPLE
+
+	/*
+	class Particle : public TRefCounted<>, public TPoolAllocated<Particle>
+	{
+	public:
+		float Position[3];
+	};
+
+	int main() {
+
+		TRefPtr<Particle> A = MakeRef<Particle>();            // Bloque de TPool<Particle>.
+		TRefPtr<Particle> B = MakeRef<Particle>();            // Normalmente el bloque contiguo.
+
+		TSharedPointer<Vector3> V = MakePooledShared<Vector3>(1.0f, 2.0f, 3.0f);
+		TUniquePtr<Vector3, TPoolDelete<Vector3>> U = MakePooledUnique<Vector3>(4.0f, 5.0f, 6.0f);
+
+		std::cout << TPool<Particle>::Get().GetNumSlabs() << std::endl;  // 1
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "RefCount.h"
+
+namespace EU {
+	/**
+	 * @brief Clase base para objetos con recuento de referencias intrusivo.
+	 *
+	 * El contador vive dentro del propio objeto, as que compartirlo mediante TRefPtr no
+	 * necesita un bloque de control aparte: una reserva por objeto y ningn salto de puntero
+	 * extra al copiar. El objeto se destruye (delete this) cuando se libera la ltima referencia,
+	 * por lo que debe crearse con new o MakeRef, nunca en la pila.
+	 *
+	 * Un objeto recin creado tiene el recuento a cero; el primer TRefPtr que lo recibe lo sube a uno.
+	 *
+	 * @tparam Mode Seguridad entre hilos del recuento (atmico por defecto).
+	 */
+	template<RefCountMode Mode = RefCountMode::ThreadSafe>
+	class TRefCounted
+	{
+	public:
+		/**
+		 * @brief Aade una referencia.
+		 */
+		void AddRef() const
+		{
+			RefCount.Increment();
+		}
+
+		/**
+		 * @brief Libera una referencia y destruye el objeto si era la ltima.
+		 */
+		void Release() const
+		{
+			if (RefCount.Decrement() == 0)
+			{
+				delete this;
+			}
+		}
+
+		/**
+		 * @brief Nmero de referencias actuales (orientativo entre hilos).
+		 */
+		int32_t GetRefCount() const
+		{
+			return RefCount.Load();
+		}
+
+	protected:
+		TRefCounted() : RefCount(0) {}
+
+		/**
+		 * @brief Una copia es un objeto nuevo: no hereda las referencias del original.
+		 */
+		TRefCounted(const TRefCounted&) : RefCount(0) {}
+		TRefCounted& operator=(const TRefCounted&) { return *this; }
+
+		virtual ~TRefCounted() = default;
+
+	private:
+		mutable TRefCounter<Mode> RefCount;  ///< Referencias de TRefPtr vivas.
+	};
+}
@@ -0,0 +1,197 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "TRefCounted.h"
+
+namespace EU {
+	/**
+	 * @brief Puntero inteligente para objetos con recuento de referencias intrusivo.
+	 *
+	 * Funciona con cualquier tipo que exponga AddRef() y Release(): clases derivadas de
+	 * TRefCounted y tambin interfaces COM de Direct3D. A diferencia de TSharedPointer no
+	 * hay bloque de control: el puntero ocupa lo mismo que un puntero crudo y copiarlo solo
+	 * toca el contador dentro del objeto.
+	 *
+	 * @tparam T Tipo del objeto referenciado.
+	 */
+	template<typename T>
+	class TRefPtr
+	{
+	public:
+		/**
+		 * @brief Constructor por defecto (puntero nulo).
+		 */
+		TRefPtr() : ptr(nullptr) {}
+
+		TRefPtr(std::nullptr_t) : ptr(nullptr) {}
+
+		/**
+		 * @brief Toma una referencia sobre un objeto.
+		 *
+		 * Es seguro construir varios TRefPtr desde el mismo puntero crudo: el recuento est en el objeto.
+		 *
+		 * @param rawPtr Puntero al objeto (puede ser nulo).
+		 */
+		TRefPtr(T* rawPtr) : ptr(rawPtr)
+		{
+			if (ptr)
+			{
+				ptr->AddRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TRefPtr(const TRefPtr& other) : TRefPtr(other.ptr) {}
+
+		/**
+		 * @brief Constructor de conversin desde un puntero a un tipo derivado.
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		TRefPtr(const TRefPtr<U>& other) : TRefPtr(other.get()) {}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TRefPtr(TRefPtr&& other) noexcept : ptr(other.ptr)
+		{
+			other.ptr = nullptr;
+		}
+
+		/**
+		 * @brief Destructor. Libera la referencia.
+		 */
+		~TRefPtr()
+		{
+			if (ptr)
+			{
+				ptr->Release();
+			}
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TRefPtr& operator=(const TRefPtr& other)
+		{
+			TRefPtr(other).swap(*this);
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TRefPtr& operator=(TRefPtr&& other) noexcept
+		{
+			TRefPtr(std::move(other)).swap(*this);
+			return *this;
+		}
+
+		T& operator*() const { return *ptr; }
+		T* operator->() const { return ptr; }
+		operator bool() const { return ptr != nullptr; }
+
+		/**
+		 * @brief Obtener el puntero crudo.
+		 */
+		T* get() const { return ptr; }
+
+		/**
+		 * @brief Comprobar si el puntero es nulo.
+		 */
+		bool isNull() const { return ptr == nullptr; }
+
+		/**
+		 * @brief Libera el objeto actual y opcionalmente referencia otro.
+		 */
+		void reset(T* newPtr = nullptr)
+		{
+			TRefPtr(newPtr).swap(*this);
+		}
+
+		/**
+		 * @brief Intercambia los punteros de dos TRefPtr.
+		 */
+		void swap(TRefPtr& other) noexcept
+		{
+			std::swap(ptr, other.ptr);
+		}
+
+		/**
+		 * @brief Cast dinmico; comparte el mismo objeto (y su recuento) si la conversin es vlida.
+		 */
+		template<typename U>
+		TRefPtr<U> dynamic_pointer_cast() const
+		{
+			return TRefPtr<U>(dynamic_cast<U*>(ptr));
+		}
+
+	private:
+		T* ptr;  ///< Objeto referenciado.
+	};
+
+	/**
+	 * @brief Crea un objeto con recuento intrusivo y devuelve la primera referencia.
+	 *
+	 * @tparam T Tipo del objeto (derivado de TRefCounted).
+	 * @param args Argumentos reenviados al constructor.
+	 */
+	template<typename T, typename... Args>
+	TRefPtr<T> MakeRef(Args&&... args)
+	{
+		return TRefPtr<T>(new T(std::forward<Args>(args)...));
+	}
+
+	// EXAMPLE
+
+	/*
+	class Texture : public TRefCounted<>
+	{
+	public:
+		explicit Texture(int Width) : Width(Width) {}
+		int Width;
+	};
+
+	int main() {
+
+		TRefPtr<Texture> A = MakeRef<Texture>(512);   // Una sola reserva.
+		TRefPtr<Texture> B = A;                       // Solo incrementa el contador del objeto.
+		std::cout << A->GetRefCount() << std::endl;   // 2
+
+		B.reset();
+		std::cout << A->GetRefCount() << std::endl;   // 1
+
+		return 0;
+	}
+	*/
+}
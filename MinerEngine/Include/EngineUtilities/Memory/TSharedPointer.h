@@ -27,6 +27,9 @@
  * SOFTWARE.
 */
 #pragma once
+#include <type_traits>
+#include <utility>
+#include "RefCount.h"
 
 namespace EU {
 	/**
@@ -35,123 +38,119 @@ namespace EU {
 	 * La clase TSharedPointer gestiona la memoria de un objeto de tipo T y lleva un
 	 * recuento de referencias para permitir la comparticin segura de un mismo objeto
 	 * en mltiples instancias de TSharedPointer.
+	 *
+	 * El recuento vive en un bloque de control (TControlBlock) con contadores fuerte y dbil.
+	 * MakeShared coloca el objeto dentro del propio bloque, de modo que crear un objeto compartido
+	 * cuesta una sola reserva. Por defecto los contadores son atmicos; con
+	 * RefCountMode::NotThreadSafe se usan enteros normales para objetos de un solo hilo.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Seguridad entre hilos del recuento.
 	 */
-	template<typename T>
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 	class TSharedPointer
 	{
 	public:
 		/**
 		 * @brief Constructor por defecto.
 		 *
-		 * Inicializa el puntero y el recuento de referencias a nullptr.
+		 * Inicializa el puntero y el bloque de control a nullptr.
 		 */
-		TSharedPointer() : ptr(nullptr), refCount(nullptr) {}
+		TSharedPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un puntero crudo.
 		 *
+		 * Reserva un bloque de control aparte; preferir MakeShared, que hace una sola reserva.
+		 *
 		 * @param rawPtr Puntero crudo al objeto que se va a gestionar.
 		 */
-		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
+		explicit TSharedPointer(T* rawPtr)
+			: ptr(rawPtr)
+			, controlBlock(rawPtr ? new TPointerControlBlock<T, Mode>(rawPtr) : nullptr) {}
 
 		/**
-		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
+		 * @brief Constructor de copia.
 		 *
-		 * @param rawPtr Puntero crudo al objeto gestionado.
-		 * @param existingRefCount Puntero al recuento de referencias existente.
+		 * Copia el puntero y el bloque de control del otro TSharedPointer y
+		 * aumenta el recuento de referencias.
+		 *
+		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
+		TSharedPointer(const TSharedPointer& other) : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->AddStrong();
 			}
 		}
 
 		/**
-		 * @brief Constructor de copia.
+		 * @brief Constructor de conversin desde un puntero a un tipo derivado.
 		 *
-		 * Copia el puntero y el recuento de referencias del otro TSharedPointer y
-		 * aumenta el recuento de referencias.
-		 *
-		 * @param other Otro objeto TSharedPointer del mismo tipo T.
+		 * @param other TSharedPointer a un tipo U convertible a T.
 		 */
-		TSharedPointer(const TSharedPointer<T>& other) : ptr(other.ptr), refCount(other.refCount)
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		TSharedPointer(const TSharedPointer<U, Mode>& other) : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->AddStrong();
 			}
 		}
 
 		/**
 		 * @brief Constructor de movimiento.
 		 *
-		 * Transfiere la propiedad del puntero y el recuento de referencias del otro
+		 * Transfiere la propiedad del puntero y el bloque de control del otro
 		 * TSharedPointer al nuevo objeto TSharedPointer.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(TSharedPointer<T>&& other) noexcept : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(TSharedPointer&& other) noexcept : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
 			other.ptr = nullptr;
-			other.refCount = nullptr;
+			other.controlBlock = nullptr;
 		}
 
 		/**
 		 * @brief Operador de asignacin de copia.
 		 *
-		 * Libera el objeto actual, copia el puntero y el recuento de referencias del otro
-		 * TSharedPointer, y aumenta el recuento de referencias.
+		 * Incrementa antes de liberar, por lo que asignarse a s mismo es seguro.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(const TSharedPointer<T>& other)
+		TSharedPointer& operator=(const TSharedPointer& other)
 		{
-			if (this != &other)
+			if (other.controlBlock)
 			{
-				// Disminuir el recuento de referencias del objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
-				// Copiar datos del otro puntero compartido
-				ptr = other.ptr;
-				refCount = other.refCount;
-				if (refCount)
-				{
-					++(*refCount);
-				}
+				other.controlBlock->AddStrong();
 			}
+			release();
+			ptr = other.ptr;
+			controlBlock = other.controlBlock;
 			return *this;
 		}
 
 		/**
 		 * @brief Operador de asignacin de movimiento.
 		 *
-		 * Libera el objeto actual, transfiere la propiedad del puntero y el recuento de
-		 * referencias del otro TSharedPointer al actual.
+		 * Libera el objeto actual, transfiere la propiedad del puntero y el bloque de control
+		 * del otro TSharedPointer al actual.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(TSharedPointer<T>&& other) noexcept
+		TSharedPointer& operator=(TSharedPointer&& other) noexcept
 		{
 			if (this != &other)
 			{
-				// Liberar el objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
-				// Transferir los datos del otro puntero compartido
+				release();
 				ptr = other.ptr;
-				refCount = other.refCount;
+				controlBlock = other.controlBlock;
 				other.ptr = nullptr;
-				other.refCount = nullptr;
+				other.controlBlock = nullptr;
 			}
 			return *this;
 		}
@@ -159,16 +158,12 @@ namespace EU {
 		/**
 		 * @brief Destructor.
 		 *
-		 * Disminuye el recuento de referencias y libera la memoria del objeto
-		 * gestionado si el recuento de referencias llega a cero.
+		 * Disminuye el recuento de referencias; el bloque de control destruye el objeto
+		 * cuando llega a cero.
 		 */
 		~TSharedPointer()
 		{
-			if (refCount && --(*refCount) == 0)
-			{
-				delete ptr;
-				delete refCount;
-			}
+			release();
 		}
 
 		/**
@@ -204,10 +199,10 @@ namespace EU {
 		 */
 		bool isNull() const { return ptr == nullptr; }
 
-
-	public:
-		T* ptr;       ///< Puntero al objeto gestionado.
-		int* refCount; ///< Puntero al recuento de referencias.
+		/**
+		 * @brief Nmero de TSharedPointer que comparten el objeto (orientativo entre hilos).
+		 */
+		int32_t useCount() const { return controlBlock ? controlBlock->GetStrongCount() : 0; }
 
 		/**
 		 * @brief Mtodo swap.
@@ -216,74 +211,90 @@ namespace EU {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		void swap(TSharedPointer<T>& other) noexcept
+		void swap(TSharedPointer& other) noexcept
 		{
-			T* tempPtr = other.ptr;
-			int* tempRefCount = other.refCount;
-
-			other.ptr = this->ptr;
-			other.refCount = this->refCount;
-
-			this->ptr = tempPtr;
-			this->refCount = tempRefCount;
+			std::swap(ptr, other.ptr);
+			std::swap(controlBlock, other.controlBlock);
 		}
 
 		/**
-				 * @brief Libera el objeto actual y opcionalmente asigna un nuevo objeto.
-				 *
-				 * @param newPtr Nuevo puntero crudo al objeto que se va a gestionar (por defecto es nullptr).
-				 */
+		 * @brief Libera el objeto actual y opcionalmente asigna un nuevo objeto.
+		 *
+		 * @param newPtr Nuevo puntero crudo al objeto que se va a gestionar (por defecto es nullptr).
+		 */
 		void reset(T* newPtr = nullptr)
 		{
-			// Disminuir el recuento de referencias del objeto actual
-			if (refCount && --(*refCount) == 0)
-			{
-				delete ptr;
-				delete refCount;
-			}
-
-			// Si newPtr es nullptr, asignar nullptr al puntero y recuento de referencias
-			if (newPtr == nullptr)
-			{
-				ptr = nullptr;
-				refCount = nullptr;
-			}
-			else
-			{
-				// Asignar nuevo objeto y manejar el recuento de referencias
-				ptr = newPtr;
-				refCount = new int(1);
-			}
+			TSharedPointer(newPtr).swap(*this);
 		}
 
 		// Mtodo de conversin para hacer cast dinmico
 		template<typename U>
-		TSharedPointer<U> dynamic_pointer_cast() const {
+		TSharedPointer<U, Mode> dynamic_pointer_cast() const {
 			// Intenta convertir el puntero de tipo T a U
 			U* castedPtr = dynamic_cast<U*>(ptr);
 			if (castedPtr) {
-				// Si la conversin es exitosa, devuelve un nuevo TSharedPointer<U>
-				return TSharedPointer<U>(castedPtr, refCount);
+				// Si la conversin es exitosa, comparte el mismo bloque de control
+				controlBlock->AddStrong();
+				return TSharedPointer<U, Mode>(castedPtr, controlBlock);
 			}
 			else {
 				// Si falla la conversin, devuelve un TSharedPointer<U> nulo
-				return TSharedPointer<U>();
+				return TSharedPointer<U, Mode>();
 			}
 		}
+
+	private:
+		T* ptr;                             ///< Puntero al objeto gestionado.
+		TControlBlock<Mode>* controlBlock;  ///< Bloque de control compartido (nullptr si est vaco).
+
+		/**
+		 * @brief Adopta un bloque cuya referencia fuerte ya se ha contado (MakeShared, casts, lock).
+		 */
+		TSharedPointer(T* rawPtr, TControlBlock<Mode>* adoptedBlock) : ptr(rawPtr), controlBlock(adoptedBlock) {}
+
+		void release()
+		{
+			if (controlBlock)
+			{
+				controlBlock->ReleaseStrong();
+			}
+		}
+
+		template<typename U, RefCountMode OtherMode>
+		friend class TSharedPointer;
+
+		template<typename U, RefCountMode OtherMode>
+		friend class TWeakPointer;
+
+		template<typename U, RefCountMode OtherMode, typename... Args>
+		friend TSharedPointer<U, OtherMode> MakeShared(Args&&... args);
+
+		template<typename U, RefCountMode OtherMode, typename... Args>
+		friend TSharedPointer<U, OtherMode> MakePooledShared(Args&&... args);
 	};
 
+	/**
+	 * @brief Alias para el puntero compartido no atmico (objetos de un solo hilo).
+	 */
+	template<typename T>
+	using TLocalSharedPointer = TSharedPointer<T, RefCountMode::NotThreadSafe>;
+
 	/**
 	 * @brief Funcin de utilidad para crear un TSharedPointer.
 	 *
+	 * Reserva el bloque de control y el objeto juntos y reenva los argumentos al constructor
+	 * (las referencias siguen siendo referencias, sin copias intermedias).
+	 *
 	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Seguridad entre hilos del recuento (atmico por defecto).
 	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
 	 * @param args Argumentos del constructor del objeto gestionado.
 	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
 	 */
-	template<typename T, typename... Args>
-	TSharedPointer<T> MakeShared(Args... args)
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename... Args>
+	TSharedPointer<T, Mode> MakeShared(Args&&... args)
 	{
-		return TSharedPointer<T>(new T(args...));
+		TInlineControlBlock<T, Mode>* block = new TInlineControlBlock<T, Mode>(std::forward<Args>(args)...);
+		return TSharedPointer<T, Mode>(block->GetManagedObject(), block);
 	}
 }
-
@@ -27,16 +27,147 @@
  * SOFTWARE.
 */
 #pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace EU {
+  /**
+   * @brief Borrador por defecto de TUniquePtr: libera el objeto con delete.
+   *
+   * No tiene estado, as que TUniquePtr lo guarda como base vaca y no ocupa memoria.
+   *
+   * @tparam T Tipo del objeto gestionado.
+   */
+  template<typename T>
+  struct TDefaultDelete {
+    constexpr TDefaultDelete() noexcept = default;
+
+    /**
+     * @brief Permite convertir TUniquePtr<Derived> en TUniquePtr<Base>.
+     */
+    template<typename U,
+             typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    TDefaultDelete(const TDefaultDelete<U>&) noexcept {}
+
+    void
+      operator()(T* rawPtr) const {
+      static_assert(sizeof(T) > 0, "TDefaultDelete no puede borrar un tipo incompleto.");
+      delete rawPtr;
+    }
+  };
+
+  /**
+   * @brief Borrador por defecto para arreglos: libera el bloque con delete[].
+   */
+  template<typename T>
+  struct TDefaultDelete<T[]> {
+    void
+      operator()(T* rawPtr) const {
+      static_assert(sizeof(T) > 0, "TDefaultDelete no puede borrar un tipo incompleto.");
+      delete[] rawPtr;
+    }
+  };
+
+  /**
+   * @brief Borrador que solo llama al destructor, sin liberar memoria.
+   *
+   * Para objetos construidos dentro de memoria que libera otro (FrameArena, VirtualArena,
+   * StackAllocator): el arena recupera la memoria en bloque al reiniciarse o rebobinarse.
+   */
+  template<typename T>
+  struct TDestructOnly {
+    void
+      operator()(T* rawPtr) const {
+      rawPtr->~T();
+    }
+  };
+
+  /**
+   * @brief Borrador para interfaces COM (ID3D11*, ID3DBlob...): llama a Release().
+   *
+   * Equivale a SAFE_RELEASE, pero se ejecuta en todos los caminos de salida de la funcin.
+   */
+  template<typename T>
+  struct TComRelease {
+    void
+      operator()(T* rawPtr) const {
+      rawPtr->Release();
+    }
+  };
+
+  /**
+   * @brief Almacenamiento de TUniquePtr: puntero y borrador.
+   *
+   * Si el borrador es una clase vaca (y no final) se hereda de l, de modo que la
+   * optimizacin de base vaca lo deja sin tamao y TUniquePtr ocupa lo mismo que un T*.
+   * Si tiene estado (por ejemplo un puntero a su pool) se guarda como miembro.
+   */
+  template<typename T,
+           typename Deleter,
+           bool bEmptyBase = std::is_empty<Deleter>::value && !std::is_final<Deleter>::value>
+  class TUniquePtrStorage : private Deleter {
+  public:
+    TUniquePtrStorage() noexcept : Deleter(), ptr(nullptr) {}
+
+    template<typename D>
+    TUniquePtrStorage(T* rawPtr, D&& deleter) noexcept
+      : Deleter(std::forward<D>(deleter)), ptr(rawPtr) {}
+
+    Deleter&
+      getDeleter() noexcept {
+      return *this;
+    }
+
+    const Deleter&
+      getDeleter() const noexcept {
+      return *this;
+    }
+
+    T* ptr; ///< Puntero al objeto gestionado.
+  };
+
+  template<typename T, typename Deleter>
+  class TUniquePtrStorage<T, Deleter, false> {
+  public:
+    TUniquePtrStorage() noexcept : ptr(nullptr), deleter() {}
+
+    template<typename D>
+    TUniquePtrStorage(T* rawPtr, D&& deleter) noexcept
+      : ptr(rawPtr), deleter(std::forward<D>(deleter)) {}
+
+    Deleter&
+      getDeleter() noexcept {
+      return deleter;
+    }
+
+    const Deleter&
+      getDeleter() const noexcept {
+      return deleter;
+    }
+
+    T* ptr; ///< Puntero al objeto gestionado.
+
+  private:
+    Deleter deleter; ///< Borrador con estado.
+  };
+
   /**
  * @brief Clase TUniquePtr para manejo exclusivo de memoria.
  *
  * La clase TUniquePtr gestiona la memoria de un objeto de tipo T y garantiza
  * que solo una instancia de TUniquePtr puede poseer y gestionar el objeto en
  * cualquier momento.
+ *
+ * El borrador decide cmo se libera el objeto: delete (por defecto), devolverlo a un
+ * TPool (TPoolDelete), solo destruirlo porque la memoria es de un arena (TDestructOnly)
+ * o llamar a Release() en una interfaz COM (TComRelease). Con un borrador sin estado
+ * sizeof(TUniquePtr<T>) == sizeof(T*).
+ *
+ * @tparam T Tipo del objeto gestionado.
+ * @tparam Deleter Functor que libera el objeto.
  */
-  template<typename T>
+  template<typename T, typename Deleter = TDefaultDelete<T>>
   class TUniquePtr {
   public:
     /**
@@ -44,14 +175,27 @@ namespace EU {
      *
      * Inicializa el puntero a nullptr.
      */
-    TUniquePtr() : ptr(nullptr) {}
+    TUniquePtr() noexcept = default;
+
+    /**
+     * @brief Constructor a partir de nullptr.
+     */
+    TUniquePtr(std::nullptr_t) noexcept {}
 
     /**
      * @brief Constructor que toma un puntero crudo.
      *
      * @param rawPtr Puntero crudo al objeto que se va a gestionar.
      */
-    explicit TUniquePtr(T* rawPtr) : ptr(rawPtr) {}
+    explicit TUniquePtr(T* rawPtr) noexcept : storage(rawPtr, Deleter()) {}
+
+    /**
+     * @brief Constructor con un puntero crudo y un borrador con estado.
+     *
+     * @param rawPtr Puntero crudo al objeto que se va a gestionar.
+     * @param deleter Borrador que liberar el objeto.
+     */
+    TUniquePtr(T* rawPtr, const Deleter& deleter) noexcept : storage(rawPtr, deleter) {}
 
     /**
      * @brief Constructor de movimiento.
@@ -60,9 +204,20 @@ namespace EU {
      *
      * @param other Otro objeto TUniquePtr del mismo tipo T.
      */
-    TUniquePtr(TUniquePtr<T>&& other) noexcept : ptr(other.ptr) {
-      other.ptr = nullptr;
-    }
+    TUniquePtr(TUniquePtr&& other) noexcept
+      : storage(other.release(), std::move(other.getDeleter())) {}
+
+    /**
+     * @brief Constructor de movimiento desde un tipo derivado.
+     *
+     * @param other TUniquePtr<U> con U* convertible a T*.
+     */
+    template<typename U,
+             typename E,
+             typename = std::enable_if_t<std::is_convertible<U*, T*>::value &&
+                                         !std::is_array<U>::value>>
+    TUniquePtr(TUniquePtr<U, E>&& other) noexcept
+      : storage(other.release(), std::forward<E>(other.getDeleter())) {}
 
     /**
      * @brief Operador de asignacin de movimiento.
@@ -73,31 +228,52 @@ namespace EU {
      * @param other Otro objeto TUniquePtr del mismo tipo T.
      * @return Referencia al objeto TUniquePtr actual.
      */
-    TUniquePtr<T>&
-      operator=(TUniquePtr<T>&& other) noexcept {
+    TUniquePtr&
+      operator=(TUniquePtr&& other) noexcept {
       if (this != &other) {
-        // Liberar el objeto actual
-        delete ptr;
-
-        // Transferir los datos del otro puntero exclusivo
-        ptr = other.ptr;
-        other.ptr = nullptr;
+        reset(other.release());
+        storage.getDeleter() = std::move(other.getDeleter());
       }
       return *this;
     }
 
+    /**
+     * @brief Asignacin de movimiento desde un tipo derivado.
+     */
+    template<typename U,
+             typename E,
+             typename = std::enable_if_t<std::is_convertible<U*, T*>::value &&
+                                         !std::is_array<U>::value>>
+    TUniquePtr&
+      operator=(TUniquePtr<U, E>&& other) noexcept {
+      reset(other.release());
+      storage.getDeleter() = std::forward<E>(other.getDeleter());
+      return *this;
+    }
+
+    /**
+     * @brief Asignar nullptr libera el objeto actual.
+     */
+    TUniquePtr&
+      operator=(std::nullptr_t) noexcept {
+      reset();
+      return *this;
+    }
+
     /**
      * @brief Destructor.
      *
      * Libera la memoria del objeto gestionado.
      */
     ~TUniquePtr() {
-      delete ptr;
+      if (storage.ptr) {
+        storage.getDeleter()(storage.ptr);
+      }
     }
 
     // Prohibir la copia de TUniquePtr
-    TUniquePtr(const TUniquePtr<T>&) = delete;
-    TUniquePtr<T>& operator=(const TUniquePtr<T>&) = delete;
+    TUniquePtr(const TUniquePtr&) = delete;
+    TUniquePtr& operator=(const TUniquePtr&) = delete;
 
     /**
      * @brief Operador de desreferenciacin.
@@ -106,7 +282,7 @@ namespace EU {
      */
     T&
       operator*() const {
-      return *ptr;
+      return *storage.ptr;
     }
 
     /**
@@ -115,8 +291,8 @@ namespace EU {
      * @return Puntero al objeto gestionado.
      */
     T*
-      operator->() const {
-      return ptr;
+      operator->() const noexcept {
+      return storage.ptr;
     }
 
     /**
@@ -125,8 +301,21 @@ namespace EU {
      * @return Puntero crudo al objeto gestionado.
      */
     T*
-      get() const {
-      return ptr;
+      get() const noexcept {
+      return storage.ptr;
+    }
+
+    /**
+     * @brief Obtener el borrador.
+     */
+    Deleter&
+      getDeleter() noexcept {
+      return storage.getDeleter();
+    }
+
+    const Deleter&
+      getDeleter() const noexcept {
+      return storage.getDeleter();
     }
 
     /**
@@ -137,9 +326,9 @@ namespace EU {
      * @return Puntero crudo al objeto gestionado.
      */
     T*
-      release() {
-      T* oldPtr = ptr;
-      ptr = nullptr;
+      release() noexcept {
+      T* oldPtr = storage.ptr;
+      storage.ptr = nullptr;
       return oldPtr;
     }
 
@@ -151,9 +340,35 @@ namespace EU {
      * @param rawPtr Puntero crudo al nuevo objeto que se va a gestionar.
      */
     void
-      reset(T* rawPtr = nullptr) {
-      delete ptr;
-      ptr = rawPtr;
+      reset(T* rawPtr = nullptr) noexcept {
+      T* oldPtr = storage.ptr;
+      storage.ptr = rawPtr;
+      if (oldPtr) {
+        storage.getDeleter()(oldPtr);
+      }
+    }
+
+    /**
+     * @brief Libera el objeto actual y devuelve la direccin del puntero interno.
+     *
+     * Pensado para parmetros de salida de las APIs COM (ID3DBlob**, ID3D11Buffer**...):
+     * la funcin escribe directamente en el TUniquePtr.
+     *
+     * @return Direccin del puntero gestionado, ya a nullptr.
+     */
+    T**
+      resetAndGetAddress() noexcept {
+      reset();
+      return &storage.ptr;
+    }
+
+    /**
+     * @brief Intercambia objeto y borrador con otro TUniquePtr.
+     */
+    void
+      swap(TUniquePtr& other) noexcept {
+      std::swap(storage.ptr, other.storage.ptr);
+      std::swap(storage.getDeleter(), other.storage.getDeleter());
     }
 
     /**
@@ -162,29 +377,165 @@ namespace EU {
      * @return true si el puntero es nulo, false en caso contrario.
      */
     bool
-      isNull() const {
-      return ptr == nullptr;
+      isNull() const noexcept {
+      return storage.ptr == nullptr;
     }
+
+    explicit operator bool() const noexcept {
+      return storage.ptr != nullptr;
+    }
+
   private:
-    T* ptr; ///< Puntero al objeto gestionado.
+    TUniquePtrStorage<T, Deleter> storage; ///< Puntero gestionado y borrador.
+  };
+
+  /**
+   * @brief Especializacin de TUniquePtr para arreglos creados con new[].
+   *
+   * Libera con delete[] y ofrece operator[] en lugar de * y ->.
+   *
+   * @tparam T Tipo de los elementos.
+   * @tparam Deleter Functor que libera el arreglo.
+   */
+  template<typename T, typename Deleter>
+  class TUniquePtr<T[], Deleter> {
+  public:
+    TUniquePtr() noexcept = default;
+
+    TUniquePtr(std::nullptr_t) noexcept {}
+
+    explicit TUniquePtr(T* rawPtr) noexcept : storage(rawPtr, Deleter()) {}
+
+    TUniquePtr(T* rawPtr, const Deleter& deleter) noexcept : storage(rawPtr, deleter) {}
+
+    TUniquePtr(TUniquePtr&& other) noexcept
+      : storage(other.release(), std::move(other.getDeleter())) {}
+
+    TUniquePtr&
+      operator=(TUniquePtr&& other) noexcept {
+      if (this != &other) {
+        reset(other.release());
+        storage.getDeleter() = std::move(other.getDeleter());
+      }
+      return *this;
+    }
+
+    TUniquePtr&
+      operator=(std::nullptr_t) noexcept {
+      reset();
+      return *this;
+    }
+
+    ~TUniquePtr() {
+      if (storage.ptr) {
+        storage.getDeleter()(storage.ptr);
+      }
+    }
+
+    TUniquePtr(const TUniquePtr&) = delete;
+    TUniquePtr& operator=(const TUniquePtr&) = delete;
+
+    /**
+     * @brief Acceso al elemento Index del arreglo gestionado.
+     */
+    T&
+      operator[](size_t Index) const {
+      return storage.ptr[Index];
+    }
+
+    T*
+      get() const noexcept {
+      return storage.ptr;
+    }
+
+    Deleter&
+      getDeleter() noexcept {
+      return storage.getDeleter();
+    }
+
+    const Deleter&
+      getDeleter() const noexcept {
+      return storage.getDeleter();
+    }
+
+    T*
+      release() noexcept {
+      T* oldPtr = storage.ptr;
+      storage.ptr = nullptr;
+      return oldPtr;
+    }
+
+    void
+      reset(T* rawPtr = nullptr) noexcept {
+      T* oldPtr = storage.ptr;
+      storage.ptr = rawPtr;
+      if (oldPtr) {
+        storage.getDeleter()(oldPtr);
+      }
+    }
+
+    void
+      swap(TUniquePtr& other) noexcept {
+      std::swap(storage.ptr, other.storage.ptr);
+      std::swap(storage.getDeleter(), other.storage.getDeleter());
+    }
+
+    bool
+      isNull() const noexcept {
+      return storage.ptr == nullptr;
+    }
+
+    explicit operator bool() const noexcept {
+      return storage.ptr != nullptr;
+    }
+
+  private:
+    TUniquePtrStorage<T, Deleter> storage; ///< Puntero al arreglo y borrador.
   };
 
+  static_assert(sizeof(TUniquePtr<int>) == sizeof(int*),
+                "TUniquePtr con borrador sin estado debe ocupar un puntero.");
+  static_assert(sizeof(TUniquePtr<int[]>) == sizeof(int*),
+                "TUniquePtr<T[]> con borrador sin estado debe ocupar un puntero.");
+
+  /**
+   * @brief Alias para punteros COM propiedad exclusiva (sustituye a SAFE_RELEASE).
+   */
+  template<typename T>
+  using TComPtr = TUniquePtr<T, TComRelease<T>>;
+
   /**
    * @brief Funcin de utilidad para crear un TUniquePtr.
    *
+   * Los argumentos se reenvan tal cual (sin copias) al constructor de T.
+   *
    * @tparam T Tipo del objeto gestionado.
    * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
    * @param args Argumentos del constructor del objeto gestionado.
    * @return Un objeto TUniquePtr gestionando un nuevo objeto de tipo T.
    */
   template<typename T, typename... Args>
-  TUniquePtr<T>
-    MakeUnique(Args... args) {
-    return TUniquePtr<T>(new T(args...));
+  std::enable_if_t<!std::is_array<T>::value, TUniquePtr<T>>
+    MakeUnique(Args&&... args) {
+    return TUniquePtr<T>(new T(std::forward<Args>(args)...));
   }
 
+  /**
+   * @brief Crea un arreglo de Count elementos inicializados por valor.
+   *
+   * @tparam T Tipo arreglo, por ejemplo MakeUnique<float[]>(256).
+   * @param Count Nmero de elementos.
+   * @return Un TUniquePtr<T[]> que gestiona el arreglo.
+   */
+  template<typename T>
+  std::enable_if_t<std::is_array<T>::value && std::extent<T>::value == 0, TUniquePtr<T>>
+    MakeUnique(size_t Count) {
+    return TUniquePtr<T>(new std::remove_extent_t<T>[Count]());
+  }
+
+  // EXAMPLE
+
   /*
-  // Ejemplo de uso de TUniquePtr
   class MyClass
   {
   public:
@@ -225,9 +576,21 @@ namespace EU {
       MyClass* rawPtr = up2.release();
       rawPtr->display();
       delete rawPtr; // Manualmente liberar la memoria ya que fue liberada del TUniquePtr
+
+      // Arreglo: se libera con delete[]
+      TUniquePtr<float[]> weights = MakeUnique<float[]>(256);
+      weights[0] = 1.0f;
+
+      // Objeto en un arena: solo se destruye, la memoria vuelve con el arena
+      void* memory = FrameArena::Get().Allocate(sizeof(MyClass), alignof(MyClass));
+      TUniquePtr<MyClass, TDestructOnly<MyClass>> temp(new (memory) MyClass(30));
+
+      // Interfaz COM: Release() automtico en cualquier salida
+      TComPtr<ID3DBlob> errorBlob;
+      D3DCompile(..., errorBlob.resetAndGetAddress());
     } // Aqu, up1 y up2 se destruyen y la memoria de MyClass se libera automticamente si no fue liberada antes
 
     return 0;
   }
   */
-}
\ No newline at end of file
+}
@@ -38,43 +38,144 @@ namespace
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * an existe.
 		 */
-	template<typename T>
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 	class TWeakPointer {
 	public:
 		/**
 		 * @brief Constructor por defecto.
 		 */
-		TWeakPointer() : ptr(nullptr), refCount(nullptr) {}
+		TWeakPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
+		 * Incrementa el recuento dbil: el bloque de control sigue vivo mientras exista
+		 * este TWeakPointer, aunque el objeto se destruya.
+		 *
 		 * @param sharedPtr TSharedPointer desde el cual se observar el objeto.
 		 */
-		TWeakPointer(const TSharedPointer<T>& sharedPtr)
-			: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {
+		TWeakPointer(const TSharedPointer<T, Mode>& sharedPtr)
+			: ptr(sharedPtr.ptr), controlBlock(sharedPtr.controlBlock) {
+			if (controlBlock) {
+				controlBlock->AddWeak();
+			}
+		}
+
+		/**
+		 * @brief Constructor desde un TSharedPointer a un tipo derivado.
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		TWeakPointer(const TSharedPointer<U, Mode>& sharedPtr)
+			: ptr(sharedPtr.ptr), controlBlock(sharedPtr.controlBlock) {
+			if (controlBlock) {
+				controlBlock->AddWeak();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TWeakPointer(const TWeakPointer& other) : ptr(other.ptr), controlBlock(other.controlBlock) {
+			if (controlBlock) {
+				controlBlock->AddWeak();
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TWeakPointer(TWeakPointer&& other) noexcept : ptr(other.ptr), controlBlock(other.controlBlock) {
+			other.ptr = nullptr;
+			other.controlBlock = nullptr;
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TWeakPointer&
+			operator=(const TWeakPointer& other) {
+			if (other.controlBlock) {
+				other.controlBlock->AddWeak();
+			}
+			release();
+			ptr = other.ptr;
+			controlBlock = other.controlBlock;
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TWeakPointer&
+			operator=(TWeakPointer&& other) noexcept {
+			if (this != &other) {
+				release();
+				ptr = other.ptr;
+				controlBlock = other.controlBlock;
+				other.ptr = nullptr;
+				other.controlBlock = nullptr;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor. Libera la referencia dbil; el ltimo en salir libera el bloque de control.
+		 */
+		~TWeakPointer() {
+			release();
 		}
 
 		/**
 		 * @brief Convertir TWeakPointer a TSharedPointer.
 		 *
+		 * Sube el recuento fuerte con un CAS solo si an no es cero, as que nunca resucita
+		 * un objeto que otro hilo est destruyendo.
+		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
 		 */
-		TSharedPointer<T>
+		TSharedPointer<T, Mode>
 			lock() const {
-			if (refCount && *refCount > 0) {
-				return TSharedPointer<T>(ptr, refCount);
+			if (controlBlock && controlBlock->TryAddStrong()) {
+				return TSharedPointer<T, Mode>(ptr, controlBlock);
 			}
-			return TSharedPointer<T>();
+			return TSharedPointer<T, Mode>();
+		}
+
+		/**
+		 * @brief Indica si el objeto observado ya se ha destruido (o si nunca hubo objeto).
+		 *
+		 * Con otros hilos activos, un resultado false puede dejar de ser cierto enseguida;
+		 * para usar el objeto llama siempre a lock().
+		 */
+		bool
+			expired() const {
+			return controlBlock == nullptr || controlBlock->GetStrongCount() == 0;
+		}
+
+		/**
+		 * @brief Deja de observar el objeto.
+		 */
+		void
+			reset() {
+			release();
+			ptr = nullptr;
+			controlBlock = nullptr;
 		}
 
 		// Hacer que TSharedPointer sea un amigo para acceder a los miembros privados.
-		template<typename U>
+		template<typename U, RefCountMode OtherMode>
 		friend class TSharedPointer;
 
 	private:
 		T* ptr;       ///< Puntero al objeto observado.
-		int* refCount; ///< Puntero al recuento de referencias del TSharedPointer original.
+		TControlBlock<Mode>* controlBlock; ///< Bloque de control compartido con los TSharedPointer.
+
+		void
+			release() {
+			if (controlBlock) {
+				controlBlock->ReleaseWeak();
+			}
+		}
 	};
 
 	/*
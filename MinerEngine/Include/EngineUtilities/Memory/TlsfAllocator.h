@@ -0,0 +1,470 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "../Structures/TArray.h"
+#include "../Utilities/Platform.h"
+
+namespace EU {
+	/**
+	 * @brief Resultado de TlsfAllocator::Allocate: desplazamiento dentro del rango y nodo interno.
+	 *
+	 * Se guarda entero para poder liberarlo; Offset es lo nico que necesita quien usa la memoria.
+	 */
+	struct TlsfAllocation
+	{
+		static constexpr uint32_t InvalidNode = 0xffffffffu;
+
+		uint64_t Offset = 0;             ///< Inicio de la regin dentro del rango gestionado.
+		uint32_t NodeIndex = InvalidNode; ///< Nodo de metadatos (uso interno del asignador).
+
+		bool IsValid() const { return NodeIndex != InvalidNode; }
+	};
+
+	/**
+	 * @brief Asignador Two-Level Segregated Fit sobre un rango abstracto [0, Size).
+	 *
+	 * Reservar y liberar cuestan O(1): los bloques libres se clasifican en 64 x 16 listas segn su
+	 * tamao (primer nivel = potencia de dos, segundo nivel = 16 subdivisiones lineales) y dos
+	 * niveles de mapas de bits localizan la primera lista no vaca que garantiza sitio. Al liberar,
+	 * el bloque se une con sus vecinos fsicos libres, lo que mantiene baja la fragmentacin.
+	 *
+	 * Los metadatos viven fuera del rango gestionado, de modo que sirve tanto para un bloque de
+	 * memoria del host (puntero = Base + Offset) como para subasignar un ID3D11Buffer grande entre
+	 * varias mallas o constant buffers, donde la memoria no es accesible desde la CPU.
+	 *
+	 * No es seguro entre hilos.
+	 */
+	class TlsfAllocator
+	{
+	public:
+		/**
+		 * @brief Estadsticas del asignador.
+		 */
+		struct FStats
+		{
+			uint64_t TotalSize = 0;          ///< Tamao del rango gestionado.
+			uint64_t FreeSize = 0;           ///< Bytes libres (incluye huecos de alineacin).
+			uint64_t LargestFreeRegion = 0;  ///< Mayor bloque libre contiguo.
+			uint32_t NumAllocations = 0;     ///< Reservas vivas.
+			uint32_t NumFreeRegions = 0;     ///< Bloques libres (mide la fragmentacin).
+		};
+
+		/**
+		 * @brief Crea el asignador para el rango [0, Size).
+		 */
+		explicit TlsfAllocator(uint64_t Size = 0)
+		{
+			Reset(Size);
+		}
+
+		/**
+		 * @brief Olvida todas las reservas y vuelve a gestionar [0, Size) como un nico bloque libre.
+		 */
+		void Reset(uint64_t Size)
+		{
+			Nodes.Clear();
+			FreeNodes.Clear();
+			FirstLevelBitmap = 0;
+			for (uint32_t fl = 0; fl < FirstLevelCount; ++fl)
+			{
+				SecondLevelBitmaps[fl] = 0;
+				for (uint32_t sl = 0; sl < SecondLevelCount; ++sl)
+				{
+					FreeHeads[fl][sl] = InvalidIndex;
+				}
+			}
+
+			TotalSize = Size;
+			FreeSize = 0;
+			NumAllocations = 0;
+			NumFreeRegions = 0;
+			if (Size > 0)
+			{
+				const uint32_t Node = CreateNode(0, Size, InvalidIndex, InvalidIndex);
+				InsertFree(Node);
+			}
+		}
+
+		/**
+		 * @brief Reserva Size unidades alineadas a Alignment (potencia de dos).
+		 *
+		 * Para alinear a un tamao de elemento que no es potencia de dos (por ejemplo
+		 * sizeof(SimpleVertex) = 20) usar AllocateStrided.
+		 *
+		 * @return Una reserva invlida (IsValid() == false) si no hay hueco suficiente o si
+		 *         Alignment no es potencia de dos.
+		 */
+		TlsfAllocation Allocate(uint64_t Size, uint64_t Alignment = 1)
+		{
+			if (Alignment == 0 || (Alignment & (Alignment - 1)) != 0)
+			{
+				return TlsfAllocation();
+			}
+			return AllocateAligned(Size, Alignment);
+		}
+
+		/**
+		 * @brief Reserva Size unidades empezando en un mltiplo de Stride (cualquier valor > 0).
+		 *
+		 * Pensado para buffers de elementos empaquetados: con Stride = sizeof(SimpleVertex),
+		 * Offset / Stride es el primer vrtice de la reserva.
+		 *
+		 * @return Una reserva invlida (IsValid() == false) si no hay hueco suficiente o Stride es 0.
+		 */
+		TlsfAllocation AllocateStrided(uint64_t Size, uint64_t Stride)
+		{
+			if (Stride == 0)
+			{
+				return TlsfAllocation();
+			}
+			return AllocateAligned(Size, Stride);
+		}
+
+		/**
+		 * @brief Libera una reserva y la fusiona con los bloques libres vecinos.
+		 *
+		 * Liberar dos veces la misma reserva no hace nada mientras su nodo siga libre. Si el nodo ya
+		 * se reutiliz para otra reserva, no hay forma de distinguirlas y se libera esa otra.
+		 */
+		void Free(const TlsfAllocation& Allocation)
+		{
+			if (!Allocation.IsValid() || Allocation.NodeIndex >= Nodes.Num() || !Nodes[Allocation.NodeIndex].bUsed)
+			{
+				return;
+			}
+			uint32_t Node = Allocation.NodeIndex;
+			Nodes[Node].bUsed = false;
+			--NumAllocations;
+
+			const uint32_t Prev = Nodes[Node].PrevPhysical;
+			if (Prev != InvalidIndex && !Nodes[Prev].bUsed)
+			{
+				RemoveFree(Prev);
+				Merge(Prev, Node);
+				Node = Prev;
+			}
+			const uint32_t Next = Nodes[Node].NextPhysical;
+			if (Next != InvalidIndex && !Nodes[Next].bUsed)
+			{
+				RemoveFree(Next);
+				Merge(Node, Next);
+			}
+			InsertFree(Node);
+		}
+
+		/**
+		 * @brief Tamao real reservado para una asignacin (puede superar lo pedido en pocas unidades).
+		 */
+		uint64_t GetAllocationSize(const TlsfAllocation& Allocation) const
+		{
+			return Allocation.IsValid() ? Nodes[Allocation.NodeIndex].Size : 0;
+		}
+
+		/**
+		 * @brief Estadsticas actuales.
+		 *
+		 * LargestFreeRegion solo recorre la lista de la clase de tamao ms alta con bloques libres.
+		 */
+		FStats GetStats() const
+		{
+			FStats Stats;
+			Stats.TotalSize = TotalSize;
+			Stats.FreeSize = FreeSize;
+			Stats.NumAllocations = NumAllocations;
+			Stats.NumFreeRegions = NumFreeRegions;
+			if (FirstLevelBitmap != 0)
+			{
+				const uint32_t fl = FloorLog2_64(FirstLevelBitmap);
+				const uint32_t sl = FloorLog2_64(SecondLevelBitmaps[fl]);
+				for (uint32_t Node = FreeHeads[fl][sl]; Node != InvalidIndex; Node = Nodes[Node].NextFree)
+				{
+					if (Nodes[Node].Size > Stats.LargestFreeRegion)
+					{
+						Stats.LargestFreeRegion = Nodes[Node].Size;
+					}
+				}
+			}
+			return Stats;
+		}
+
+	private:
+		/**
+		 * @brief Ncleo de Allocate/AllocateStrided: el desplazamiento se redondea hacia arriba al
+		 *        siguiente mltiplo de Alignment (con mscara si es potencia de dos).
+		 */
+		TlsfAllocation AllocateAligned(uint64_t Size, uint64_t Alignment)
+		{
+			if (Size == 0)
+			{
+				Size = 1;
+			}
+			const uint64_t Padding = Alignment - 1;
+			if (Size > TotalSize || Padding > TotalSize - Size)
+			{
+				return TlsfAllocation();
+			}
+
+			// Se busca sitio para el peor caso de alineacin; el hueco sobrante se devuelve enseguida.
+			const uint32_t Node = FindFree(Size + Padding);
+			if (Node == InvalidIndex)
+			{
+				return TlsfAllocation();
+			}
+			RemoveFree(Node);
+
+			const uint64_t Offset = Nodes[Node].Offset;
+			const uint64_t AlignedOffset = (Alignment & Padding) == 0
+				? (Offset + Padding) & ~Padding
+				: (Offset + Padding) / Alignment * Alignment;
+			const uint64_t Front = AlignedOffset - Nodes[Node].Offset;
+			uint32_t Used = Node;
+			if (Front > 0)
+			{
+				// El hueco delantero queda libre: su vecino anterior est ocupado (o no existe)
+				// porque los bloques libres contiguos siempre se fusionan.
+				Used = SplitAfter(Node, Front);
+				InsertFree(Node);
+			}
+			if (Nodes[Used].Size > Size)
+			{
+				const uint32_t Tail = SplitAfter(Used, Size);
+				InsertFree(Tail);
+			}
+
+			Nodes[Used].bUsed = true;
+			++NumAllocations;
+
+			TlsfAllocation Result;
+			Result.Offset = Nodes[Used].Offset;
+			Result.NodeIndex = Used;
+			return Result;
+		}
+
+		static constexpr uint32_t InvalidIndex = TlsfAllocation::InvalidNode;
+		static constexpr uint32_t SecondLevelLog2 = 4;
+		static constexpr uint32_t SecondLevelCount = 1u << SecondLevelLog2;
+		static constexpr uint32_t FirstLevelCount = 64 - SecondLevelLog2 + 1;
+
+		/**
+		 * @brief Bloque fsico del rango (libre u ocupado).
+		 */
+		struct FNode
+		{
+			uint64_t Offset;
+			uint64_t Size;
+			uint32_t PrevPhysical;  ///< Bloque inmediatamente anterior en el rango.
+			uint32_t NextPhysical;  ///< Bloque inmediatamente posterior en el rango.
+			uint32_t PrevFree;      ///< Lista de libres de su clase de tamao.
+			uint32_t NextFree;
+			bool bUsed;
+		};
+
+		/**
+		 * @brief Clase de tamao (primer y segundo nivel) a la que pertenece un bloque de Size unidades.
+		 */
+		static void MapInsert(uint64_t Size, uint32_t& OutFirst, uint32_t& OutSecond)
+		{
+			if (Size < SecondLevelCount)
+			{
+				OutFirst = 0;
+				OutSecond = static_cast<uint32_t>(Size);
+				return;
+			}
+			const uint32_t Log2 = FloorLog2_64(Size);
+			OutFirst = Log2 - SecondLevelLog2 + 1;
+			OutSecond = static_cast<uint32_t>(Size >> (Log2 - SecondLevelLog2)) ^ SecondLevelCount;
+		}
+
+		/**
+		 * @brief Busca un bloque libre de al menos Size unidades en O(1).
+		 *
+		 * Redondea Size a la siguiente clase para que cualquier bloque de la lista encontrada sirva.
+		 */
+		uint32_t FindFree(uint64_t Size) const
+		{
+			if (Size >= SecondLevelCount)
+			{
+				const uint64_t Round = (uint64_t(1) << (FloorLog2_64(Size) - SecondLevelLog2)) - 1;
+				Size = Size + Round < Size ? Size : Size + Round;
+			}
+			uint32_t fl;
+			uint32_t sl;
+			MapInsert(Size, fl, sl);
+
+			uint32_t SecondMap = SecondLevelBitmaps[fl] & (~0u << sl);
+			if (SecondMap == 0)
+			{
+				const uint64_t FirstMap = fl + 1 < 64 ? FirstLevelBitmap & (~uint64_t(0) << (fl + 1)) : 0;
+				if (FirstMap == 0)
+				{
+					return InvalidIndex;
+				}
+				fl = CountTrailingZeros64(FirstMap);
+				SecondMap = SecondLevelBitmaps[fl];
+			}
+			sl = CountTrailingZeros32(SecondMap);
+			return FreeHeads[fl][sl];
+		}
+
+		uint32_t CreateNode(uint64_t Offset, uint64_t Size, uint32_t PrevPhysical, uint32_t NextPhysical)
+		{
+			FNode Node = { Offset, Size, PrevPhysical, NextPhysical, InvalidIndex, InvalidIndex, false };
+			if (FreeNodes.Num() > 0)
+			{
+				const uint32_t Index = FreeNodes[FreeNodes.Num() - 1];
+				FreeNodes.RemoveAt(FreeNodes.Num() - 1);
+				Nodes[Index] = Node;
+				return Index;
+			}
+			Nodes.Add(Node);
+			return static_cast<uint32_t>(Nodes.Num() - 1);
+		}
+
+		/**
+		 * @brief Parte Node en [Offset, Offset + Size) y un bloque nuevo con el resto.
+		 * @return El ndice del bloque nuevo (an fuera de las listas de libres).
+		 */
+		uint32_t SplitAfter(uint32_t Node, uint64_t Size)
+		{
+			const uint32_t Rest = CreateNode(Nodes[Node].Offset + Size, Nodes[Node].Size - Size,
+				Node, Nodes[Node].NextPhysical);
+			if (Nodes[Rest].NextPhysical != InvalidIndex)
+			{
+				Nodes[Nodes[Rest].NextPhysical].PrevPhysical = Rest;
+			}
+			Nodes[Node].NextPhysical = Rest;
+			Nodes[Node].Size = Size;
+			return Rest;
+		}
+
+		/**
+		 * @brief Absorbe Next (vecino fsico posterior) dentro de Node y recicla su nodo.
+		 */
+		void Merge(uint32_t Node, uint32_t Next)
+		{
+			Nodes[Node].Size += Nodes[Next].Size;
+			Nodes[Node].NextPhysical = Nodes[Next].NextPhysical;
+			if (Nodes[Node].NextPhysical != InvalidIndex)
+			{
+				Nodes[Nodes[Node].NextPhysical].PrevPhysical = Node;
+			}
+			FreeNodes.Add(Next);
+		}
+
+		void InsertFree(uint32_t Node)
+		{
+			uint32_t fl;
+			uint32_t sl;
+			MapInsert(Nodes[Node].Size, fl, sl);
+
+			const uint32_t Head = FreeHeads[fl][sl];
+			Nodes[Node].PrevFree = InvalidIndex;
+			Nodes[Node].NextFree = Head;
+			if (Head != InvalidIndex)
+			{
+				Nodes[Head].PrevFree = Node;
+			}
+			FreeHeads[fl][sl] = Node;
+			FirstLevelBitmap |= uint64_t(1) << fl;
+			SecondLevelBitmaps[fl] |= 1u << sl;
+
+			FreeSize += Nodes[Node].Size;
+			++NumFreeRegions;
+		}
+
+		void RemoveFree(uint32_t Node)
+		{
+			uint32_t fl;
+			uint32_t sl;
+			MapInsert(Nodes[Node].Size, fl, sl);
+
+			const uint32_t Prev = Nodes[Node].PrevFree;
+			const uint32_t Next = Nodes[Node].NextFree;
+			if (Prev != InvalidIndex)
+			{
+				Nodes[Prev].NextFree = Next;
+			}
+			else
+			{
+				FreeHeads[fl][sl] = Next;
+				if (Next == InvalidIndex)
+				{
+					SecondLevelBitmaps[fl] &= ~(1u << sl);
+					if (SecondLevelBitmaps[fl] == 0)
+					{
+						FirstLevelBitmap &= ~(uint64_t(1) << fl);
+					}
+				}
+			}
+			if (Next != InvalidIndex)
+			{
+				Nodes[Next].PrevFree = Prev;
+			}
+
+			FreeSize -= Nodes[Node].Size;
+			--NumFreeRegions;
+		}
+
+		TArray<FNode> Nodes;                                     ///< Metadatos de todos los bloques.
+		TArray<uint32_t> FreeNodes;                              ///< ndices de Nodes reciclables.
+		uint32_t FreeHeads[FirstLevelCount][SecondLevelCount];   ///< Primera entrada de cada lista de libres.
+		uint32_t SecondLevelBitmaps[FirstLevelCount];            ///< Listas no vacas de cada primer nivel.
+		uint64_t FirstLevelBitmap = 0;                           ///< Primeros niveles con alguna lista no vaca.
+
+		uint64_t TotalSize = 0;
+		uint64_t FreeSize = 0;
+		uint32_t NumAllocations = 0;
+		uint32_t NumFreeRegions = 0;
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// Rango abstracto: un vertex buffer de 64 MB compartido por todas las mallas.
+		TlsfAllocator VertexSpace(64 * 1024 * 1024);
+		TlsfAllocation Mesh = VertexSpace.AllocateStrided(36 * sizeof(SimpleVertex), sizeof(SimpleVertex));
+		UINT FirstVertex = static_cast<UINT>(Mesh.Offset / sizeof(SimpleVertex));
+
+		// Memoria del host: el asignador solo da desplazamientos.
+		uint8_t* Heap = static_cast<uint8_t*>(::operator new(1 << 20));
+		TlsfAllocator HeapSpace(1 << 20);
+		TlsfAllocation A = HeapSpace.Allocate(256, 16);
+		void* Pointer = Heap + A.Offset;
+
+		HeapSpace.Free(A);
+		VertexSpace.Free(Mesh);
+		std::cout << VertexSpace.GetStats().NumFreeRegions << std::endl; // 1
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,415 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <utility>
+#include "MemoryTracker.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace EU {
+	/**
+	 * @brief Primitivas de memoria virtual: reservar un rango de direcciones y confirmar pginas aparte.
+	 *
+	 * Windows usa VirtualAlloc/VirtualFree; el resto de plataformas, mmap/mprotect/madvise.
+	 */
+	namespace VirtualMemory {
+		/**
+		 * @brief Tamao de pgina del sistema (granularidad de Commit/Decommit).
+		 */
+		inline size_t GetPageSize()
+		{
+#if defined(_WIN32)
+			SYSTEM_INFO Info;
+			GetSystemInfo(&Info);
+			return static_cast<size_t>(Info.dwPageSize);
+#else
+			return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		}
+
+		/**
+		 * @brief Reserva Size bytes de direcciones sin memoria fsica detrs.
+		 * @return nullptr si el sistema no tiene tanto espacio de direcciones libre.
+		 */
+		inline void* Reserve(size_t Size)
+		{
+#if defined(_WIN32)
+			return VirtualAlloc(nullptr, Size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+			void* Address = mmap(nullptr, Size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			return Address == MAP_FAILED ? nullptr : Address;
+#endif
+		}
+
+		/**
+		 * @brief Hace utilizables (lectura/escritura, a cero) las pginas de [Address, Address + Size).
+		 */
+		inline bool Commit(void* Address, size_t Size)
+		{
+#if defined(_WIN32)
+			return VirtualAlloc(Address, Size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+			return mprotect(Address, Size, PROT_READ | PROT_WRITE) == 0;
+#endif
+		}
+
+		/**
+		 * @brief Devuelve al sistema la memoria fsica de las pginas; las direcciones siguen reservadas.
+		 */
+		inline void Decommit(void* Address, size_t Size)
+		{
+#if defined(_WIN32)
+			VirtualFree(Address, Size, MEM_DECOMMIT);
+#else
+			madvise(Address, Size, MADV_DONTNEED);
+			mprotect(Address, Size, PROT_NONE);
+#endif
+		}
+
+		/**
+		 * @brief Libera un rango completo obtenido con Reserve.
+		 */
+		inline void Release(void* Address, size_t Size)
+		{
+#if defined(_WIN32)
+			(void)Size;
+			VirtualFree(Address, 0, MEM_RELEASE);
+#else
+			munmap(Address, Size);
+#endif
+		}
+
+		/**
+		 * @brief Pide al sistema pginas grandes transparentes para el rango (solo Linux; en otras
+		 * plataformas no hace nada).
+		 */
+		inline void AdviseHugePages(void* Address, size_t Size)
+		{
+#if defined(MADV_HUGEPAGE)
+			madvise(Address, Size, MADV_HUGEPAGE);
+#else
+			(void)Address;
+			(void)Size;
+#endif
+		}
+	}
+
+	/**
+	 * @brief Arena lineal sobre un rango virtual reservado de antemano que confirma pginas segn crece.
+	 *
+	 * La base nunca se mueve: los punteros devueltos siguen siendo vlidos mientras crece y crecer
+	 * no copia nada. Solo cuesta memoria fsica lo que se ha confirmado; Shrink() puede devolverla.
+	 * Las pginas confirmadas se atribuyen a la MemoryTag indicada al crearla.
+	 *
+	 * No es segura entre hilos.
+	 */
+	class VirtualArena
+	{
+	public:
+		/**
+		 * @brief Reserva por defecto: 64 GB en 64 bits, 256 MB en 32 bits.
+		 */
+		static constexpr size_t DefaultReserveSize = sizeof(void*) == 8 ? (size_t(64) << 30) : (size_t(256) << 20);
+
+		/**
+		 * @brief Reserva ReserveSize bytes de direcciones (no confirma nada todava).
+		 *
+		 * @param ReserveSize Tamao mximo al que puede crecer la arena.
+		 * @param Tag Etiqueta a la que se atribuye la memoria confirmada.
+		 * @param bHugePages Pedir pginas grandes transparentes donde el sistema lo permita.
+		 */
+		explicit VirtualArena(size_t ReserveSize = DefaultReserveSize,
+			MemoryTag Tag = CurrentMemoryTag(), bool bHugePages = false)
+			: Tag(Tag)
+		{
+			CommitGranularity = bHugePages ? HugePageSize : DefaultCommitGranularity;
+			Reserved = AlignUp(ReserveSize, CommitGranularity);
+			Base = static_cast<uint8_t*>(VirtualMemory::Reserve(Reserved));
+			if (Base == nullptr)
+			{
+				Reserved = 0;
+			}
+			else if (bHugePages)
+			{
+				VirtualMemory::AdviseHugePages(Base, Reserved);
+			}
+		}
+
+		~VirtualArena()
+		{
+			if (Base != nullptr)
+			{
+				MemoryTracker::Get().OnFree(Tag, Committed);
+				VirtualMemory::Release(Base, Reserved);
+			}
+		}
+
+		VirtualArena(const VirtualArena&) = delete;
+		VirtualArena& operator=(const VirtualArena&) = delete;
+
+		VirtualArena(VirtualArena&& Other) noexcept
+		{
+			*this = std::move(Other);
+		}
+
+		VirtualArena& operator=(VirtualArena&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				std::swap(Base, Other.Base);
+				std::swap(Reserved, Other.Reserved);
+				std::swap(Committed, Other.Committed);
+				std::swap(Used, Other.Used);
+				std::swap(CommitGranularity, Other.CommitGranularity);
+				std::swap(Tag, Other.Tag);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Reserva Size bytes alineados a Alignment al final de la arena.
+		 *
+		 * @return nullptr si se agota el rango reservado o el sistema no puede confirmar ms pginas.
+		 */
+		void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+		{
+			const size_t Start = AlignUp(Used, Alignment);
+			if (Base == nullptr || Start > Reserved || Size > Reserved - Start)
+			{
+				return nullptr;
+			}
+			if (!EnsureCommitted(Start + Size))
+			{
+				return nullptr;
+			}
+			Used = Start + Size;
+			return Base + Start;
+		}
+
+		/**
+		 * @brief Asegura que los primeros Size bytes estn confirmados.
+		 */
+		bool EnsureCommitted(size_t Size)
+		{
+			if (Size <= Committed)
+			{
+				return true;
+			}
+			if (Size > Reserved)
+			{
+				return false;
+			}
+			const size_t NewCommitted = AlignUp(Size, CommitGranularity) < Reserved
+				? AlignUp(Size, CommitGranularity) : Reserved;
+			if (!VirtualMemory::Commit(Base + Committed, NewCommitted - Committed))
+			{
+				return false;
+			}
+			MemoryTracker::Get().OnAllocate(Tag, NewCommitted - Committed);
+			Committed = NewCommitted;
+			return true;
+		}
+
+		/**
+		 * @brief Recorta la arena a NewUsed bytes y devuelve al sistema las pginas que sobran.
+		 *
+		 * Las direcciones siguen reservadas; volver a crecer confirma las pginas de nuevo (a cero).
+		 */
+		void Shrink(size_t NewUsed)
+		{
+			if (NewUsed < Used)
+			{
+				Used = NewUsed;
+			}
+			const size_t Keep = AlignUp(Used, CommitGranularity);
+			if (Keep < Committed)
+			{
+				VirtualMemory::Decommit(Base + Keep, Committed - Keep);
+				MemoryTracker::Get().OnFree(Tag, Committed - Keep);
+				Committed = Keep;
+			}
+		}
+
+		/**
+		 * @brief Retrocede el cursor a NewUsed bytes sin devolver pginas (para liberar en orden de pila).
+		 */
+		void Rewind(size_t NewUsed)
+		{
+			if (NewUsed < Used)
+			{
+				Used = NewUsed;
+			}
+		}
+
+		/**
+		 * @brief Vaca la arena conservando las pginas confirmadas para reutilizarlas.
+		 */
+		void Reset() { Used = 0; }
+
+		uint8_t* GetBase() const { return Base; }
+		size_t GetUsed() const { return Used; }
+		size_t GetCommitted() const { return Committed; }
+		size_t GetReserved() const { return Reserved; }
+
+	private:
+		static constexpr size_t DefaultCommitGranularity = 64 * 1024;  ///< Confirmar de 64 KB en 64 KB.
+		static constexpr size_t HugePageSize = 2 * 1024 * 1024;        ///< Pgina grande de x64.
+
+		static size_t AlignUp(size_t Value, size_t Alignment)
+		{
+			return (Value + (Alignment - 1)) & ~(Alignment - 1);
+		}
+
+		uint8_t* Base = nullptr;
+		size_t Reserved = 0;
+		size_t Committed = 0;
+		size_t Used = 0;
+		size_t CommitGranularity = DefaultCommitGranularity;
+		MemoryTag Tag = MemoryTag::Untagged;
+	};
+
+	/**
+	 * @brief Array que crece dentro de una VirtualArena: sin copias al crecer y con punteros estables.
+	 *
+	 * Pensado para listas grandes que solo crecen (entidades, pools de vrtices, tablas de recursos).
+	 * La capacidad mxima se fija al construirlo.
+	 *
+	 * @tparam T Tipo de los elementos.
+	 */
+	template<typename T>
+	class TVirtualArray
+	{
+	public:
+		/**
+		 * @brief Reserva direcciones para MaxElements elementos.
+		 */
+		explicit TVirtualArray(size_t MaxElements = VirtualArena::DefaultReserveSize / sizeof(T),
+			MemoryTag Tag = CurrentMemoryTag(), bool bHugePages = false)
+			: Arena(MaxElements * sizeof(T), Tag, bHugePages)
+		{
+		}
+
+		~TVirtualArray()
+		{
+			Clear();
+		}
+
+		TVirtualArray(const TVirtualArray&) = delete;
+		TVirtualArray& operator=(const TVirtualArray&) = delete;
+
+		/**
+		 * @brief Construye un elemento al final; nunca reubica los anteriores.
+		 */
+		template<typename... Args>
+		T& Emplace(Args&&... args)
+		{
+			// sizeof(T) es mltiplo de alignof(T): cada reserva cae justo detrs de la anterior.
+			void* Memory = Arena.Allocate(sizeof(T), alignof(T));
+			if (Memory == nullptr)
+			{
+				std::cerr << "TVirtualArray: rango virtual agotado" << std::endl;
+				exit(1);
+			}
+			T* Element = ::new (Memory) T(std::forward<Args>(args)...);
+			++Size;
+			return *Element;
+		}
+
+		void Add(const T& Element) { Emplace(Element); }
+		void Add(T&& Element) { Emplace(std::move(Element)); }
+
+		/**
+		 * @brief Confirma de antemano memoria para Count elementos.
+		 */
+		bool Reserve(size_t Count)
+		{
+			return Arena.EnsureCommitted(Count * sizeof(T));
+		}
+
+		/**
+		 * @brief Destruye los elementos a partir de NewSize y devuelve las pginas sobrantes.
+		 */
+		void Shrink(size_t NewSize)
+		{
+			while (Size > NewSize)
+			{
+				GetData()[--Size].~T();
+			}
+			Arena.Shrink(Size * sizeof(T));
+		}
+
+		/**
+		 * @brief Destruye todos los elementos y devuelve toda la memoria fsica.
+		 */
+		void Clear() { Shrink(0); }
+
+		T& operator[](size_t Index) { return GetData()[Index]; }
+		const T& operator[](size_t Index) const { return GetData()[Index]; }
+
+		size_t Num() const { return Size; }
+		T* GetData() const { return reinterpret_cast<T*>(Arena.GetBase()); }
+		size_t GetCapacity() const { return Arena.GetReserved() / sizeof(T); }
+
+		T* begin() const { return GetData(); }
+		T* end() const { return GetData() + Size; }
+
+	private:
+		VirtualArena Arena;
+		size_t Size = 0;
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// Hasta 100M vrtices sin copias al crecer; solo se confirma lo que se usa.
+		TVirtualArray<SimpleVertex> Vertices(100000000, MemoryTag::Mesh);
+		SimpleVertex* First = &Vertices.Emplace();
+		for (int i = 0; i < 1000000; ++i) {
+			Vertices.Emplace();
+		}
+		assert(First == &Vertices[0]);                   // La base no se mueve.
+
+		Vertices.Shrink(1000);                           // Devuelve las pginas sobrantes.
+		std::cout << MemoryTracker::Get().GetStats(MemoryTag::Mesh).LiveBytes << std::endl;
+		return 0;
+	}
+	*/
+}
@@ -28,13 +28,116 @@
 */
 
 #pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../Memory/MemoryTracker.h"
+
 namespace EU {
+	/**
+	 * @brief Indica si un tipo puede reubicarse en memoria con un simple memcpy.
+	 *
+	 * Por defecto solo los tipos trivialmente copiables. Los tipos propios que no guardan punteros
+	 * a s mismos pueden especializar este rasgo para que los contenedores los muevan en bloque.
+	 *
+	 * @tparam T El tipo a evaluar.
+	 */
+	template<typename T>
+	struct TIsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	namespace ArrayMemory {
+		/**
+		 * @brief Reserva memoria sin construir para Count elementos respetando alignof(T).
+		 *
+		 * La reserva se atribuye a la etiqueta de memoria activa en el hilo (FScopedMemoryTag).
+		 */
+		template<typename T>
+		T* Allocate(size_t Count)
+		{
+			return static_cast<T*>(TaggedMemory::Allocate(Count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Libera memoria obtenida con Allocate (los elementos ya deben estar destruidos).
+		 */
+		template<typename T>
+		void Deallocate(T* Memory)
+		{
+			TaggedMemory::Free(Memory);
+		}
+
+		/**
+		 * @brief Destruye Count elementos construidos.
+		 */
+		template<typename T>
+		void Destroy(T* Elements, size_t Count)
+		{
+			if constexpr (!std::is_trivially_destructible<T>::value)
+			{
+				for (size_t i = 0; i < Count; ++i)
+				{
+					Elements[i].~T();
+				}
+			}
+		}
+
+		/**
+		 * @brief Mueve Count elementos de Source a la memoria sin construir Dest y destruye los originales.
+		 *
+		 * Usa memcpy para tipos trivialmente reubicables y std::move_if_noexcept para el resto,
+		 * de modo que un tipo cuyo constructor de movimiento puede lanzar se copia en su lugar.
+		 * Los originales solo se destruyen cuando todas las copias han terminado: si una copia
+		 * lanza, se destruyen las ya hechas en Dest y Source queda intacto.
+		 */
+		template<typename T>
+		void Relocate(T* Source, T* Dest, size_t Count)
+		{
+			if constexpr (TIsTriviallyRelocatable<T>::value)
+			{
+				if (Count > 0)
+				{
+					std::memcpy(static_cast<void*>(Dest), static_cast<const void*>(Source), Count * sizeof(T));
+				}
+			}
+			else if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+			{
+				for (size_t i = 0; i < Count; ++i)
+				{
+					new (Dest + i) T(std::move(Source[i]));
+					Source[i].~T();
+				}
+			}
+			else
+			{
+				size_t Copied = 0;
+				try
+				{
+					for (; Copied < Count; ++Copied)
+					{
+						new (Dest + Copied) T(static_cast<const T&>(Source[Copied]));
+					}
+				}
+				catch (...)
+				{
+					Destroy(Dest, Copied);
+					throw;
+				}
+				Destroy(Source, Count);
+			}
+		}
+	}
+
 	/**
 	 * @brief TArray es una clase de array dinmica para almacenar elementos de tipo T.
 	 *
 	 * Esta implementacin de TArray proporciona una forma sencilla de almacenar y gestionar
 	 * colecciones de elementos, con operaciones bsicas como agregar, eliminar y acceder a elementos.
-	 * La memoria se gestiona dinmicamente, aumentando la capacidad del array segn sea necesario.
+	 * La memoria se reserva sin construir: solo existen los Num() primeros elementos, y al crecer
+	 * se reubican movindolos (o con memcpy si el tipo es trivialmente reubicable) en vez de copiarlos.
 	 *
 	 * @tparam T El tipo de elementos almacenados en el array.
 	 */
@@ -47,33 +150,148 @@ namespace EU {
 		size_t Size;       ///< Nmero de elementos actualmente en el array.
 
 		/**
-		 * @brief Redimensiona el array para tener una nueva capacidad.
+		 * @brief Reubica los elementos en un nuevo bloque de memoria con la capacidad indicada.
 		 *
-		 * @param NewCapacity La nueva capacidad del array.
+		 * @param NewCapacity La nueva capacidad del array (mayor o igual que Size).
 		 */
-		void Resize(size_t NewCapacity)
+		void Reallocate(size_t NewCapacity)
 		{
-			T* NewData = new T[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			T* NewData = ArrayMemory::Allocate<T>(NewCapacity);  ///< Crear un nuevo bloque de memoria sin construir.
+			try
+			{
+				ArrayMemory::Relocate(Data, NewData, Size);  ///< Mover los elementos existentes al nuevo bloque.
+			}
+			catch (...)
 			{
-				NewData[i] = Data[i];  ///< Copiar los elementos existentes al nuevo bloque de memoria.
+				ArrayMemory::Deallocate(NewData);  ///< Relocate dej intacto el bloque actual.
+				throw;
 			}
-			delete[] Data;  ///< Liberar la memoria del array antiguo.
+			ArrayMemory::Deallocate(Data);  ///< Liberar la memoria del array antiguo.
 			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
 			Capacity = NewCapacity;  ///< Actualizar la capacidad del array.
 		}
 
+		/**
+		 * @brief Capacidad a usar cuando el array est lleno.
+		 */
+		size_t GrowCapacity() const
+		{
+			return Capacity == 0 ? 1 : Capacity * 2;
+		}
+
 	public:
 		/**
 		 * @brief Constructor por defecto que inicializa el array con capacidad y tamao cero.
 		 */
 		TArray() : Data(nullptr), Capacity(0), Size(0)	{}
 
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TArray(const TArray& Other) : Data(nullptr), Capacity(0), Size(0)
+		{
+			Reserve(Other.Size);
+			for (size_t i = 0; i < Other.Size; ++i)
+			{
+				new (Data + i) T(Other.Data[i]);
+			}
+			Size = Other.Size;
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TArray(TArray&& Other) noexcept : Data(Other.Data), Capacity(Other.Capacity), Size(Other.Size)
+		{
+			Other.Data = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TArray& operator=(const TArray& Other)
+		{
+			if (this != &Other)
+			{
+				TArray Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TArray& operator=(TArray&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				ArrayMemory::Deallocate(Data);
+				Data = Other.Data;
+				Capacity = Other.Capacity;
+				Size = Other.Size;
+				Other.Data = nullptr;
+				Other.Capacity = 0;
+				Other.Size = 0;
+			}
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al array.
 		 */
 		~TArray()	{
-			delete[] Data;  ///< Liberar la memoria del array.
+			Clear();  ///< Destruir los elementos.
+			ArrayMemory::Deallocate(Data);  ///< Liberar la memoria del array.
+		}
+
+		/**
+		 * @brief Construye un nuevo elemento al final del array a partir de sus argumentos.
+		 *
+		 * Los argumentos pueden referirse a elementos del propio array: el nuevo elemento se
+		 * construye antes de reubicar los existentes. Si el constructor del elemento o una copia
+		 * de la reubicacin lanzan, el array queda como estaba.
+		 *
+		 * @return Referencia al elemento construido.
+		 */
+		template<typename... Args>
+		T& Emplace(Args&&... args)
+		{
+			if (Size == Capacity)
+			{
+				const size_t NewCapacity = GrowCapacity();
+				T* NewData = ArrayMemory::Allocate<T>(NewCapacity);
+				try
+				{
+					new (NewData + Size) T(std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					ArrayMemory::Deallocate(NewData);
+					throw;
+				}
+				try
+				{
+					ArrayMemory::Relocate(Data, NewData, Size);
+				}
+				catch (...)
+				{
+					NewData[Size].~T();
+					ArrayMemory::Deallocate(NewData);
+					throw;
+				}
+				ArrayMemory::Deallocate(Data);
+				Data = NewData;
+				Capacity = NewCapacity;
+			}
+			else
+			{
+				new (Data + Size) T(std::forward<Args>(args)...);
+			}
+			return Data[Size++];  ///< Aumentar el tamao y devolver el nuevo elemento.
 		}
 
 		/**
@@ -83,15 +301,34 @@ namespace EU {
 		 */
 		void Add(const T& Element)
 		{
-			if (Size == Capacity)
+			Emplace(Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array movindolo.
+		 *
+		 * @param Element El elemento a mover al array.
+		 */
+		void Add(T&& Element)
+		{
+			Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Reserva memoria para al menos NewCapacity elementos sin cambiar el tamao.
+		 *
+		 * @param NewCapacity La capacidad mnima deseada.
+		 */
+		void Reserve(size_t NewCapacity)
+		{
+			if (NewCapacity > Capacity)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				Reallocate(NewCapacity);
 			}
-			Data[Size++] = Element;  ///< Aadir el nuevo elemento y aumentar el tamao.
 		}
 
 		/**
-		 * @brief Elimina el elemento en la posicin especificada.
+		 * @brief Elimina el elemento en la posicin especificada conservando el orden.
 		 *
 		 * @param Index La posicin del elemento a eliminar.
 		 */
@@ -102,13 +339,54 @@ namespace EU {
 				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
 				return;
 			}
-			for (size_t i = Index; i < Size - 1; ++i)
+			if constexpr (TIsTriviallyRelocatable<T>::value)
+			{
+				Data[Index].~T();
+				std::memmove(static_cast<void*>(Data + Index), static_cast<const void*>(Data + Index + 1),
+				             (Size - Index - 1) * sizeof(T));  ///< Desplazar el bloque restante de una vez.
+			}
+			else
 			{
-				Data[i] = Data[i + 1];  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
+				for (size_t i = Index; i < Size - 1; ++i)
+				{
+					Data[i] = std::move(Data[i + 1]);  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
+				}
+				Data[Size - 1].~T();
 			}
 			--Size;  ///< Disminuir el tamao del array.
 		}
 
+		/**
+		 * @brief Elimina el elemento en la posicin especificada moviendo el ltimo a su lugar.
+		 *
+		 * Es O(1) pero no conserva el orden de los elementos.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAtSwap(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				return;
+			}
+			if (Index != Size - 1)
+			{
+				Data[Index] = std::move(Data[Size - 1]);  ///< Mover el ltimo elemento al hueco.
+			}
+			Data[Size - 1].~T();
+			--Size;  ///< Disminuir el tamao del array.
+		}
+
+		/**
+		 * @brief Destruye todos los elementos conservando la memoria reservada.
+		 */
+		void Clear()
+		{
+			ArrayMemory::Destroy(Data, Size);
+			Size = 0;
+		}
+
 		/**
 		 * @brief Sobrecarga del operador [] para acceder a elementos por ndice.
 		 *
@@ -160,6 +438,20 @@ namespace EU {
 		{
 			return Capacity;  ///< Devolver la capacidad actual del array.
 		}
+
+		/**
+		 * @brief Devuelve un puntero a los elementos contiguos del array.
+		 */
+		T* GetData() { return Data; }
+		const T* GetData() const { return Data; }
+
+		/**
+		 * @brief Iteradores para recorrer el array con range-for.
+		 */
+		T* begin() { return Data; }
+		T* end() { return Data + Size; }
+		const T* begin() const { return Data; }
+		const T* end() const { return Data + Size; }
 	};
 
 	// EXAMPLE
@@ -169,18 +461,20 @@ namespace EU {
 
 		// TArray Example
 		TArray<int> MyArray;
+		MyArray.Reserve(8);
 		MyArray.Add(1);
 		MyArray.Add(2);
 		MyArray.Add(3);
 		MyArray.Add(4);
 		MyArray.Add(5);
 
-		MyArray.Add(6);
+		MyArray.Emplace(6);
 		MyArray.RemoveAt(2);
+		MyArray.RemoveAtSwap(0);
 
-		for (size_t i = 0; i < MyArray.Num(); ++i)
+		for (int Value : MyArray)
 		{
-			std::cout << MyArray[i] << " ";
+			std::cout << Value << " ";
 		}
 		std::cout << std::endl;
 
@@ -189,4 +483,4 @@ namespace EU {
 		return 0;
 	}
 	*/
-}
\ No newline at end of file
+}
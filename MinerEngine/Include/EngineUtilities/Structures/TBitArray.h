@@ -0,0 +1,542 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "TArray.h"
+#include "EngineUtilities/Utilities/Platform.h"
+
+namespace EU {
+	/**
+	 * @brief TBitArray es un array dinmico de bits empaquetados en palabras de 64 bits.
+	 *
+	 * Pensado para firmas de componentes, mscaras de visibilidad y listas de huecos libres:
+	 * las operaciones entre arrays (AND, OR, AND NOT) recorren la memoria de 128 en 128 bits con SSE2,
+	 * las bsquedas saltan palabras enteras y usan CountTrailingZeros, y el conteo usa PopCount64.
+	 *
+	 * Los bits de la ltima palabra por encima de Num() se mantienen siempre a cero, de modo que
+	 * el conteo y el recorrido pueden trabajar palabra a palabra sin enmascarar.
+	 */
+	class TBitArray
+	{
+	public:
+		static constexpr size_t InvalidIndex = ~static_cast<size_t>(0);  ///< Resultado de bsqueda sin coincidencias.
+		static constexpr size_t BitsPerWord = 64;
+
+	private:
+		uint64_t* Words;   ///< Palabras que contienen los bits.
+		size_t NumBits;    ///< Nmero de bits vlidos.
+		size_t NumWords;   ///< Nmero de palabras en uso.
+		size_t Capacity;   ///< Nmero de palabras reservadas.
+
+		static size_t WordsFor(size_t Bits)
+		{
+			return (Bits + BitsPerWord - 1) / BitsPerWord;
+		}
+
+		/**
+		 * @brief Pone a cero los bits de la ltima palabra que quedan fuera de Num().
+		 */
+		void TrimLastWord()
+		{
+			const size_t Used = NumBits % BitsPerWord;
+			if (Used != 0)
+			{
+				Words[NumWords - 1] &= (uint64_t(1) << Used) - 1;
+			}
+		}
+
+		/**
+		 * @brief Busca el primer bit a 1 a partir de From en Words, o en ~Words si Invert es true.
+		 */
+		template<bool Invert>
+		size_t FindFirst(size_t From) const
+		{
+			if (From >= NumBits)
+			{
+				return InvalidIndex;
+			}
+			size_t WordIndex = From / BitsPerWord;
+			uint64_t Word = (Invert ? ~Words[WordIndex] : Words[WordIndex]) & (~uint64_t(0) << (From % BitsPerWord));
+			for (;;)
+			{
+				if (Word != 0)
+				{
+					const size_t Index = WordIndex * BitsPerWord + CountTrailingZeros64(Word);
+					return Index < NumBits ? Index : InvalidIndex;
+				}
+				if (++WordIndex == NumWords)
+				{
+					return InvalidIndex;
+				}
+				Word = Invert ? ~Words[WordIndex] : Words[WordIndex];
+			}
+		}
+
+		/**
+		 * @brief Operacin binaria aplicada por Combine.
+		 */
+		enum class BitOp
+		{
+			And,
+			Or,
+			AndNot
+		};
+
+		template<BitOp Op>
+		static uint64_t Apply(uint64_t A, uint64_t B)
+		{
+			return Op == BitOp::And ? (A & B) : Op == BitOp::Or ? (A | B) : (A & ~B);
+		}
+
+#if EU_SSE2
+		template<BitOp Op>
+		static __m128i Apply(__m128i A, __m128i B)
+		{
+			return Op == BitOp::And ? _mm_and_si128(A, B) : Op == BitOp::Or ? _mm_or_si128(A, B) : _mm_andnot_si128(B, A);
+		}
+#endif
+
+		/**
+		 * @brief Aplica Op sobre las palabras comunes con Other, de dos en dos con SSE2.
+		 */
+		template<BitOp Op>
+		void Combine(const TBitArray& Other)
+		{
+			const size_t Count = NumWords < Other.NumWords ? NumWords : Other.NumWords;
+			size_t i = 0;
+#if EU_SSE2
+			for (; i + 2 <= Count; i += 2)
+			{
+				const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Words + i));
+				const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Other.Words + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words + i), Apply<Op>(A, B));
+			}
+#endif
+			for (; i < Count; ++i)
+			{
+				Words[i] = Apply<Op>(Words[i], Other.Words[i]);
+			}
+		}
+
+	public:
+		/**
+		 * @brief Iterador que recorre los ndices de los bits a 1 en orden creciente.
+		 */
+		class SetBitIterator
+		{
+		private:
+			const uint64_t* Words;
+			size_t NumWords;
+			size_t WordIndex;
+			uint64_t Remaining;  ///< Bits an no visitados de la palabra actual.
+
+			void SkipEmptyWords()
+			{
+				while (Remaining == 0)
+				{
+					if (++WordIndex >= NumWords)
+					{
+						WordIndex = NumWords;  ///< Fin: coincide con el iterador end().
+						return;
+					}
+					Remaining = Words[WordIndex];
+				}
+			}
+
+		public:
+			SetBitIterator(const uint64_t* Words, size_t NumWords, size_t WordIndex)
+				: Words(Words), NumWords(NumWords), WordIndex(WordIndex),
+				  Remaining(WordIndex < NumWords ? Words[WordIndex] : 0)
+			{
+				SkipEmptyWords();
+			}
+
+			size_t operator*() const
+			{
+				return WordIndex * BitsPerWord + CountTrailingZeros64(Remaining);
+			}
+
+			SetBitIterator& operator++()
+			{
+				Remaining &= Remaining - 1;  ///< Quitar el bit ms bajo.
+				SkipEmptyWords();
+				return *this;
+			}
+
+			bool operator!=(const SetBitIterator& Other) const
+			{
+				return WordIndex != Other.WordIndex || Remaining != Other.Remaining;
+			}
+		};
+
+		/**
+		 * @brief Rango de bits a 1, para usar en un range-for.
+		 */
+		struct SetBitRange
+		{
+			const TBitArray& Bits;
+			SetBitIterator begin() const { return SetBitIterator(Bits.Words, Bits.NumWords, 0); }
+			SetBitIterator end() const { return SetBitIterator(Bits.Words, Bits.NumWords, Bits.NumWords); }
+		};
+
+		/**
+		 * @brief Constructor por defecto que crea un array vaco.
+		 */
+		TBitArray() : Words(nullptr), NumBits(0), NumWords(0), Capacity(0) {}
+
+		/**
+		 * @brief Crea un array de Bits bits inicializados a Value.
+		 */
+		explicit TBitArray(size_t Bits, bool Value = false) : TBitArray()
+		{
+			Resize(Bits, Value);
+		}
+
+		TBitArray(const TBitArray& Other) : TBitArray()
+		{
+			Reserve(Other.NumBits);
+			if (Other.NumWords > 0)
+			{
+				std::memcpy(Words, Other.Words, Other.NumWords * sizeof(uint64_t));
+			}
+			NumBits = Other.NumBits;
+			NumWords = Other.NumWords;
+		}
+
+		TBitArray(TBitArray&& Other) noexcept
+			: Words(Other.Words), NumBits(Other.NumBits), NumWords(Other.NumWords), Capacity(Other.Capacity)
+		{
+			Other.Words = nullptr;
+			Other.NumBits = 0;
+			Other.NumWords = 0;
+			Other.Capacity = 0;
+		}
+
+		TBitArray& operator=(const TBitArray& Other)
+		{
+			if (this != &Other)
+			{
+				TBitArray Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		TBitArray& operator=(TBitArray&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				ArrayMemory::Deallocate(Words);
+				Words = Other.Words;
+				NumBits = Other.NumBits;
+				NumWords = Other.NumWords;
+				Capacity = Other.Capacity;
+				Other.Words = nullptr;
+				Other.NumBits = 0;
+				Other.NumWords = 0;
+				Other.Capacity = 0;
+			}
+			return *this;
+		}
+
+		~TBitArray()
+		{
+			ArrayMemory::Deallocate(Words);
+		}
+
+		/**
+		 * @brief Reserva palabras para al menos Bits bits sin cambiar Num().
+		 */
+		void Reserve(size_t Bits)
+		{
+			const size_t NeededWords = WordsFor(Bits);
+			if (NeededWords > Capacity)
+			{
+				uint64_t* NewWords = ArrayMemory::Allocate<uint64_t>(NeededWords);
+				if (NumWords > 0)
+				{
+					std::memcpy(NewWords, Words, NumWords * sizeof(uint64_t));
+				}
+				ArrayMemory::Deallocate(Words);
+				Words = NewWords;
+				Capacity = NeededWords;
+			}
+		}
+
+		/**
+		 * @brief Cambia el nmero de bits; los bits nuevos toman el valor Value.
+		 */
+		void Resize(size_t Bits, bool Value = false)
+		{
+			if (Bits > NumBits)
+			{
+				Reserve(Bits);
+				const size_t OldBits = NumBits;
+				const size_t NewWords = WordsFor(Bits);
+				if (NewWords > NumWords)
+				{
+					std::memset(Words + NumWords, Value ? 0xFF : 0x00, (NewWords - NumWords) * sizeof(uint64_t));
+				}
+				if (Value && OldBits % BitsPerWord != 0)
+				{
+					Words[OldBits / BitsPerWord] |= ~uint64_t(0) << (OldBits % BitsPerWord);  ///< Completar la antigua ltima palabra.
+				}
+				NumWords = NewWords;
+			}
+			NumBits = Bits;
+			NumWords = WordsFor(Bits);
+			if (NumWords > 0)
+			{
+				TrimLastWord();
+			}
+		}
+
+		/**
+		 * @brief Aade un bit al final.
+		 */
+		void Add(bool Value)
+		{
+			if (NumBits == Capacity * BitsPerWord)
+			{
+				Reserve(Capacity == 0 ? BitsPerWord : Capacity * 2 * BitsPerWord);
+			}
+			if (NumBits % BitsPerWord == 0)
+			{
+				Words[NumWords++] = 0;
+			}
+			if (Value)
+			{
+				Words[NumBits / BitsPerWord] |= uint64_t(1) << (NumBits % BitsPerWord);
+			}
+			++NumBits;
+		}
+
+		/**
+		 * @brief Pone a 1 el bit Index.
+		 */
+		void SetBit(size_t Index)
+		{
+			Words[Index / BitsPerWord] |= uint64_t(1) << (Index % BitsPerWord);
+		}
+
+		/**
+		 * @brief Pone a 0 el bit Index.
+		 */
+		void ClearBit(size_t Index)
+		{
+			Words[Index / BitsPerWord] &= ~(uint64_t(1) << (Index % BitsPerWord));
+		}
+
+		/**
+		 * @brief Asigna Value al bit Index.
+		 */
+		void SetBit(size_t Index, bool Value)
+		{
+			Value ? SetBit(Index) : ClearBit(Index);
+		}
+
+		/**
+		 * @brief Devuelve el valor del bit Index.
+		 */
+		bool IsSet(size_t Index) const
+		{
+			return (Words[Index / BitsPerWord] >> (Index % BitsPerWord)) & 1u;
+		}
+
+		bool operator[](size_t Index) const
+		{
+			return IsSet(Index);
+		}
+
+		/**
+		 * @brief Asigna Value a todos los bits.
+		 */
+		void SetAll(bool Value)
+		{
+			if (NumWords > 0)
+			{
+				std::memset(Words, Value ? 0xFF : 0x00, NumWords * sizeof(uint64_t));
+				TrimLastWord();
+			}
+		}
+
+		/**
+		 * @brief Devuelve el ndice del primer bit a 1 a partir de From, o InvalidIndex.
+		 */
+		size_t FindFirstSet(size_t From = 0) const
+		{
+			return FindFirst<false>(From);
+		}
+
+		/**
+		 * @brief Devuelve el ndice del primer bit a 0 a partir de From, o InvalidIndex.
+		 */
+		size_t FindFirstClear(size_t From = 0) const
+		{
+			return FindFirst<true>(From);
+		}
+
+		/**
+		 * @brief Cuenta los bits a 1.
+		 */
+		size_t CountSet() const
+		{
+			size_t Count = 0;
+			for (size_t i = 0; i < NumWords; ++i)
+			{
+				Count += PopCount64(Words[i]);
+			}
+			return Count;
+		}
+
+		/**
+		 * @brief Indica si hay algn bit a 1.
+		 */
+		bool Any() const
+		{
+			for (size_t i = 0; i < NumWords; ++i)
+			{
+				if (Words[i] != 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * @brief this = this AND Other. Los bits fuera del rango de Other quedan a 0.
+		 */
+		void And(const TBitArray& Other)
+		{
+			Combine<BitOp::And>(Other);
+			for (size_t i = Other.NumWords; i < NumWords; ++i)
+			{
+				Words[i] = 0;
+			}
+		}
+
+		/**
+		 * @brief this = this OR Other (solo sobre los bits comunes).
+		 */
+		void Or(const TBitArray& Other)
+		{
+			Combine<BitOp::Or>(Other);
+			if (NumWords > 0)
+			{
+				TrimLastWord();
+			}
+		}
+
+		/**
+		 * @brief this = this AND NOT Other (solo sobre los bits comunes).
+		 */
+		void AndNot(const TBitArray& Other)
+		{
+			Combine<BitOp::AndNot>(Other);
+		}
+
+		/**
+		 * @brief Comprueba si todos los bits a 1 de Other tambin estn a 1 aqu.
+		 *
+		 * Es la prueba de firma habitual: Entity.Signature.Contains(Query).
+		 */
+		bool Contains(const TBitArray& Other) const
+		{
+			for (size_t i = 0; i < Other.NumWords; ++i)
+			{
+				const uint64_t Mine = i < NumWords ? Words[i] : 0;
+				if ((Other.Words[i] & ~Mine) != 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		TBitArray& operator&=(const TBitArray& Other) { And(Other); return *this; }
+		TBitArray& operator|=(const TBitArray& Other) { Or(Other); return *this; }
+
+		/**
+		 * @brief Devuelve un rango para recorrer los ndices de los bits a 1.
+		 *
+		 * El rango guarda una referencia al array, as que no se puede pedir sobre un temporal:
+		 * en un range-for el temporal se destruira antes de recorrerlo.
+		 */
+		SetBitRange SetBits() const&
+		{
+			return SetBitRange{ *this };
+		}
+		SetBitRange SetBits() const&& = delete;
+
+		/**
+		 * @brief Devuelve el nmero de bits.
+		 */
+		size_t Num() const
+		{
+			return NumBits;
+		}
+
+		/**
+		 * @brief Acceso directo a las palabras (NumWords() palabras de 64 bits).
+		 */
+		uint64_t* GetWords() { return Words; }
+		const uint64_t* GetWords() const { return Words; }
+		size_t GetNumWords() const { return NumWords; }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TBitArray Example
+		TBitArray Visible(1000);
+		Visible.SetBit(3);
+		Visible.SetBit(700);
+
+		TBitArray Lit(1000, true);
+		Lit.ClearBit(700);
+
+		Visible.And(Lit);
+		for (size_t Index : Visible.SetBits())
+		{
+			std::cout << Index << " ";    // 3
+		}
+		std::cout << std::endl;
+
+		std::cout << "Count: " << Visible.CountSet() << ", First free: " << Visible.FindFirstClear() << std::endl;
+
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace EU {
+	/**
+	 * @brief Functor de hash por defecto para los contenedores hash de EngineUtilities.
+	 *
+	 * Delega en std::hash<T>. Los tipos propios del motor pueden especializar THash
+	 * para proporcionar su propio hash sin depender de la biblioteca estndar.
+	 *
+	 * @tparam T El tipo a hashear.
+	 */
+	template<typename T>
+	struct THash
+	{
+		size_t operator()(const T& Value) const
+		{
+			return std::hash<T>{}(Value);
+		}
+	};
+
+	/**
+	 * @brief Mezcla los bits de un hash para repartirlo uniformemente.
+	 *
+	 * Muchos hashers (por ejemplo std::hash<int>) devuelven la identidad. Las tablas de
+	 * direccionamiento abierto indexan con los bits bajos, as que sin esta mezcla claves
+	 * consecutivas o alineadas caeran en los mismos grupos. Usa el finalizador de splitmix64.
+	 *
+	 * @param Hash El hash original.
+	 * @return El hash mezclado.
+	 */
+	inline uint64_t MixHash(uint64_t Hash)
+	{
+		Hash ^= Hash >> 30;
+		Hash *= 0xbf58476d1ce4e5b9ULL;
+		Hash ^= Hash >> 27;
+		Hash *= 0x94d049bb133111ebULL;
+		Hash ^= Hash >> 31;
+		return Hash;
+	}
+
+	/**
+	 * @brief Comparador de igualdad por defecto para los contenedores hash.
+	 *
+	 * @tparam T El tipo a comparar.
+	 */
+	template<typename T>
+	struct TEqualTo
+	{
+		bool operator()(const T& A, const T& B) const
+		{
+			return A == B;
+		}
+	};
+}
@@ -0,0 +1,373 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "TArray.h"
+
+namespace EU {
+	/**
+	 * @brief TInlineArray es un array dinmico que guarda sus primeros N elementos dentro del propio objeto.
+	 *
+	 * Mientras el nmero de elementos no supera N no se reserva memoria en el heap; al pasar de N
+	 * los elementos se reubican a un bloque dinmico y el array se comporta igual que TArray.
+	 * Pensado para listas pequeas y frecuentes (componentes de una entidad, esquinas de un polgono).
+	 * Ofrece la misma interfaz que TArray.
+	 *
+	 * @tparam T El tipo de elementos almacenados en el array.
+	 * @tparam N El nmero de elementos que caben sin reservar memoria dinmica.
+	 */
+	template<typename T, size_t N>
+	class TInlineArray
+	{
+		static_assert(N > 0, "TInlineArray necesita al menos un elemento en linea");
+
+	private:
+		T* Data;           ///< Apunta al almacenamiento en lnea o al bloque dinmico.
+		size_t Capacity;   ///< Capacidad actual (N mientras se usa el almacenamiento en lnea).
+		size_t Size;       ///< Nmero de elementos actualmente en el array.
+		alignas(T) unsigned char InlineStorage[N * sizeof(T)];  ///< Memoria sin construir para los primeros N elementos.
+
+		T* InlineData()
+		{
+			return reinterpret_cast<T*>(InlineStorage);
+		}
+
+		/**
+		 * @brief Reubica los elementos en un bloque dinmico con la capacidad indicada.
+		 *
+		 * @param NewCapacity La nueva capacidad del array (mayor que N).
+		 */
+		void Reallocate(size_t NewCapacity)
+		{
+			T* NewData = ArrayMemory::Allocate<T>(NewCapacity);
+			ArrayMemory::Relocate(Data, NewData, Size);
+			ReleaseHeap();
+			Data = NewData;
+			Capacity = NewCapacity;
+		}
+
+		/**
+		 * @brief Libera el bloque dinmico si existe (los elementos ya deben estar destruidos o reubicados).
+		 */
+		void ReleaseHeap()
+		{
+			if (!IsInline())
+			{
+				ArrayMemory::Deallocate(Data);
+			}
+		}
+
+		/**
+		 * @brief Toma los elementos de Other, robando su bloque dinmico si lo tiene.
+		 */
+		void MoveFrom(TInlineArray& Other)
+		{
+			if (Other.IsInline())
+			{
+				ArrayMemory::Relocate(Other.Data, InlineData(), Other.Size);
+				Data = InlineData();
+				Capacity = N;
+			}
+			else
+			{
+				Data = Other.Data;
+				Capacity = Other.Capacity;
+			}
+			Size = Other.Size;
+			Other.Data = Other.InlineData();
+			Other.Capacity = N;
+			Other.Size = 0;
+		}
+
+	public:
+		/**
+		 * @brief Constructor por defecto; el array empieza vaco usando el almacenamiento en lnea.
+		 */
+		TInlineArray() : Data(InlineData()), Capacity(N), Size(0) {}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TInlineArray(const TInlineArray& Other) : Data(InlineData()), Capacity(N), Size(0)
+		{
+			Reserve(Other.Size);
+			for (size_t i = 0; i < Other.Size; ++i)
+			{
+				new (Data + i) T(Other.Data[i]);
+			}
+			Size = Other.Size;
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TInlineArray(TInlineArray&& Other) noexcept(std::is_nothrow_move_constructible<T>::value)
+			: Data(InlineData()), Capacity(N), Size(0)
+		{
+			MoveFrom(Other);
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TInlineArray& operator=(const TInlineArray& Other)
+		{
+			if (this != &Other)
+			{
+				TInlineArray Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TInlineArray& operator=(TInlineArray&& Other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		{
+			if (this != &Other)
+			{
+				Clear();
+				ReleaseHeap();
+				MoveFrom(Other);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor que destruye los elementos y libera el bloque dinmico si existe.
+		 */
+		~TInlineArray()
+		{
+			Clear();
+			ReleaseHeap();
+		}
+
+		/**
+		 * @brief Construye un nuevo elemento al final del array a partir de sus argumentos.
+		 *
+		 * @return Referencia al elemento construido.
+		 */
+		template<typename... Args>
+		T& Emplace(Args&&... args)
+		{
+			if (Size == Capacity)
+			{
+				const size_t NewCapacity = Capacity * 2;
+				T* NewData = ArrayMemory::Allocate<T>(NewCapacity);
+				new (NewData + Size) T(std::forward<Args>(args)...);  ///< Construir antes de reubicar por si los argumentos apuntan al array.
+				ArrayMemory::Relocate(Data, NewData, Size);
+				ReleaseHeap();
+				Data = NewData;
+				Capacity = NewCapacity;
+			}
+			else
+			{
+				new (Data + Size) T(std::forward<Args>(args)...);
+			}
+			return Data[Size++];
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array.
+		 *
+		 * @param Element El elemento a aadir al array.
+		 */
+		void Add(const T& Element)
+		{
+			Emplace(Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array movindolo.
+		 *
+		 * @param Element El elemento a mover al array.
+		 */
+		void Add(T&& Element)
+		{
+			Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Reserva memoria para al menos NewCapacity elementos; no hace nada si caben en lnea.
+		 *
+		 * @param NewCapacity La capacidad mnima deseada.
+		 */
+		void Reserve(size_t NewCapacity)
+		{
+			if (NewCapacity > Capacity)
+			{
+				Reallocate(NewCapacity);
+			}
+		}
+
+		/**
+		 * @brief Elimina el elemento en la posicin especificada conservando el orden.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAt(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				return;
+			}
+			for (size_t i = Index; i < Size - 1; ++i)
+			{
+				Data[i] = std::move(Data[i + 1]);
+			}
+			Data[Size - 1].~T();
+			--Size;
+		}
+
+		/**
+		 * @brief Elimina el elemento en la posicin especificada moviendo el ltimo a su lugar.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAtSwap(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				return;
+			}
+			if (Index != Size - 1)
+			{
+				Data[Index] = std::move(Data[Size - 1]);
+			}
+			Data[Size - 1].~T();
+			--Size;
+		}
+
+		/**
+		 * @brief Destruye todos los elementos conservando la memoria reservada.
+		 */
+		void Clear()
+		{
+			ArrayMemory::Destroy(Data, Size);
+			Size = 0;
+		}
+
+		/**
+		 * @brief Sobrecarga del operador [] para acceder a elementos por ndice.
+		 *
+		 * @param Index La posicin del elemento a acceder.
+		 * @return Referencia al elemento en la posicin especificada.
+		 */
+		T& operator[](size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				exit(1);
+			}
+			return Data[Index];
+		}
+
+		/**
+		 * @brief Versin constante de la sobrecarga del operador [].
+		 *
+		 * @param Index La posicin del elemento a acceder.
+		 * @return Referencia constante al elemento en la posicin especificada.
+		 */
+		const T& operator[](size_t Index) const
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				exit(1);
+			}
+			return Data[Index];
+		}
+
+		/**
+		 * @brief Devuelve el nmero de elementos actualmente en el array.
+		 */
+		size_t Num() const
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Devuelve la capacidad actual del array.
+		 */
+		size_t GetCapacity() const
+		{
+			return Capacity;
+		}
+
+		/**
+		 * @brief Indica si los elementos siguen en el almacenamiento en lnea.
+		 */
+		bool IsInline() const
+		{
+			return Data == reinterpret_cast<const T*>(InlineStorage);
+		}
+
+		/**
+		 * @brief Devuelve un puntero a los elementos contiguos del array.
+		 */
+		T* GetData() { return Data; }
+		const T* GetData() const { return Data; }
+
+		/**
+		 * @brief Iteradores para recorrer el array con range-for.
+		 */
+		T* begin() { return Data; }
+		T* end() { return Data + Size; }
+		const T* begin() const { return Data; }
+		const T* end() const { return Data + Size; }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TInlineArray Example
+		TInlineArray<int, 4> Corners;
+		Corners.Add(0);
+		Corners.Add(1);
+		Corners.Add(2);
+		Corners.Add(3);    // Todava en lnea, sin reservas dinmicas.
+		Corners.Add(4);    // Pasa de N: se reubica al heap.
+
+		for (int Value : Corners)
+		{
+			std::cout << Value << " ";
+		}
+		std::cout << std::endl;
+
+		std::cout << "Inline: " << Corners.IsInline() << ", Capacity: " << Corners.GetCapacity() << std::endl;
+
+		return 0;
+	}
+	*/
+}
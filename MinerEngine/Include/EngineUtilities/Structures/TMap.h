@@ -1,156 +1,499 @@
-/*
- * MIT License
- *
- * Copyright (c) 2025 Roberto Charreton
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * In addition, any project or software that uses this library or class must include
- * the following acknowledgment in the credits:
- *
- * "This project uses software developed by Roberto Charreton and Attribute Overload."
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
-*/
 #pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <utility>
+#include "THash.h"
+#include "EngineUtilities/Memory/MemoryTracker.h"
+
 namespace EU {
 	/**
-	 * @brief TMap es una clase de mapa (diccionario) dinmica para almacenar pares clave-valor.
+	 * @brief TMap es una tabla hash de direccionamiento abierto para almacenar pares clave-valor.
+	 *
+	 * Los pares se guardan en un nico arreglo contiguo de ranuras y se resuelven las colisiones
+	 * con sondeo lineal "Robin Hood": cada ranura lleva un byte de control con su distancia de sondeo,
+	 * y al insertar se desplaza a los elementos que estn ms cerca de su ranura ideal. Esto mantiene
+	 * las secuencias de sondeo cortas, permite cortar la bsqueda en cuanto la distancia deja de cuadrar
+	 * y hace que eliminar sea un desplazamiento hacia atrs sin lpidas.
 	 *
-	 * Esta implementacin de TMap proporciona una forma sencilla de almacenar y gestionar
-	 * colecciones de pares clave-valor, con operaciones bsicas como agregar, eliminar y acceder a valores.
-	 * La memoria se gestiona dinmicamente, aumentando la capacidad del mapa segn sea necesario.
+	 * Aadir, buscar y eliminar son O(1) en promedio. La capacidad es siempre una potencia de dos
+	 * y la tabla crece al superar un factor de carga de 0.8.
 	 *
 	 * @tparam K El tipo de las claves.
 	 * @tparam V El tipo de los valores.
+	 * @tparam Hasher Functor que calcula el hash de una clave (por defecto THash<K>).
+	 * @tparam KeyEqual Functor que compara dos claves (por defecto TEqualTo<K>).
 	 */
-	template<typename K, typename V>
+	template<typename K, typename V, typename Hasher = THash<K>, typename KeyEqual = TEqualTo<K>>
 	class TMap
 	{
-	private:
+	public:
+		/**
+		 * @brief Par clave-valor almacenado en el mapa.
+		 *
+		 * La clave no debe modificarse a travs de un iterador, ya que rompera la tabla.
+		 */
 		struct Pair
 		{
 			K Key;
 			V Value;
 
-			Pair() : Key(), Value() {}
 			Pair(const K& Key, const V& Value) : Key(Key), Value(Value) {}
+			Pair(K&& Key, V&& Value) : Key(std::move(Key)), Value(std::move(Value)) {}
 		};
 
-		Pair* Data;        ///< Puntero a la memoria donde se almacenan los pares clave-valor.
-		size_t Capacity;   ///< Capacidad actual del mapa (nmero de pares que puede almacenar).
+	private:
+		static constexpr uint8_t EmptySlot = 0;      ///< Valor de control de una ranura vaca.
+		static constexpr uint8_t MaxDistance = 255;  ///< Distancia de sondeo mxima representable.
+		static constexpr size_t MinCapacity = 8;     ///< Capacidad mnima al reservar memoria.
+
+		Pair* Slots;       ///< Ranuras de la tabla (memoria sin construir donde Distances es 0).
+		uint8_t* Distances;///< Bytes de control: 0 si la ranura est vaca, distancia de sondeo + 1 si est ocupada.
+		size_t Capacity;   ///< Nmero de ranuras de la tabla (potencia de dos).
 		size_t Size;       ///< Nmero de pares actualmente en el mapa.
+		Hasher Hash;       ///< Functor de hash.
+		KeyEqual Equal;    ///< Functor de igualdad.
+
+		/**
+		 * @brief Calcula la ranura ideal de una clave.
+		 */
+		size_t HomeSlot(const K& Key) const
+		{
+			return static_cast<size_t>(MixHash(static_cast<uint64_t>(Hash(Key)))) & (Capacity - 1);
+		}
+
+		/**
+		 * @brief Busca la ranura que contiene la clave.
+		 *
+		 * @return El ndice de la ranura o Capacity si la clave no existe.
+		 */
+		size_t FindIndex(const K& Key) const
+		{
+			if (Size == 0)
+			{
+				return Capacity;
+			}
+			const size_t Mask = Capacity - 1;
+			size_t Index = HomeSlot(Key);
+			unsigned Distance = 1;
+			while (Distances[Index] >= Distance)
+			{
+				if (Distances[Index] == Distance && Equal(Slots[Index].Key, Key))
+				{
+					return Index;
+				}
+				Index = (Index + 1) & Mask;
+				++Distance;
+			}
+			return Capacity;  ///< Una ranura ms "pobre" que nosotros indica que la clave no est.
+		}
+
+		/**
+		 * @brief Inserta un par cuya clave se sabe que no est en el mapa.
+		 *
+		 * Localiza el punto de insercin Robin Hood y desplaza una posicin hacia la derecha
+		 * el tramo ocupado que le sigue. Si algn elemento superara MaxDistance se hace crecer
+		 * la tabla y se reintenta, de modo que nunca se deja la tabla a medio modificar.
+		 *
+		 * @return El ndice donde qued el nuevo par.
+		 */
+		size_t InsertUnique(Pair&& NewPair)
+		{
+			for (;;)
+			{
+				const size_t Mask = Capacity - 1;
+				size_t Index = HomeSlot(NewPair.Key);
+				unsigned Distance = 1;
+				while (Distances[Index] >= Distance)
+				{
+					Index = (Index + 1) & Mask;
+					++Distance;
+				}
+
+				size_t End = Index;
+				bool bOverflow = Distance >= MaxDistance;
+				while (!bOverflow && Distances[End] != EmptySlot)
+				{
+					bOverflow = Distances[End] == MaxDistance - 1;
+					End = (End + 1) & Mask;
+				}
+				if (bOverflow)
+				{
+					Rehash(Capacity * 2);
+					continue;
+				}
+
+				while (End != Index)
+				{
+					const size_t Prev = (End - 1) & Mask;
+					new (&Slots[End]) Pair(std::move(Slots[Prev]));
+					Slots[Prev].~Pair();
+					Distances[End] = static_cast<uint8_t>(Distances[Prev] + 1);
+					End = Prev;
+				}
+				new (&Slots[Index]) Pair(std::move(NewPair));
+				Distances[Index] = static_cast<uint8_t>(Distance);
+				++Size;
+				return Index;
+			}
+		}
+
+		/**
+		 * @brief Elimina el par de la ranura indicada desplazando hacia atrs a sus sucesores.
+		 */
+		void EraseAt(size_t Index)
+		{
+			const size_t Mask = Capacity - 1;
+			Slots[Index].~Pair();
+			size_t Next = (Index + 1) & Mask;
+			while (Distances[Next] > 1)
+			{
+				new (&Slots[Index]) Pair(std::move(Slots[Next]));
+				Slots[Next].~Pair();
+				Distances[Index] = static_cast<uint8_t>(Distances[Next] - 1);
+				Index = Next;
+				Next = (Next + 1) & Mask;
+			}
+			Distances[Index] = EmptySlot;
+			--Size;
+		}
 
 		/**
-		 * @brief Redimensiona el mapa para tener una nueva capacidad.
+		 * @brief Redimensiona la tabla y reubica todos los pares existentes.
 		 *
-		 * @param NewCapacity La nueva capacidad del mapa.
+		 * @param NewCapacity La nueva capacidad (potencia de dos).
 		 */
-		void Resize(size_t NewCapacity)
+		void Rehash(size_t NewCapacity)
 		{
-			Pair* NewData = new Pair[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			Pair* OldSlots = Slots;
+			uint8_t* OldDistances = Distances;
+			const size_t OldCapacity = Capacity;
+
+			Slots = static_cast<Pair*>(TaggedMemory::Allocate(NewCapacity * sizeof(Pair), alignof(Pair)));
+			Distances = static_cast<uint8_t*>(TaggedMemory::Allocate(NewCapacity, 1));
+			std::memset(Distances, 0, NewCapacity);
+			Capacity = NewCapacity;
+			Size = 0;
+
+			for (size_t i = 0; i < OldCapacity; ++i)
 			{
-				NewData[i] = Data[i];  ///< Copiar los pares existentes al nuevo bloque de memoria.
+				if (OldDistances[i] != EmptySlot)
+				{
+					InsertUnique(std::move(OldSlots[i]));
+					OldSlots[i].~Pair();
+				}
 			}
-			delete[] Data;  ///< Liberar la memoria del mapa antiguo.
-			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
-			Capacity = NewCapacity;  ///< Actualizar la capacidad del mapa.
+			TaggedMemory::Free(OldSlots);
+			TaggedMemory::Free(OldDistances);
+		}
+
+		/**
+		 * @brief Asegura espacio para un par ms respetando el factor de carga.
+		 */
+		void GrowIfNeeded()
+		{
+			if (Capacity == 0)
+			{
+				Rehash(MinCapacity);
+			}
+			else if ((Size + 1) * 5 > Capacity * 4)
+			{
+				Rehash(Capacity * 2);
+			}
+		}
+
+		/**
+		 * @brief Destruye todos los pares y libera la memoria de la tabla.
+		 */
+		void Release()
+		{
+			Clear();
+			TaggedMemory::Free(Slots);
+			TaggedMemory::Free(Distances);
+			Slots = nullptr;
+			Distances = nullptr;
+			Capacity = 0;
 		}
 
 	public:
+		/**
+		 * @brief Iterador sobre los pares del mapa, en orden de ranura.
+		 */
+		template<typename PairType>
+		class TIterator
+		{
+		public:
+			TIterator(PairType* InSlots, const uint8_t* InDistances, size_t InIndex, size_t InCapacity)
+				: Slots(InSlots), Distances(InDistances), Index(InIndex), Capacity(InCapacity)
+			{
+				SkipEmpty();
+			}
+
+			PairType& operator*() const { return Slots[Index]; }
+			PairType* operator->() const { return &Slots[Index]; }
+
+			TIterator& operator++()
+			{
+				++Index;
+				SkipEmpty();
+				return *this;
+			}
+
+			bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+			bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+		private:
+			void SkipEmpty()
+			{
+				while (Index < Capacity && Distances[Index] == EmptySlot)
+				{
+					++Index;
+				}
+			}
+
+			PairType* Slots;
+			const uint8_t* Distances;
+			size_t Index;
+			size_t Capacity;
+		};
+
+		using Iterator = TIterator<Pair>;
+		using ConstIterator = TIterator<const Pair>;
+
 		/**
 		 * @brief Constructor por defecto que inicializa el mapa con capacidad y tamao cero.
 		 */
 		TMap()
-			: Data(nullptr), Capacity(0), Size(0)
+			: Slots(nullptr), Distances(nullptr), Capacity(0), Size(0), Hash(), Equal()
+		{
+		}
+
+		/**
+		 * @brief Constructor con un hasher y un comparador concretos.
+		 */
+		explicit TMap(const Hasher& InHash, const KeyEqual& InEqual = KeyEqual())
+			: Slots(nullptr), Distances(nullptr), Capacity(0), Size(0), Hash(InHash), Equal(InEqual)
 		{
 		}
 
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TMap(const TMap& Other)
+			: Slots(nullptr), Distances(nullptr), Capacity(0), Size(0), Hash(Other.Hash), Equal(Other.Equal)
+		{
+			if (Other.Size > 0)
+			{
+				Rehash(Other.Capacity);
+				for (const Pair& Entry : Other)
+				{
+					InsertUnique(Pair(Entry.Key, Entry.Value));
+				}
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TMap(TMap&& Other) noexcept
+			: Slots(Other.Slots), Distances(Other.Distances), Capacity(Other.Capacity), Size(Other.Size),
+			  Hash(std::move(Other.Hash)), Equal(std::move(Other.Equal))
+		{
+			Other.Slots = nullptr;
+			Other.Distances = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TMap& operator=(const TMap& Other)
+		{
+			if (this != &Other)
+			{
+				TMap Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TMap& operator=(TMap&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Release();
+				Slots = Other.Slots;
+				Distances = Other.Distances;
+				Capacity = Other.Capacity;
+				Size = Other.Size;
+				Hash = std::move(Other.Hash);
+				Equal = std::move(Other.Equal);
+				Other.Slots = nullptr;
+				Other.Distances = nullptr;
+				Other.Capacity = 0;
+				Other.Size = 0;
+			}
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al mapa.
 		 */
 		~TMap()
 		{
-			delete[] Data;  ///< Liberar la memoria del mapa.
+			Release();  ///< Destruir los pares y liberar la memoria del mapa.
 		}
 
 		/**
 		 * @brief Aade un nuevo par clave-valor al mapa.
 		 *
+		 * Si la clave ya existe se actualiza su valor.
+		 *
 		 * @param Key La clave del nuevo par.
 		 * @param Value El valor del nuevo par.
+		 * @return Referencia al valor almacenado.
 		 */
-		void Add(const K& Key, const V& Value)
+		V& Add(const K& Key, const V& Value)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const size_t Index = FindIndex(Key);
+			if (Index != Capacity)
 			{
-				if (Data[i].Key == Key)
-				{
-					Data[i].Value = Value;  ///< Actualizar el valor si la clave ya existe.
-					return;
-				}
+				Slots[Index].Value = Value;  ///< Actualizar el valor si la clave ya existe.
+				return Slots[Index].Value;
+			}
+			Pair NewPair(Key, Value);  ///< Antes de crecer: Key o Value pueden ser de este mismo mapa.
+			GrowIfNeeded();
+			return Slots[InsertUnique(std::move(NewPair))].Value;
+		}
+
+		/**
+		 * @brief Aade un nuevo par clave-valor al mapa moviendo clave y valor.
+		 *
+		 * @param Key La clave del nuevo par.
+		 * @param Value El valor del nuevo par.
+		 * @return Referencia al valor almacenado.
+		 */
+		V& Add(K&& Key, V&& Value)
+		{
+			const size_t Index = FindIndex(Key);
+			if (Index != Capacity)
+			{
+				Slots[Index].Value = std::move(Value);
+				return Slots[Index].Value;
 			}
-			if (Size == Capacity)
+			Pair NewPair(std::move(Key), std::move(Value));
+			GrowIfNeeded();
+			return Slots[InsertUnique(std::move(NewPair))].Value;
+		}
+
+		/**
+		 * @brief Devuelve el valor asociado a la clave, crendolo por defecto si no existe.
+		 *
+		 * @param Key La clave buscada.
+		 * @return Referencia al valor asociado.
+		 */
+		V& FindOrAdd(const K& Key)
+		{
+			const size_t Index = FindIndex(Key);
+			if (Index != Capacity)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				return Slots[Index].Value;
 			}
-			Data[Size++] = Pair(Key, Value);  ///< Aadir el nuevo par y aumentar el tamao.
+			Pair NewPair(Key, V());
+			GrowIfNeeded();
+			return Slots[InsertUnique(std::move(NewPair))].Value;
 		}
 
 		/**
-		 * @brief Elimina el par clave-valor en la posicin especificada.
+		 * @brief Elimina el par asociado a la clave especificada.
 		 *
 		 * @param Key La clave del par a eliminar.
+		 * @return true si la clave exista y se elimin, false en caso contrario.
 		 */
-		void Remove(const K& Key)
+		bool Remove(const K& Key)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const size_t Index = FindIndex(Key);
+			if (Index == Capacity)
 			{
-				if (Data[i].Key == Key)
-				{
-					for (size_t j = i; j < Size - 1; ++j)
-					{
-						Data[j] = Data[j + 1];  ///< Desplazar los pares hacia la izquierda para llenar el hueco.
-					}
-					--Size;  ///< Disminuir el tamao del mapa.
-					return;
-				}
+				return false;  ///< La clave no est en el mapa.
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+			EraseAt(Index);
+			return true;
+		}
+
+		/**
+		 * @brief Busca el valor asociado a una clave.
+		 *
+		 * @param Key La clave buscada.
+		 * @return Puntero al valor o nullptr si la clave no existe.
+		 */
+		V* Find(const K& Key)
+		{
+			const size_t Index = FindIndex(Key);
+			return Index != Capacity ? &Slots[Index].Value : nullptr;
+		}
+
+		/**
+		 * @brief Versin constante de Find.
+		 */
+		const V* Find(const K& Key) const
+		{
+			const size_t Index = FindIndex(Key);
+			return Index != Capacity ? &Slots[Index].Value : nullptr;
+		}
+
+		/**
+		 * @brief Verifica si el mapa contiene la clave especificada.
+		 *
+		 * @param Key La clave buscada.
+		 * @return true si la clave existe, false en caso contrario.
+		 */
+		bool Contains(const K& Key) const
+		{
+			return FindIndex(Key) != Capacity;
+		}
+
+		/**
+		 * @brief Copia el valor asociado a una clave si existe.
+		 *
+		 * @param Key La clave buscada.
+		 * @param OutValue Recibe el valor si la clave existe; no se modifica en caso contrario.
+		 * @return true si la clave existe, false en caso contrario.
+		 */
+		bool TryGet(const K& Key, V& OutValue) const
+		{
+			const V* Value = Find(Key);
+			if (!Value)
+			{
+				return false;
+			}
+			OutValue = *Value;
+			return true;
 		}
 
 		/**
 		 * @brief Sobrecarga del operador [] para acceder a valores por clave.
 		 *
+		 * La clave debe existir; usar Find, TryGet o FindOrAdd cuando no se garantice.
+		 *
 		 * @param Key La clave del valor a acceder.
 		 * @return Referencia al valor asociado con la clave especificada.
 		 */
 		V& operator[](const K& Key)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			V* Value = Find(Key);
+			if (!Value)
 			{
-				if (Data[i].Key == Key)
-				{
-					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
-				}
+				std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+				exit(1);  ///< Salir del programa en caso de error.
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
-			exit(1);  ///< Salir del programa en caso de error.
+			return *Value;
 		}
 
 		/**
@@ -161,15 +504,47 @@ namespace EU {
 		 */
 		const V& operator[](const K& Key) const
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const V* Value = Find(Key);
+			if (!Value)
 			{
-				if (Data[i].Key == Key)
+				std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+				exit(1);  ///< Salir del programa en caso de error.
+			}
+			return *Value;
+		}
+
+		/**
+		 * @brief Reserva espacio para al menos Count pares sin volver a crecer.
+		 *
+		 * @param Count Nmero de pares esperado.
+		 */
+		void Reserve(size_t Count)
+		{
+			size_t NewCapacity = MinCapacity;
+			while (NewCapacity * 4 < Count * 5)
+			{
+				NewCapacity *= 2;
+			}
+			if (NewCapacity > Capacity)
+			{
+				Rehash(NewCapacity);
+			}
+		}
+
+		/**
+		 * @brief Elimina todos los pares conservando la memoria reservada.
+		 */
+		void Clear()
+		{
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				if (Distances[i] != EmptySlot)
 				{
-					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
+					Slots[i].~Pair();
+					Distances[i] = EmptySlot;
 				}
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
-			exit(1);  ///< Salir del programa en caso de error.
+			Size = 0;
 		}
 
 		/**
@@ -185,12 +560,17 @@ namespace EU {
 		/**
 		 * @brief Devuelve la capacidad actual del mapa.
 		 *
-		 * @return La capacidad del mapa.
+		 * @return El nmero de ranuras de la tabla.
 		 */
 		size_t GetCapacity() const
 		{
 			return Capacity;  ///< Devolver la capacidad actual del mapa.
 		}
+
+		Iterator begin() { return Iterator(Slots, Distances, 0, Capacity); }
+		Iterator end() { return Iterator(Slots, Distances, Capacity, Capacity); }
+		ConstIterator begin() const { return ConstIterator(Slots, Distances, 0, Capacity); }
+		ConstIterator end() const { return ConstIterator(Slots, Distances, Capacity, Capacity); }
 	};
 
 	// EXAMPLE
@@ -206,7 +586,17 @@ namespace EU {
 		MyMap.Remove(2);  ///< Eliminar el par con clave 2.
 
 		std::cout << "Key 1: " << MyMap[1] << std::endl;  ///< Acceder e imprimir el valor asociado con la clave 1.
-		std::cout << "Key 3: " << MyMap[3] << std::endl;  ///< Acceder e imprimir el valor asociado con la clave 3.
+
+		if (const std::string* Value = MyMap.Find(3))  ///< Buscar sin abortar si la clave no existe.
+		{
+			std::cout << "Key 3: " << *Value << std::endl;
+		}
+		std::cout << "Contains 2: " << MyMap.Contains(2) << std::endl;
+
+		for (const auto& Entry : MyMap)  ///< Recorrer todos los pares.
+		{
+			std::cout << Entry.Key << " -> " << Entry.Value << std::endl;
+		}
 
 		std::cout << "Size: " << MyMap.Num() << ", Capacity: " << MyMap.GetCapacity() << std::endl;  ///< Imprimir el tamao y la capacidad del mapa.
 
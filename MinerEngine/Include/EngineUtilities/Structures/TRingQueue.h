@@ -0,0 +1,398 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TArray.h"
+#include "EngineUtilities/Utilities/Platform.h"
+
+namespace EU {
+	/**
+	 * @brief Modo de concurrencia de un TRingQueue.
+	 */
+	enum class RingQueueMode
+	{
+		MPMC,  ///< Varios productores y varios consumidores.
+		SPSC   ///< Un nico productor y un nico consumidor.
+	};
+
+	/**
+	 * @brief Redondea hacia arriba a la siguiente potencia de dos (mnimo 2).
+	 */
+	inline size_t RingQueueCapacity(size_t Requested)
+	{
+		size_t Capacity = 2;
+		while (Capacity < Requested)
+		{
+			Capacity <<= 1;
+		}
+		return Capacity;
+	}
+
+	/**
+	 * @brief TRingQueue es una cola circular acotada y sin bloqueos para pasar datos entre hilos.
+	 *
+	 * La versin general admite varios productores y varios consumidores. Cada celda lleva un
+	 * nmero de secuencia que indica si est lista para escribirse o para leerse, de modo que
+	 * productores y consumidores solo compiten por un fetch/CAS sobre su propio ndice.
+	 * Los ndices de cabeza y cola viven en lneas de cach distintas (alignas(CacheLineSize))
+	 * para que productores y consumidores no invaliden la lnea del otro lado.
+	 *
+	 * TryPush y TryPop nunca bloquean: devuelven false si la cola est llena o vaca.
+	 *
+	 * En MPMC la celda se reclama antes de construir el elemento, y otros hilos esperan a que se
+	 * publique; una excepcin en ese punto bloqueara la cola para siempre. Por eso construir,
+	 * mover y destruir T no pueden lanzar (se comprueba en compilacin). Para tipos cuya copia
+	 * puede lanzar, construir el valor fuera y empujarlo con std::move.
+	 *
+	 * @tparam T El tipo de elementos de la cola.
+	 * @tparam Mode MPMC (por defecto) o SPSC.
+	 */
+	template<typename T, RingQueueMode Mode = RingQueueMode::MPMC>
+	class TRingQueue
+	{
+	private:
+		/**
+		 * @brief Celda de la cola: nmero de secuencia y espacio para un elemento.
+		 */
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			alignas(T) unsigned char Storage[sizeof(T)];
+
+			T* Element()
+			{
+				return reinterpret_cast<T*>(Storage);
+			}
+		};
+
+		Cell* Cells;        ///< Buffer circular de celdas.
+		size_t Mask;        ///< Capacidad - 1.
+
+		alignas(CacheLineSize) std::atomic<size_t> Tail;  ///< Siguiente posicin a escribir (productores).
+		alignas(CacheLineSize) std::atomic<size_t> Head;  ///< Siguiente posicin a leer (consumidores).
+
+	public:
+		/**
+		 * @brief Crea la cola con al menos Capacity posiciones (se redondea a potencia de dos).
+		 */
+		explicit TRingQueue(size_t Capacity) : Tail(0), Head(0)
+		{
+			const size_t RealCapacity = RingQueueCapacity(Capacity);
+			Mask = RealCapacity - 1;
+			Cells = ArrayMemory::Allocate<Cell>(RealCapacity);
+			for (size_t i = 0; i < RealCapacity; ++i)
+			{
+				new (&Cells[i].Sequence) std::atomic<size_t>(i);
+			}
+		}
+
+		TRingQueue(const TRingQueue&) = delete;
+		TRingQueue& operator=(const TRingQueue&) = delete;
+
+		/**
+		 * @brief Destruye los elementos pendientes y libera el buffer.
+		 */
+		~TRingQueue()
+		{
+			const size_t End = Tail.load(std::memory_order_relaxed);
+			for (size_t i = Head.load(std::memory_order_relaxed); i != End; ++i)
+			{
+				Cells[i & Mask].Element()->~T();
+			}
+			ArrayMemory::Deallocate(Cells);
+		}
+
+		/**
+		 * @brief Intenta construir un elemento al final de la cola.
+		 *
+		 * @return false si la cola est llena.
+		 */
+		template<typename... Args>
+		bool TryEmplace(Args&&... args)
+		{
+			static_assert(std::is_nothrow_constructible<T, Args&&...>::value,
+				"TRingQueue MPMC: construir T no puede lanzar (se hara tras reclamar la celda)");
+			size_t Position = Tail.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& Target = Cells[Position & Mask];
+				const size_t Sequence = Target.Sequence.load(std::memory_order_acquire);
+				const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Position);
+				if (Diff == 0)
+				{
+					if (Tail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					{
+						new (Target.Element()) T(std::forward<Args>(args)...);
+						Target.Sequence.store(Position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;  ///< La celda an no se ha consumido: cola llena.
+				}
+				else
+				{
+					Position = Tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		bool TryPush(const T& Element)
+		{
+			return TryEmplace(Element);
+		}
+
+		bool TryPush(T&& Element)
+		{
+			return TryEmplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Intenta sacar el primer elemento de la cola.
+		 *
+		 * @param Out Recibe el elemento (por movimiento).
+		 * @return false si la cola est vaca.
+		 */
+		bool TryPop(T& Out)
+		{
+			static_assert(std::is_nothrow_move_assignable<T>::value && std::is_nothrow_destructible<T>::value,
+				"TRingQueue MPMC: mover y destruir T no pueden lanzar (se hace tras reclamar la celda)");
+			size_t Position = Head.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& Target = Cells[Position & Mask];
+				const size_t Sequence = Target.Sequence.load(std::memory_order_acquire);
+				const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Position + 1);
+				if (Diff == 0)
+				{
+					if (Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					{
+						Out = std::move(*Target.Element());
+						Target.Element()->~T();
+						Target.Sequence.store(Position + Mask + 1, std::memory_order_release);  ///< Libre para la siguiente vuelta.
+						return true;
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;  ///< La celda an no se ha escrito: cola vaca.
+				}
+				else
+				{
+					Position = Head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * @brief Nmero aproximado de elementos (solo orientativo con otros hilos activos).
+		 */
+		size_t ApproxNum() const
+		{
+			const size_t CurrentTail = Tail.load(std::memory_order_relaxed);
+			const size_t CurrentHead = Head.load(std::memory_order_relaxed);
+			return CurrentTail >= CurrentHead ? CurrentTail - CurrentHead : 0;
+		}
+
+		/**
+		 * @brief Devuelve el nmero mximo de elementos.
+		 */
+		size_t GetCapacity() const
+		{
+			return Mask + 1;
+		}
+	};
+
+	/**
+	 * @brief Especializacin para un nico productor y un nico consumidor.
+	 *
+	 * Sin CAS ni secuencias por celda: cada lado es el nico escritor de su ndice y guarda una
+	 * copia local del ndice del otro lado, que solo vuelve a leer cuando la cola parece llena o vaca.
+	 * Cada ndice se publica despus de construir o mover el elemento, as que una excepcin
+	 * deja la cola intacta y T no necesita ser noexcept.
+	 *
+	 * @tparam T El tipo de elementos de la cola.
+	 */
+	template<typename T>
+	class TRingQueue<T, RingQueueMode::SPSC>
+	{
+	private:
+		T* Buffer;          ///< Memoria sin construir de Capacity elementos.
+		size_t Mask;        ///< Capacidad - 1.
+
+		alignas(CacheLineSize) std::atomic<size_t> Tail;  ///< Escrito solo por el productor.
+		size_t CachedHead;                                ///< Copia de Head del productor.
+
+		alignas(CacheLineSize) std::atomic<size_t> Head;  ///< Escrito solo por el consumidor.
+		size_t CachedTail;                                ///< Copia de Tail del consumidor.
+
+	public:
+		/**
+		 * @brief Crea la cola con al menos Capacity posiciones (se redondea a potencia de dos).
+		 */
+		explicit TRingQueue(size_t Capacity) : Tail(0), CachedHead(0), Head(0), CachedTail(0)
+		{
+			const size_t RealCapacity = RingQueueCapacity(Capacity);
+			Mask = RealCapacity - 1;
+			Buffer = ArrayMemory::Allocate<T>(RealCapacity);
+		}
+
+		TRingQueue(const TRingQueue&) = delete;
+		TRingQueue& operator=(const TRingQueue&) = delete;
+
+		/**
+		 * @brief Destruye los elementos pendientes y libera el buffer.
+		 */
+		~TRingQueue()
+		{
+			const size_t End = Tail.load(std::memory_order_relaxed);
+			for (size_t i = Head.load(std::memory_order_relaxed); i != End; ++i)
+			{
+				Buffer[i & Mask].~T();
+			}
+			ArrayMemory::Deallocate(Buffer);
+		}
+
+		/**
+		 * @brief Intenta construir un elemento al final de la cola (solo desde el hilo productor).
+		 *
+		 * @return false si la cola est llena.
+		 */
+		template<typename... Args>
+		bool TryEmplace(Args&&... args)
+		{
+			const size_t Position = Tail.load(std::memory_order_relaxed);
+			if (Position - CachedHead > Mask)
+			{
+				CachedHead = Head.load(std::memory_order_acquire);
+				if (Position - CachedHead > Mask)
+				{
+					return false;
+				}
+			}
+			new (Buffer + (Position & Mask)) T(std::forward<Args>(args)...);
+			Tail.store(Position + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool TryPush(const T& Element)
+		{
+			return TryEmplace(Element);
+		}
+
+		bool TryPush(T&& Element)
+		{
+			return TryEmplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Intenta sacar el primer elemento de la cola (solo desde el hilo consumidor).
+		 *
+		 * @param Out Recibe el elemento (por movimiento).
+		 * @return false si la cola est vaca.
+		 */
+		bool TryPop(T& Out)
+		{
+			const size_t Position = Head.load(std::memory_order_relaxed);
+			if (Position == CachedTail)
+			{
+				CachedTail = Tail.load(std::memory_order_acquire);
+				if (Position == CachedTail)
+				{
+					return false;
+				}
+			}
+			T& Element = Buffer[Position & Mask];
+			Out = std::move(Element);
+			Element.~T();
+			Head.store(Position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Nmero aproximado de elementos (solo orientativo con otros hilos activos).
+		 */
+		size_t ApproxNum() const
+		{
+			return Tail.load(std::memory_order_relaxed) - Head.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Devuelve el nmero mximo de elementos.
+		 */
+		size_t GetCapacity() const
+		{
+			return Mask + 1;
+		}
+	};
+
+	/**
+	 * @brief Alias para la cola de un productor y un consumidor.
+	 */
+	template<typename T>
+	using TSpscRingQueue = TRingQueue<T, RingQueueMode::SPSC>;
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TRingQueue Example
+		TRingQueue<int> Jobs(1024);
+
+		std::thread Producer([&Jobs]() {
+			for (int i = 0; i < 100; ++i)
+			{
+				while (!Jobs.TryPush(i)) { std::this_thread::yield(); }
+			}
+		});
+
+		int Received = 0;
+		int Value;
+		while (Received < 100)
+		{
+			if (Jobs.TryPop(Value))
+			{
+				++Received;
+			}
+		}
+		Producer.join();
+
+		std::cout << "Received: " << Received << std::endl;
+
+		return 0;
+	}
+	*/
+}
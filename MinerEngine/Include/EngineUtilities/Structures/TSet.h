@@ -1,123 +1,455 @@
-/*
- * MIT License
- *
- * Copyright (c) 2025 Roberto Charreton
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * In addition, any project or software that uses this library or class must include
- * the following acknowledgment in the credits:
- *
- * "This project uses software developed by Roberto Charreton and Attribute Overload."
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
-*/
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "THash.h"
+#include "EngineUtilities/Utilities/Platform.h"
+#include "EngineUtilities/Memory/MemoryTracker.h"
 
 namespace EU {
 	/**
-	 * @brief TSet es una clase de conjunto dinmica para almacenar elementos nicos.
+	 * @brief TSet es un conjunto hash para almacenar elementos nicos.
 	 *
-	 * Esta implementacin de TSet proporciona una forma sencilla de almacenar y gestionar
-	 * colecciones de elementos nicos, con operaciones bsicas como agregar, eliminar y verificar la existencia de elementos.
-	 * La memoria se gestiona dinmicamente, aumentando la capacidad del conjunto segn sea necesario.
+	 * Implementa una tabla de direccionamiento abierto al estilo "Swiss table": junto a las ranuras
+	 * se guarda un byte de control por elemento (vaco, borrado o los 7 bits bajos del hash).
+	 * Las ranuras se agrupan de 16 en 16 y cada sondeo compara los 16 bytes de control de un grupo
+	 * a la vez con SSE2 (con una ruta escalar equivalente en plataformas sin SSE2), de modo que
+	 * solo se compara el elemento completo cuando coinciden los 7 bits del hash.
+	 *
+	 * Aadir, buscar y eliminar son O(1) en promedio. Los elementos se construyen en memoria sin
+	 * inicializar, por lo que se admiten tipos que solo se pueden mover.
 	 *
 	 * @tparam T El tipo de los elementos almacenados en el conjunto.
+	 * @tparam Hasher Functor que calcula el hash de un elemento (por defecto THash<T>).
+	 * @tparam KeyEqual Functor que compara dos elementos (por defecto TEqualTo<T>).
 	 */
-	template<typename T>
+	template<typename T, typename Hasher = THash<T>, typename KeyEqual = TEqualTo<T>>
 	class TSet
 	{
 	private:
-		T* Data;        ///< Puntero a la memoria donde se almacenan los elementos.
-		size_t Capacity;   ///< Capacidad actual del conjunto (nmero de elementos que puede almacenar).
+		static constexpr size_t GroupWidth = 16;     ///< Ranuras por grupo de sondeo.
+		static constexpr int8_t CtrlEmpty = -128;    ///< Byte de control de una ranura vaca.
+		static constexpr int8_t CtrlDeleted = -2;    ///< Byte de control de una ranura borrada (lpida).
+
+		int8_t* Ctrl;      ///< Bytes de control, uno por ranura (>= 0 si est ocupada).
+		T* Slots;          ///< Ranuras de elementos (memoria sin construir donde no hay elemento).
+		size_t Capacity;   ///< Nmero de ranuras (potencia de dos, mltiplo de GroupWidth).
 		size_t Size;       ///< Nmero de elementos actualmente en el conjunto.
+		size_t GrowthLeft; ///< Ranuras vacas que an se pueden ocupar antes de crecer.
+		Hasher Hash;       ///< Functor de hash.
+		KeyEqual Equal;    ///< Functor de igualdad.
+
+		/**
+		 * @brief Mscara de bits de las ranuras del grupo cuyo byte de control es Value.
+		 */
+		static uint32_t MatchByte(const int8_t* Group, int8_t Value)
+		{
+#if EU_SSE2
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Group));
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8(Value))));
+#else
+			uint32_t Mask = 0;
+			for (uint32_t i = 0; i < GroupWidth; ++i)
+			{
+				Mask |= static_cast<uint32_t>(Group[i] == Value) << i;
+			}
+			return Mask;
+#endif
+		}
+
+		/**
+		 * @brief Mscara de bits de las ranuras del grupo vacas o borradas.
+		 */
+		static uint32_t MatchFree(const int8_t* Group)
+		{
+#if EU_SSE2
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Group))));
+#else
+			uint32_t Mask = 0;
+			for (uint32_t i = 0; i < GroupWidth; ++i)
+			{
+				Mask |= static_cast<uint32_t>(Group[i] < 0) << i;
+			}
+			return Mask;
+#endif
+		}
+
+		static uint64_t H1(uint64_t FullHash) { return FullHash >> 7; }
+		static int8_t H2(uint64_t FullHash) { return static_cast<int8_t>(FullHash & 0x7F); }
+
+		uint64_t HashOf(const T& Element) const
+		{
+			return MixHash(static_cast<uint64_t>(Hash(Element)));
+		}
+
+		/**
+		 * @brief Nmero mximo de elementos para una capacidad (factor de carga 7/8).
+		 */
+		static size_t MaxLoad(size_t InCapacity)
+		{
+			return InCapacity - InCapacity / 8;
+		}
+
+		/**
+		 * @brief Busca la ranura que contiene el elemento.
+		 *
+		 * @return El ndice de la ranura o Capacity si el elemento no existe.
+		 */
+		size_t FindIndex(const T& Element, uint64_t FullHash) const
+		{
+			if (Size == 0)
+			{
+				return Capacity;
+			}
+			const size_t GroupMask = Capacity / GroupWidth - 1;
+			const int8_t Tag = H2(FullHash);
+			size_t Group = static_cast<size_t>(H1(FullHash)) & GroupMask;
+			for (size_t Step = 1;; ++Step)
+			{
+				const int8_t* GroupCtrl = Ctrl + Group * GroupWidth;
+				for (uint32_t Match = MatchByte(GroupCtrl, Tag); Match != 0; Match &= Match - 1)
+				{
+					const size_t Index = Group * GroupWidth + CountTrailingZeros32(Match);
+					if (Equal(Slots[Index], Element))
+					{
+						return Index;
+					}
+				}
+				if (MatchByte(GroupCtrl, CtrlEmpty) != 0)
+				{
+					return Capacity;  ///< Un grupo con huecos vacos corta la secuencia de sondeo.
+				}
+				Group = (Group + Step) & GroupMask;  ///< Sondeo triangular: visita todos los grupos.
+			}
+		}
+
+		/**
+		 * @brief Reserva una ranura libre para un elemento nuevo con el hash dado.
+		 *
+		 * @return El ndice de la ranura, ya marcada como ocupada.
+		 */
+		size_t PrepareInsert(uint64_t FullHash)
+		{
+			if (GrowthLeft == 0)
+			{
+				// Si la mitad de la carga son lpidas basta con rehacer la tabla sin crecer.
+				Rehash(Size * 2 <= MaxLoad(Capacity) && Capacity > 0 ? Capacity : NextCapacity(Size + 1));
+			}
+			const size_t GroupMask = Capacity / GroupWidth - 1;
+			size_t Group = static_cast<size_t>(H1(FullHash)) & GroupMask;
+			for (size_t Step = 1;; ++Step)
+			{
+				const uint32_t Free = MatchFree(Ctrl + Group * GroupWidth);
+				if (Free != 0)
+				{
+					const size_t Index = Group * GroupWidth + CountTrailingZeros32(Free);
+					if (Ctrl[Index] == CtrlEmpty)
+					{
+						--GrowthLeft;
+					}
+					Ctrl[Index] = H2(FullHash);
+					++Size;
+					return Index;
+				}
+				Group = (Group + Step) & GroupMask;
+			}
+		}
 
 		/**
-		 * @brief Redimensiona el conjunto para tener una nueva capacidad.
+		 * @brief Capacidad mnima (potencia de dos) capaz de alojar Count elementos.
+		 */
+		static size_t NextCapacity(size_t Count)
+		{
+			size_t NewCapacity = GroupWidth;
+			while (MaxLoad(NewCapacity) < Count)
+			{
+				NewCapacity *= 2;
+			}
+			return NewCapacity;
+		}
+
+		/**
+		 * @brief Reconstruye la tabla con la capacidad indicada, descartando las lpidas.
 		 *
-		 * @param NewCapacity La nueva capacidad del conjunto.
+		 * @param NewCapacity La nueva capacidad (potencia de dos, mltiplo de GroupWidth).
 		 */
-		void Resize(size_t NewCapacity)
+		void Rehash(size_t NewCapacity)
 		{
-			T* NewData = new T[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			int8_t* OldCtrl = Ctrl;
+			T* OldSlots = Slots;
+			const size_t OldCapacity = Capacity;
+
+			Ctrl = static_cast<int8_t*>(TaggedMemory::Allocate(NewCapacity, 1));
+			std::memset(Ctrl, CtrlEmpty, NewCapacity);
+			Slots = static_cast<T*>(TaggedMemory::Allocate(NewCapacity * sizeof(T), alignof(T)));
+			Capacity = NewCapacity;
+			Size = 0;
+			GrowthLeft = MaxLoad(NewCapacity);
+
+			for (size_t i = 0; i < OldCapacity; ++i)
 			{
-				NewData[i] = Data[i];  ///< Copiar los elementos existentes al nuevo bloque de memoria.
+				if (OldCtrl[i] >= 0)
+				{
+					const size_t Index = PrepareInsert(HashOf(OldSlots[i]));
+					new (&Slots[Index]) T(std::move(OldSlots[i]));
+					OldSlots[i].~T();
+				}
 			}
-			delete[] Data;  ///< Liberar la memoria del conjunto antiguo.
-			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
-			Capacity = NewCapacity;  ///< Actualizar la capacidad del conjunto.
+			TaggedMemory::Free(OldCtrl);
+			TaggedMemory::Free(OldSlots);
+		}
+
+		/**
+		 * @brief Destruye todos los elementos y libera la memoria de la tabla.
+		 */
+		void Release()
+		{
+			Clear();
+			TaggedMemory::Free(Ctrl);
+			TaggedMemory::Free(Slots);
+			Ctrl = nullptr;
+			Slots = nullptr;
+			Capacity = 0;
+			GrowthLeft = 0;
+		}
+
+		/**
+		 * @brief Inserta un elemento si no existe, construyndolo a partir de Value.
+		 */
+		template<typename U>
+		bool InsertImpl(U&& Value)
+		{
+			const uint64_t FullHash = HashOf(Value);
+			if (FindIndex(Value, FullHash) != Capacity)
+			{
+				return false;  ///< No aadir duplicados.
+			}
+			const size_t Index = PrepareInsert(FullHash);
+			new (&Slots[Index]) T(std::forward<U>(Value));
+			return true;
 		}
 
 	public:
+		/**
+		 * @brief Iterador sobre los elementos del conjunto, en orden de ranura.
+		 */
+		class ConstIterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+
+			ConstIterator(const int8_t* InCtrl, const T* InSlots, size_t InIndex, size_t InCapacity)
+				: Ctrl(InCtrl), Slots(InSlots), Index(InIndex), Capacity(InCapacity)
+			{
+				SkipFree();
+			}
+
+			const T& operator*() const { return Slots[Index]; }
+			const T* operator->() const { return &Slots[Index]; }
+
+			ConstIterator& operator++()
+			{
+				++Index;
+				SkipFree();
+				return *this;
+			}
+
+			bool operator==(const ConstIterator& Other) const { return Index == Other.Index; }
+			bool operator!=(const ConstIterator& Other) const { return Index != Other.Index; }
+
+		private:
+			void SkipFree()
+			{
+				while (Index < Capacity && Ctrl[Index] < 0)
+				{
+					++Index;
+				}
+			}
+
+			const int8_t* Ctrl;
+			const T* Slots;
+			size_t Index;
+			size_t Capacity;
+		};
+
 		/**
 		 * @brief Constructor por defecto que inicializa el conjunto con capacidad y tamao cero.
 		 */
 		TSet()
-			: Data(nullptr), Capacity(0), Size(0)
+			: Ctrl(nullptr), Slots(nullptr), Capacity(0), Size(0), GrowthLeft(0), Hash(), Equal()
 		{
 		}
 
+		/**
+		 * @brief Constructor con un hasher y un comparador concretos.
+		 */
+		explicit TSet(const Hasher& InHash, const KeyEqual& InEqual = KeyEqual())
+			: Ctrl(nullptr), Slots(nullptr), Capacity(0), Size(0), GrowthLeft(0), Hash(InHash), Equal(InEqual)
+		{
+		}
+
+		/**
+		 * @brief Constructor de copia (solo disponible si T se puede copiar).
+		 */
+		TSet(const TSet& Other)
+			: Ctrl(nullptr), Slots(nullptr), Capacity(0), Size(0), GrowthLeft(0), Hash(Other.Hash), Equal(Other.Equal)
+		{
+			Reserve(Other.Size);
+			InsertRange(Other.begin(), Other.end());
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TSet(TSet&& Other) noexcept
+			: Ctrl(Other.Ctrl), Slots(Other.Slots), Capacity(Other.Capacity), Size(Other.Size),
+			  GrowthLeft(Other.GrowthLeft), Hash(std::move(Other.Hash)), Equal(std::move(Other.Equal))
+		{
+			Other.Ctrl = nullptr;
+			Other.Slots = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+			Other.GrowthLeft = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin de copia.
+		 */
+		TSet& operator=(const TSet& Other)
+		{
+			if (this != &Other)
+			{
+				TSet Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin de movimiento.
+		 */
+		TSet& operator=(TSet&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Release();
+				Ctrl = Other.Ctrl;
+				Slots = Other.Slots;
+				Capacity = Other.Capacity;
+				Size = Other.Size;
+				GrowthLeft = Other.GrowthLeft;
+				Hash = std::move(Other.Hash);
+				Equal = std::move(Other.Equal);
+				Other.Ctrl = nullptr;
+				Other.Slots = nullptr;
+				Other.Capacity = 0;
+				Other.Size = 0;
+				Other.GrowthLeft = 0;
+			}
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al conjunto.
 		 */
 		~TSet()
 		{
-			delete[] Data;  ///< Liberar la memoria del conjunto.
+			Release();  ///< Destruir los elementos y liberar la memoria del conjunto.
 		}
 
 		/**
 		 * @brief Aade un nuevo elemento al conjunto.
 		 *
 		 * @param Element El elemento a aadir.
+		 * @return true si se aadi, false si ya exista.
 		 */
-		void Add(const T& Element)
+		bool Add(const T& Element)
 		{
-			if (Contains(Element))
+			return InsertImpl(Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al conjunto movindolo.
+		 *
+		 * @param Element El elemento a aadir.
+		 * @return true si se aadi, false si ya exista (en ese caso Element no se mueve).
+		 */
+		bool Add(T&& Element)
+		{
+			return InsertImpl(std::move(Element));
+		}
+
+		/**
+		 * @brief Construye un elemento a partir de sus argumentos y lo aade al conjunto.
+		 *
+		 * @return true si se aadi, false si ya exista.
+		 */
+		template<typename... Args>
+		bool Emplace(Args&&... args)
+		{
+			return InsertImpl(T(std::forward<Args>(args)...));
+		}
+
+		/**
+		 * @brief Aade todos los elementos de un rango.
+		 *
+		 * Si los iteradores son de avance se reserva espacio una sola vez. Para mover elementos
+		 * de solo movimiento usar std::make_move_iterator.
+		 *
+		 * @param First Inicio del rango.
+		 * @param Last Fin del rango.
+		 * @return El nmero de elementos que se aadieron (sin contar duplicados).
+		 */
+		template<typename InputIt>
+		size_t InsertRange(InputIt First, InputIt Last)
+		{
+			using Category = typename std::iterator_traits<InputIt>::iterator_category;
+			if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value)
 			{
-				return;  ///< No aadir duplicados.
+				Reserve(Size + static_cast<size_t>(std::distance(First, Last)));
 			}
-			if (Size == Capacity)
+			size_t Added = 0;
+			for (; First != Last; ++First)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				Added += InsertImpl(*First) ? 1 : 0;
 			}
-			Data[Size++] = Element;  ///< Aadir el nuevo elemento y aumentar el tamao.
+			return Added;
 		}
 
 		/**
 		 * @brief Elimina el elemento especificado del conjunto.
 		 *
 		 * @param Element El elemento a eliminar.
+		 * @return true si el elemento exista y se elimin, false en caso contrario.
 		 */
-		void Remove(const T& Element)
+		bool Remove(const T& Element)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const size_t Index = FindIndex(Element, HashOf(Element));
+			if (Index == Capacity)
 			{
-				if (Data[i] == Element)
-				{
-					for (size_t j = i; j < Size - 1; ++j)
-					{
-						Data[j] = Data[j + 1];  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
-					}
-					--Size;  ///< Disminuir el tamao del conjunto.
-					return;
-				}
+				return false;  ///< El elemento no est en el conjunto.
 			}
-			std::cerr << "Element not found" << std::endl;  ///< Manejar el caso de elemento no encontrado.
+			Slots[Index].~T();
+			// Si el grupo tiene huecos vacos ningn sondeo lo atraviesa y no hace falta lpida.
+			const int8_t* GroupCtrl = Ctrl + (Index & ~(GroupWidth - 1));
+			if (MatchByte(GroupCtrl, CtrlEmpty) != 0)
+			{
+				Ctrl[Index] = CtrlEmpty;
+				++GrowthLeft;
+			}
+			else
+			{
+				Ctrl[Index] = CtrlDeleted;
+			}
+			--Size;
+			return true;
 		}
 
 		/**
@@ -129,14 +461,53 @@ namespace EU {
 		 */
 		bool Contains(const T& Element) const
 		{
-			for (size_t i = 0; i < Size; ++i)
+			return FindIndex(Element, HashOf(Element)) != Capacity;
+		}
+
+		/**
+		 * @brief Busca un elemento equivalente dentro del conjunto.
+		 *
+		 * @param Element El elemento buscado.
+		 * @return Puntero al elemento almacenado o nullptr si no existe.
+		 */
+		const T* Find(const T& Element) const
+		{
+			const size_t Index = FindIndex(Element, HashOf(Element));
+			return Index != Capacity ? &Slots[Index] : nullptr;
+		}
+
+		/**
+		 * @brief Reserva espacio para al menos Count elementos sin volver a crecer.
+		 *
+		 * @param Count Nmero de elementos esperado.
+		 */
+		void Reserve(size_t Count)
+		{
+			const size_t NewCapacity = NextCapacity(Count);
+			if (NewCapacity > Capacity)
+			{
+				Rehash(NewCapacity);
+			}
+		}
+
+		/**
+		 * @brief Elimina todos los elementos conservando la memoria reservada.
+		 */
+		void Clear()
+		{
+			for (size_t i = 0; i < Capacity; ++i)
 			{
-				if (Data[i] == Element)
+				if (Ctrl[i] >= 0)
 				{
-					return true;  ///< Devolver true si el elemento se encuentra.
+					Slots[i].~T();
 				}
 			}
-			return false;  ///< Devolver false si el elemento no se encuentra.
+			if (Capacity > 0)
+			{
+				std::memset(Ctrl, CtrlEmpty, Capacity);
+			}
+			Size = 0;
+			GrowthLeft = MaxLoad(Capacity);
 		}
 
 		/**
@@ -152,12 +523,15 @@ namespace EU {
 		/**
 		 * @brief Devuelve la capacidad actual del conjunto.
 		 *
-		 * @return La capacidad del conjunto.
+		 * @return El nmero de ranuras de la tabla.
 		 */
 		size_t GetCapacity() const
 		{
 			return Capacity;  ///< Devolver la capacidad actual del conjunto.
 		}
+
+		ConstIterator begin() const { return ConstIterator(Ctrl, Slots, 0, Capacity); }
+		ConstIterator end() const { return ConstIterator(Ctrl, Slots, Capacity, Capacity); }
 	};
 
 	// Example
@@ -170,11 +544,20 @@ namespace EU {
 		MySet.Add(2);
 		MySet.Add(3);
 
+		int More[] = { 3, 4, 5 };
+		MySet.InsertRange(More, More + 3);  ///< Aadir un rango; el 3 repetido se ignora.
+
 		MySet.Remove(2);  ///< Eliminar el elemento 2 del conjunto.
 
 		std::cout << "Contains 1: " << MySet.Contains(1) << std::endl;  ///< Verificar e imprimir si el conjunto contiene el elemento 1.
 		std::cout << "Contains 2: " << MySet.Contains(2) << std::endl;  ///< Verificar e imprimir si el conjunto contiene el elemento 2.
 
+		for (int Element : MySet)  ///< Recorrer los elementos.
+		{
+			std::cout << Element << " ";
+		}
+		std::cout << std::endl;
+
 		std::cout << "Size: " << MySet.Num() << ", Capacity: " << MySet.GetCapacity() << std::endl;  ///< Imprimir el tamao y la capacidad del conjunto.
 
 		return 0;
@@ -0,0 +1,333 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+#include "TArray.h"
+
+namespace EU {
+	/**
+	 * @brief Handle generacional de 32+32 bits que identifica un elemento de un TSlotMap<T>.
+	 *
+	 * El ndice apunta a la ranura y la generacin detecta si la ranura se ha liberado o
+	 * reutilizado desde que se cre el handle. Un handle construido por defecto nunca es vlido.
+	 *
+	 * @tparam T El tipo de elemento al que se refiere (evita mezclar handles de mapas distintos).
+	 */
+	template<typename T>
+	struct TSlotHandle
+	{
+		uint32_t Index = 0;       ///< Ranura del elemento en el mapa.
+		uint32_t Generation = 0;  ///< Generacin de la ranura cuando se cre el handle (0 = nulo).
+
+		bool IsNull() const
+		{
+			return Generation == 0;
+		}
+
+		bool operator==(const TSlotHandle& Other) const
+		{
+			return Index == Other.Index && Generation == Other.Generation;
+		}
+
+		bool operator!=(const TSlotHandle& Other) const
+		{
+			return !(*this == Other);
+		}
+	};
+
+	/**
+	 * @brief TSlotMap almacena elementos de forma contigua y los referencia mediante handles estables.
+	 *
+	 * Los elementos vivos estn empaquetados en un TArray denso, por lo que recorrerlos es tan
+	 * barato como recorrer un array. Cada handle pasa por una tabla de ranuras que traduce
+	 * ndice + generacin a la posicin densa actual; insertar, eliminar y buscar son O(1).
+	 * Eliminar mueve el ltimo elemento al hueco, as que los punteros a elementos no son estables,
+	 * pero los handles s: un handle de un elemento eliminado deja de resolverse.
+	 *
+	 * La generacin de cada ranura es impar mientras est ocupada y par mientras est libre.
+	 * Cuando una ranura agota sus 32 bits de generacin se retira: no vuelve a la lista libre,
+	 * as que un handle antiguo nunca puede coincidir con una generacin reciclada.
+	 *
+	 * @tparam T El tipo de elementos almacenados.
+	 */
+	template<typename T>
+	class TSlotMap
+	{
+	public:
+		using Handle = TSlotHandle<T>;
+
+	private:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+		/**
+		 * @brief Entrada de la tabla de ranuras.
+		 */
+		struct Slot
+		{
+			uint32_t Value;       ///< ndice denso si est ocupada, siguiente ranura libre si no.
+			uint32_t Generation;  ///< Impar si est ocupada.
+		};
+
+		TArray<T> Values;              ///< Elementos vivos, contiguos.
+		TArray<uint32_t> DenseToSlot;  ///< Ranura de cada elemento denso (para actualizarla al compactar).
+		TArray<Slot> Slots;            ///< Tabla de ranuras indexada por Handle::Index.
+		uint32_t FreeHead;             ///< Primera ranura libre o InvalidIndex.
+
+		/**
+		 * @brief Devuelve la posicin densa de un handle o InvalidIndex si ya no es vlido.
+		 */
+		uint32_t Resolve(Handle Key) const
+		{
+			if (Key.Index >= Slots.Num())
+			{
+				return InvalidIndex;
+			}
+			const Slot& Entry = Slots[Key.Index];
+			if (Entry.Generation != Key.Generation || (Entry.Generation & 1u) == 0)
+			{
+				return InvalidIndex;
+			}
+			return Entry.Value;
+		}
+
+		/**
+		 * @brief Ocupa una ranura para el elemento recin aadido al final de Values.
+		 */
+		Handle Bind()
+		{
+			const uint32_t DenseIndex = static_cast<uint32_t>(DenseToSlot.Num());
+			uint32_t SlotIndex;
+			if (FreeHead != InvalidIndex)
+			{
+				SlotIndex = FreeHead;
+				FreeHead = Slots[SlotIndex].Value;
+			}
+			else
+			{
+				SlotIndex = static_cast<uint32_t>(Slots.Num());
+				Slots.Add(Slot{ 0, 0 });
+			}
+			Slot& Entry = Slots[SlotIndex];
+			Entry.Value = DenseIndex;
+			++Entry.Generation;  ///< Par -> impar: ocupada.
+			DenseToSlot.Add(SlotIndex);
+			return Handle{ SlotIndex, Entry.Generation };
+		}
+
+		/**
+		 * @brief Libera una ranura ocupada y la devuelve a la lista libre.
+		 *
+		 * Si la generacin da la vuelta a 0 la ranura queda retirada para siempre.
+		 */
+		void Unbind(uint32_t SlotIndex)
+		{
+			Slot& Entry = Slots[SlotIndex];
+			++Entry.Generation;  ///< Impar -> par: libre.
+			if (Entry.Generation == 0)
+			{
+				Entry.Value = InvalidIndex;
+				return;
+			}
+			Entry.Value = FreeHead;
+			FreeHead = SlotIndex;
+		}
+
+	public:
+		/**
+		 * @brief Constructor por defecto que crea un mapa vaco.
+		 */
+		TSlotMap() : FreeHead(InvalidIndex) {}
+
+		/**
+		 * @brief Construye un elemento en el mapa a partir de sus argumentos.
+		 *
+		 * @return Handle del nuevo elemento.
+		 */
+		template<typename... Args>
+		Handle Emplace(Args&&... args)
+		{
+			Values.Emplace(std::forward<Args>(args)...);
+			return Bind();
+		}
+
+		/**
+		 * @brief Inserta una copia del elemento.
+		 *
+		 * @return Handle del nuevo elemento.
+		 */
+		Handle Insert(const T& Element)
+		{
+			return Emplace(Element);
+		}
+
+		/**
+		 * @brief Inserta el elemento movindolo.
+		 *
+		 * @return Handle del nuevo elemento.
+		 */
+		Handle Insert(T&& Element)
+		{
+			return Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Elimina el elemento referenciado por el handle.
+		 *
+		 * El ltimo elemento denso ocupa su lugar y la generacin de la ranura avanza,
+		 * invalidando todas las copias del handle.
+		 *
+		 * @return true si el handle era vlido y se elimin el elemento.
+		 */
+		bool Remove(Handle Key)
+		{
+			const uint32_t DenseIndex = Resolve(Key);
+			if (DenseIndex == InvalidIndex)
+			{
+				return false;
+			}
+			const uint32_t LastIndex = static_cast<uint32_t>(Values.Num() - 1);
+			if (DenseIndex != LastIndex)
+			{
+				const uint32_t MovedSlot = DenseToSlot[LastIndex];
+				Slots[MovedSlot].Value = DenseIndex;
+				DenseToSlot[DenseIndex] = MovedSlot;
+			}
+			Values.RemoveAtSwap(DenseIndex);
+			DenseToSlot.RemoveAtSwap(LastIndex);
+
+			Unbind(Key.Index);
+			return true;
+		}
+
+		/**
+		 * @brief Busca el elemento de un handle.
+		 *
+		 * @return Puntero al elemento o nullptr si el handle ya no es vlido.
+		 */
+		T* Find(Handle Key)
+		{
+			const uint32_t DenseIndex = Resolve(Key);
+			return DenseIndex == InvalidIndex ? nullptr : &Values[DenseIndex];
+		}
+
+		const T* Find(Handle Key) const
+		{
+			const uint32_t DenseIndex = Resolve(Key);
+			return DenseIndex == InvalidIndex ? nullptr : &Values[DenseIndex];
+		}
+
+		/**
+		 * @brief Comprueba si el handle sigue refirindose a un elemento vivo.
+		 */
+		bool Contains(Handle Key) const
+		{
+			return Resolve(Key) != InvalidIndex;
+		}
+
+		/**
+		 * @brief Devuelve el handle del elemento en la posicin densa indicada.
+		 *
+		 * til al recorrer el mapa cuando se necesita tambin el handle de cada elemento.
+		 */
+		Handle GetHandle(size_t DenseIndex) const
+		{
+			const uint32_t SlotIndex = DenseToSlot[DenseIndex];
+			return Handle{ SlotIndex, Slots[SlotIndex].Generation };
+		}
+
+		/**
+		 * @brief Reserva memoria para al menos Count elementos.
+		 */
+		void Reserve(size_t Count)
+		{
+			Values.Reserve(Count);
+			DenseToSlot.Reserve(Count);
+			Slots.Reserve(Count);
+		}
+
+		/**
+		 * @brief Elimina todos los elementos invalidando todos los handles emitidos.
+		 */
+		void Clear()
+		{
+			for (size_t i = 0; i < DenseToSlot.Num(); ++i)
+			{
+				Unbind(DenseToSlot[i]);
+			}
+			Values.Clear();
+			DenseToSlot.Clear();
+		}
+
+		/**
+		 * @brief Devuelve el nmero de elementos vivos.
+		 */
+		size_t Num() const
+		{
+			return Values.Num();
+		}
+
+		/**
+		 * @brief Acceso a los elementos vivos como array contiguo.
+		 */
+		T* GetData() { return Values.GetData(); }
+		const T* GetData() const { return Values.GetData(); }
+
+		/**
+		 * @brief Iteradores sobre los elementos vivos (orden denso, no de insercin).
+		 */
+		T* begin() { return Values.begin(); }
+		T* end() { return Values.end(); }
+		const T* begin() const { return Values.begin(); }
+		const T* end() const { return Values.end(); }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TSlotMap Example
+		TSlotMap<std::string> Names;
+		TSlotMap<std::string>::Handle A = Names.Insert("Actor");
+		TSlotMap<std::string>::Handle B = Names.Insert("Camera");
+
+		Names.Remove(A);
+		std::cout << (Names.Find(A) == nullptr) << std::endl;   // 1: el handle ya no es vlido.
+		std::cout << *Names.Find(B) << std::endl;              // Camera
+
+		for (const std::string& Name : Names)
+		{
+			std::cout << Name << " ";
+		}
+		std::cout << std::endl;
+
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,446 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "TArray.h"
+#include "TSpan.h"
+#include "EngineUtilities/Utilities/Platform.h"
+
+namespace EU {
+	/**
+	 * @brief TSoAArray guarda cada campo de sus elementos en su propio array contiguo (struct of arrays).
+	 *
+	 * Un TSoAArray<Vector3, Quaternion, Vector3> con posiciones, rotaciones y escalas permite que
+	 * un bucle que solo actualiza posiciones recorra nicamente ese flujo, en lugar de arrastrar
+	 * objetos completos por la cach. Cada flujo empieza alineado a CacheLineSize para que los
+	 * kernels SIMD puedan recorrerlo con cargas alineadas.
+	 *
+	 * @tparam Fields Los tipos de cada campo, en orden.
+	 */
+	template<typename... Fields>
+	class TSoAArray
+	{
+		static_assert(sizeof...(Fields) > 0, "TSoAArray necesita al menos un campo");
+
+	public:
+		static constexpr size_t NumFields = sizeof...(Fields);
+
+		template<size_t I>
+		using FieldType = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+		static constexpr size_t StreamAlignment = CacheLineSize;  ///< Alineacin del inicio de cada flujo.
+
+	private:
+		using Indices = std::index_sequence_for<Fields...>;
+
+		std::tuple<Fields*...> Streams;  ///< Un bloque de memoria por campo.
+		size_t Capacity;                 ///< Elementos que caben en cada flujo.
+		size_t Size;                     ///< Elementos construidos.
+
+		template<typename F>
+		static F* AllocateStream(size_t Count)
+		{
+			constexpr size_t Alignment = alignof(F) > StreamAlignment ? alignof(F) : StreamAlignment;
+			return static_cast<F*>(TaggedMemory::Allocate(Count * sizeof(F), Alignment));
+		}
+
+		template<typename F>
+		static void DeallocateStream(F* Stream)
+		{
+			TaggedMemory::Free(Stream);
+		}
+
+		template<size_t... I>
+		void Reallocate(size_t NewCapacity, std::index_sequence<I...>)
+		{
+			(ReallocateStream<I>(NewCapacity), ...);
+			Capacity = NewCapacity;
+		}
+
+		template<size_t I>
+		void ReallocateStream(size_t NewCapacity)
+		{
+			AdoptStream<I>(AllocateStream<FieldType<I>>(NewCapacity));
+		}
+
+		/**
+		 * @brief Mueve los Size elementos del flujo I a NewStream y libera el bloque anterior.
+		 */
+		template<size_t I>
+		void AdoptStream(FieldType<I>* NewStream)
+		{
+			FieldType<I>*& Stream = std::get<I>(Streams);
+			if (Stream != nullptr)
+			{
+				ArrayMemory::Relocate(Stream, NewStream, Size);
+				DeallocateStream(Stream);
+			}
+			Stream = NewStream;
+		}
+
+		/**
+		 * @brief Crece a NewCapacity construyendo el nuevo elemento antes de reubicar los existentes.
+		 *
+		 * Igual que TArray::Emplace: los argumentos pueden ser referencias a elementos del propio
+		 * array, as que deben leerse mientras los bloques viejos siguen intactos.
+		 */
+		template<size_t... I, typename... Args>
+		void GrowAndConstruct(size_t NewCapacity, std::index_sequence<I...>, Args&&... args)
+		{
+			std::tuple<Fields*...> NewStreams(AllocateStream<Fields>(NewCapacity)...);
+			(new (std::get<I>(NewStreams) + Size) FieldType<I>(std::forward<Args>(args)), ...);
+			(AdoptStream<I>(std::get<I>(NewStreams)), ...);
+			Capacity = NewCapacity;
+		}
+
+		template<size_t... I, typename... Args>
+		void ConstructAt(size_t Index, std::index_sequence<I...>, Args&&... args)
+		{
+			(new (std::get<I>(Streams) + Index) FieldType<I>(std::forward<Args>(args)), ...);
+		}
+
+		template<size_t... I>
+		void DestroyRange(size_t First, size_t Count, std::index_sequence<I...>)
+		{
+			(ArrayMemory::Destroy(std::get<I>(Streams) + First, Count), ...);
+		}
+
+		template<size_t... I>
+		void MoveLastTo(size_t Index, std::index_sequence<I...>)
+		{
+			((std::get<I>(Streams)[Index] = std::move(std::get<I>(Streams)[Size - 1])), ...);
+		}
+
+		template<size_t... I>
+		std::tuple<Fields&...> ElementAt(size_t Index, std::index_sequence<I...>)
+		{
+			return std::tuple<Fields&...>(std::get<I>(Streams)[Index]...);
+		}
+
+		template<size_t... I>
+		std::tuple<const Fields&...> ElementAt(size_t Index, std::index_sequence<I...>) const
+		{
+			return std::tuple<const Fields&...>(std::get<I>(Streams)[Index]...);
+		}
+
+		template<size_t... I>
+		void FreeStreams(std::index_sequence<I...>)
+		{
+			(DeallocateStream(std::get<I>(Streams)), ...);
+			Streams = std::tuple<Fields*...>();
+		}
+
+		template<size_t... I>
+		void CopyFrom(const TSoAArray& Other, std::index_sequence<I...>)
+		{
+			Reserve(Other.Size);
+			for (size_t i = 0; i < Other.Size; ++i)
+			{
+				(new (std::get<I>(Streams) + i) FieldType<I>(std::get<I>(Other.Streams)[i]), ...);
+			}
+			Size = Other.Size;
+		}
+
+	public:
+		/**
+		 * @brief Iterador que recorre todos los flujos a la vez; devuelve una tupla de referencias.
+		 *
+		 * Permite escribir: for (auto [Position, Velocity] : Particles) { Position += Velocity; }
+		 * Sobre un TSoAArray const las referencias son const.
+		 *
+		 * @tparam IsConst true para el iterador de solo lectura.
+		 */
+		template<bool IsConst>
+		class TZipIterator
+		{
+		private:
+			using OwnerType = typename std::conditional<IsConst, const TSoAArray, TSoAArray>::type;
+			using Reference = typename std::conditional<IsConst, std::tuple<const Fields&...>, std::tuple<Fields&...>>::type;
+
+			OwnerType* Owner;
+			size_t Index;
+
+		public:
+			TZipIterator(OwnerType* Owner, size_t Index) : Owner(Owner), Index(Index) {}
+
+			Reference operator*() const
+			{
+				return Owner->ElementAt(Index, Indices());
+			}
+
+			TZipIterator& operator++()
+			{
+				++Index;
+				return *this;
+			}
+
+			bool operator==(const TZipIterator& Other) const
+			{
+				return Index == Other.Index;
+			}
+
+			bool operator!=(const TZipIterator& Other) const
+			{
+				return Index != Other.Index;
+			}
+		};
+
+		using ZipIterator = TZipIterator<false>;
+		using ConstZipIterator = TZipIterator<true>;
+
+		/**
+		 * @brief Constructor por defecto que crea un array vaco.
+		 */
+		TSoAArray() : Streams(), Capacity(0), Size(0) {}
+
+		TSoAArray(const TSoAArray& Other) : Streams(), Capacity(0), Size(0)
+		{
+			CopyFrom(Other, Indices());
+		}
+
+		TSoAArray(TSoAArray&& Other) noexcept : Streams(Other.Streams), Capacity(Other.Capacity), Size(Other.Size)
+		{
+			Other.Streams = std::tuple<Fields*...>();
+			Other.Capacity = 0;
+			Other.Size = 0;
+		}
+
+		TSoAArray& operator=(const TSoAArray& Other)
+		{
+			if (this != &Other)
+			{
+				TSoAArray Copy(Other);
+				*this = std::move(Copy);
+			}
+			return *this;
+		}
+
+		TSoAArray& operator=(TSoAArray&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				FreeStreams(Indices());
+				Streams = Other.Streams;
+				Capacity = Other.Capacity;
+				Size = Other.Size;
+				Other.Streams = std::tuple<Fields*...>();
+				Other.Capacity = 0;
+				Other.Size = 0;
+			}
+			return *this;
+		}
+
+		~TSoAArray()
+		{
+			Clear();
+			FreeStreams(Indices());
+		}
+
+		/**
+		 * @brief Reserva memoria en todos los flujos para al menos NewCapacity elementos.
+		 */
+		void Reserve(size_t NewCapacity)
+		{
+			if (NewCapacity > Capacity)
+			{
+				Reallocate(NewCapacity, Indices());
+			}
+		}
+
+		/**
+		 * @brief Aade un elemento construyendo cada campo a partir del argumento correspondiente.
+		 *
+		 * @return ndice del nuevo elemento.
+		 */
+		template<typename... Args>
+		size_t Emplace(Args&&... Values)
+		{
+			static_assert(sizeof...(Args) == NumFields, "TSoAArray::Emplace necesita un valor por campo");
+			if (Size == Capacity)
+			{
+				GrowAndConstruct(Capacity == 0 ? 16 : Capacity * 2, Indices(), std::forward<Args>(Values)...);
+			}
+			else
+			{
+				ConstructAt(Size, Indices(), std::forward<Args>(Values)...);
+			}
+			return Size++;
+		}
+
+		/**
+		 * @brief Aade un elemento a partir de una tupla con un valor por campo.
+		 *
+		 * @return ndice del nuevo elemento.
+		 */
+		size_t Add(const std::tuple<Fields...>& Values)
+		{
+			return std::apply([this](const Fields&... Unpacked) { return Emplace(Unpacked...); }, Values);
+		}
+
+		size_t Add(std::tuple<Fields...>&& Values)
+		{
+			return std::apply([this](Fields&... Unpacked) { return Emplace(std::move(Unpacked)...); }, Values);
+		}
+
+		/**
+		 * @brief Elimina el elemento Index moviendo el ltimo a su lugar en todos los flujos.
+		 */
+		void RemoveAtSwap(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				return;
+			}
+			if (Index != Size - 1)
+			{
+				MoveLastTo(Index, Indices());
+			}
+			DestroyRange(Size - 1, 1, Indices());
+			--Size;
+		}
+
+		/**
+		 * @brief Destruye todos los elementos conservando la memoria reservada.
+		 */
+		void Clear()
+		{
+			DestroyRange(0, Size, Indices());
+			Size = 0;
+		}
+
+		/**
+		 * @brief Devuelve el flujo del campo I como vista contigua.
+		 */
+		template<size_t I>
+		TSpan<FieldType<I>> GetField()
+		{
+			return TSpan<FieldType<I>>(std::get<I>(Streams), Size);
+		}
+
+		template<size_t I>
+		TSpan<const FieldType<I>> GetField() const
+		{
+			return TSpan<const FieldType<I>>(std::get<I>(Streams), Size);
+		}
+
+		/**
+		 * @brief Acceso al campo I del elemento Index.
+		 */
+		template<size_t I>
+		FieldType<I>& Get(size_t Index)
+		{
+			return std::get<I>(Streams)[Index];
+		}
+
+		template<size_t I>
+		const FieldType<I>& Get(size_t Index) const
+		{
+			return std::get<I>(Streams)[Index];
+		}
+
+		/**
+		 * @brief Devuelve todos los campos del elemento Index como tupla de referencias.
+		 */
+		std::tuple<Fields&...> operator[](size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				exit(1);
+			}
+			return ElementAt(Index, Indices());
+		}
+
+		std::tuple<const Fields&...> operator[](size_t Index) const
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;
+				exit(1);
+			}
+			return ElementAt(Index, Indices());
+		}
+
+		/**
+		 * @brief Devuelve el nmero de elementos.
+		 */
+		size_t Num() const
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Devuelve la capacidad de cada flujo.
+		 */
+		size_t GetCapacity() const
+		{
+			return Capacity;
+		}
+
+		ZipIterator begin() { return ZipIterator(this, 0); }
+		ZipIterator end() { return ZipIterator(this, Size); }
+		ConstZipIterator begin() const { return ConstZipIterator(this, 0); }
+		ConstZipIterator end() const { return ConstZipIterator(this, Size); }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TSoAArray Example
+		TSoAArray<Vector3, Vector3> Particles;     // Posicin, velocidad.
+		Particles.Emplace(Vector3(0, 0, 0), Vector3(1, 0, 0));
+		Particles.Add(std::make_tuple(Vector3(5, 0, 0), Vector3(0, 1, 0)));
+
+		// Bucle caliente: dos flujos lineales.
+		TSpan<Vector3> Positions = Particles.GetField<0>();
+		TSpan<Vector3> Velocities = Particles.GetField<1>();
+		for (size_t i = 0; i < Positions.Num(); ++i)
+		{
+			Positions[i] = Positions[i] + Velocities[i] * 0.016f;
+		}
+
+		// Recorrido "zip" con structured bindings.
+		for (auto [Position, Velocity] : Particles)
+		{
+			std::cout << Position.x << " ";
+		}
+		std::cout << std::endl;
+
+		return 0;
+	}
+	*/
+}
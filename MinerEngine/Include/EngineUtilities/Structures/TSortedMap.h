@@ -0,0 +1,331 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "TArray.h"
+#include "TSpan.h"
+
+namespace EU {
+	/**
+	 * @brief TSortedMap es un mapa plano: claves y valores en dos arrays contiguos ordenados por clave.
+	 *
+	 * Pensado para tablas que se construyen una vez y se leen cada frame (registros de tipos de
+	 * componente, shaders, samplers, parmetros de material). La bsqueda es una bsqueda binaria
+	 * sin saltos sobre el array de claves, que solo toca las claves; los valores se leen nicamente
+	 * al encontrar la clave. Al estar ordenado permite consultas por rango con LowerBound/UpperBound.
+	 *
+	 * Insertar o eliminar una clave suelta es O(n); para cargar muchas usa Build, que es O(n log n).
+	 *
+	 * @tparam K El tipo de las claves.
+	 * @tparam V El tipo de los valores.
+	 * @tparam Less Comparador de orden estricto de las claves.
+	 */
+	template<typename K, typename V, typename Less = std::less<K>>
+	class TSortedMap
+	{
+	private:
+		TArray<K> Keys;    ///< Claves ordenadas.
+		TArray<V> Values;  ///< Values[i] corresponde a Keys[i].
+		Less Compare;      ///< Functor de orden.
+
+		bool Equivalent(const K& A, const K& B) const
+		{
+			return !Compare(A, B) && !Compare(B, A);
+		}
+
+		/**
+		 * @brief Mueve el ltimo elemento de Array a la posicin Index desplazando el resto.
+		 */
+		template<typename T>
+		static void RotateLastTo(TArray<T>& Array, size_t Index)
+		{
+			std::rotate(Array.begin() + Index, Array.end() - 1, Array.end());
+		}
+
+	public:
+		/**
+		 * @brief Par de referencias devuelto al recorrer el mapa.
+		 */
+		template<typename ValueRef>
+		struct TEntry
+		{
+			const K& Key;
+			ValueRef Value;
+		};
+
+		/**
+		 * @brief Iterador en orden de clave.
+		 */
+		template<typename MapType, typename ValueRef>
+		class TIterator
+		{
+		private:
+			MapType* Map;
+			size_t Index;
+
+		public:
+			TIterator(MapType* Map, size_t Index) : Map(Map), Index(Index) {}
+
+			TEntry<ValueRef> operator*() const { return TEntry<ValueRef>{ Map->KeyAt(Index), Map->ValueAt(Index) }; }
+			TIterator& operator++() { ++Index; return *this; }
+			bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+		};
+
+		using Iterator = TIterator<TSortedMap, V&>;
+		using ConstIterator = TIterator<const TSortedMap, const V&>;
+
+		TSortedMap() = default;
+
+		/**
+		 * @brief Sustituye el contenido por los pares [First, Last), en cualquier orden.
+		 *
+		 * Ordena una sola vez en O(n log n). Si una clave aparece varias veces se conserva el ltimo valor.
+		 *
+		 * @param First Iterador al primer par (cualquier tipo con .first/.second).
+		 * @param Last Iterador al final.
+		 */
+		template<typename InputIt>
+		void Build(InputIt First, InputIt Last)
+		{
+			std::vector<std::pair<K, V>> Sorted(First, Last);
+			std::stable_sort(Sorted.begin(), Sorted.end(),
+				[this](const std::pair<K, V>& A, const std::pair<K, V>& B) { return Compare(A.first, B.first); });
+
+			Keys.Clear();
+			Values.Clear();
+			Keys.Reserve(Sorted.size());
+			Values.Reserve(Sorted.size());
+			for (size_t i = 0; i < Sorted.size(); ++i)
+			{
+				if (i + 1 < Sorted.size() && Equivalent(Sorted[i].first, Sorted[i + 1].first))
+				{
+					continue;  ///< Gana la ltima aparicin de la clave.
+				}
+				Keys.Add(std::move(Sorted[i].first));
+				Values.Add(std::move(Sorted[i].second));
+			}
+		}
+
+		/**
+		 * @brief ndice de la primera clave que no es menor que Key (Num() si no hay ninguna).
+		 *
+		 * Bsqueda binaria sin saltos: el bucle tiene un nmero fijo de iteraciones para un
+		 * tamao dado y el avance se calcula multiplicando por el resultado de la comparacin.
+		 * Escrito como "Cond ? Base + Half : Base", GCC genera un salto condicional que falla la
+		 * prediccin en la mitad de los pasos con claves al azar.
+		 */
+		size_t LowerBound(const K& Key) const
+		{
+			const K* Base = Keys.GetData();
+			size_t Length = Keys.Num();
+			if (Length == 0)
+			{
+				return 0;
+			}
+			while (Length > 1)
+			{
+				const size_t Half = Length / 2;
+				Base += Half * static_cast<size_t>(Compare(Base[Half - 1], Key));
+				Length -= Half;
+			}
+			return static_cast<size_t>(Base - Keys.GetData()) + (Compare(*Base, Key) ? 1 : 0);
+		}
+
+		/**
+		 * @brief ndice de la primera clave mayor que Key (Num() si no hay ninguna).
+		 */
+		size_t UpperBound(const K& Key) const
+		{
+			size_t Index = LowerBound(Key);
+			if (Index < Keys.Num() && !Compare(Key, Keys[Index]))
+			{
+				++Index;
+			}
+			return Index;
+		}
+
+		/**
+		 * @brief Aade el par o sustituye el valor si la clave ya existe.
+		 *
+		 * @return Referencia al valor almacenado.
+		 */
+		V& Add(const K& Key, const V& Value)
+		{
+			const size_t Index = LowerBound(Key);
+			if (Index < Keys.Num() && !Compare(Key, Keys[Index]))
+			{
+				Values[Index] = Value;
+				return Values[Index];
+			}
+			Keys.Add(Key);
+			Values.Add(Value);
+			RotateLastTo(Keys, Index);
+			RotateLastTo(Values, Index);
+			return Values[Index];
+		}
+
+		/**
+		 * @brief Devuelve el valor de la clave, aadindolo construido por defecto si no existe.
+		 */
+		V& FindOrAdd(const K& Key)
+		{
+			const size_t Index = LowerBound(Key);
+			if (Index < Keys.Num() && !Compare(Key, Keys[Index]))
+			{
+				return Values[Index];
+			}
+			Keys.Add(Key);
+			Values.Emplace();
+			RotateLastTo(Keys, Index);
+			RotateLastTo(Values, Index);
+			return Values[Index];
+		}
+
+		/**
+		 * @brief Elimina la clave si existe.
+		 *
+		 * @return true si se elimin.
+		 */
+		bool Remove(const K& Key)
+		{
+			const size_t Index = LowerBound(Key);
+			if (Index >= Keys.Num() || Compare(Key, Keys[Index]))
+			{
+				return false;
+			}
+			Keys.RemoveAt(Index);
+			Values.RemoveAt(Index);
+			return true;
+		}
+
+		/**
+		 * @brief Busca el valor de una clave.
+		 *
+		 * @return Puntero al valor o nullptr si la clave no existe.
+		 */
+		V* Find(const K& Key)
+		{
+			const size_t Index = LowerBound(Key);
+			return Index < Keys.Num() && !Compare(Key, Keys[Index]) ? &Values[Index] : nullptr;
+		}
+
+		const V* Find(const K& Key) const
+		{
+			const size_t Index = LowerBound(Key);
+			return Index < Keys.Num() && !Compare(Key, Keys[Index]) ? &Values[Index] : nullptr;
+		}
+
+		bool Contains(const K& Key) const
+		{
+			return Find(Key) != nullptr;
+		}
+
+		/**
+		 * @brief Acceso por clave; la clave debe existir.
+		 */
+		V& operator[](const K& Key)
+		{
+			V* Value = Find(Key);
+			if (Value == nullptr)
+			{
+				std::cerr << "Key not found" << std::endl;
+				exit(1);
+			}
+			return *Value;
+		}
+
+		/**
+		 * @brief Acceso por posicin en el orden de claves (0..Num()-1).
+		 */
+		const K& KeyAt(size_t Index) const { return Keys[Index]; }
+		V& ValueAt(size_t Index) { return Values[Index]; }
+		const V& ValueAt(size_t Index) const { return Values[Index]; }
+
+		/**
+		 * @brief Vistas contiguas de las claves y de los valores.
+		 */
+		TSpan<const K> GetKeys() const { return TSpan<const K>(Keys.GetData(), Keys.Num()); }
+		TSpan<V> GetValues() { return TSpan<V>(Values.GetData(), Values.Num()); }
+		TSpan<const V> GetValues() const { return TSpan<const V>(Values.GetData(), Values.Num()); }
+
+		void Reserve(size_t Count)
+		{
+			Keys.Reserve(Count);
+			Values.Reserve(Count);
+		}
+
+		void Clear()
+		{
+			Keys.Clear();
+			Values.Clear();
+		}
+
+		size_t Num() const
+		{
+			return Keys.Num();
+		}
+
+		Iterator begin() { return Iterator(this, 0); }
+		Iterator end() { return Iterator(this, Keys.Num()); }
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, Keys.Num()); }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// TSortedMap Example
+		std::vector<std::pair<int, std::string>> Raw = { {30, "Thirty"}, {10, "Ten"}, {20, "Twenty"} };
+
+		TSortedMap<int, std::string> Table;
+		Table.Build(Raw.begin(), Raw.end());  ///< Una sola ordenacin.
+		Table.Add(25, "TwentyFive");
+
+		if (const std::string* Value = Table.Find(20))
+		{
+			std::cout << *Value << std::endl;
+		}
+
+		// Claves en [15, 30)
+		for (size_t i = Table.LowerBound(15); i < Table.LowerBound(30); ++i)
+		{
+			std::cout << Table.KeyAt(i) << ": " << Table.ValueAt(i) << std::endl;
+		}
+
+		return 0;
+	}
+	*/
+}
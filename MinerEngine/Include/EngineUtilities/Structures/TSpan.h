@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+
+namespace EU {
+	/**
+	 * @brief Vista no propietaria sobre un bloque contiguo de elementos (puntero + tamao).
+	 *
+	 * No reserva ni libera memoria; deja de ser vlida si el contenedor de origen se redimensiona.
+	 *
+	 * @tparam T El tipo de los elementos (puede ser const).
+	 */
+	template<typename T>
+	struct TSpan
+	{
+		T* Data = nullptr;  ///< Primer elemento.
+		size_t Size = 0;    ///< Nmero de elementos.
+
+		TSpan() = default;
+		TSpan(T* Data, size_t Size) : Data(Data), Size(Size) {}
+
+		T& operator[](size_t Index) const { return Data[Index]; }
+		size_t Num() const { return Size; }
+		T* begin() const { return Data; }
+		T* end() const { return Data + Size; }
+	};
+}
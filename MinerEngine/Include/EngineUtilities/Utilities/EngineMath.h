@@ -27,31 +27,72 @@
  * SOFTWARE.
 */
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include "VectorRegister.h"
+
+EU_FLOAT_PRECISE_BEGIN
 namespace EU {
 
   // Constantes matemticas
   constexpr float PI = 3.14159265358979323846f;
   constexpr float E = 2.71828182845904523536f;
 
-	/**
-		 * @brief Computes the square root using the Newton-Raphson method.
-		 *
-		 * @param value The value to compute the square root of.
-		 * @return The computed square root.
-		 */
-	inline float sqrt(float value) {
-		if (value < 0) {
-			return 0; // Handle negative input gracefully.
-		}
-		float x = value;
-		float y = 1.0f;
-		float epsilon = 0.00001f; // Desired precision.
-		while (x - y > epsilon) {
-			x = (x + y) / 2.0f;
-			y = value / x;
-		}
-		return x;
-	}
+  /**
+   * @brief Constantes de las aproximaciones minimax (coeficientes de Cephes).
+   *
+   * Las funciones escalares y sus versiones VectorRegister ejecutan exactamente la misma
+   * secuencia de operaciones con estas constantes, as que sin4(x) y sin(x) dan los mismos bits.
+   * La reduccin de Cody-Waite y la suma de ln 2 en dos partes solo funcionan si el compilador
+   * respeta el orden escrito; con /fp:fast MSVC podra reasociarlas, por eso la cabecera entera va
+   * dentro de EU_FLOAT_PRECISE_BEGIN/END. Tests/EngineMathBenchmark mide error y velocidad
+   * contra <cmath>.
+   */
+  namespace MathConstants {
+    constexpr float TWO_OVER_PI = 0.636619772367581343f;
+    constexpr float PIO2_1 = 1.5703125f;                  ///< pi/2 en tres partes (Cody-Waite); 8 bits de mantisa.
+    constexpr float PIO2_2 = 4.837512969970703125e-4f;
+    constexpr float PIO2_3 = 7.54978995489188216e-8f;
+    constexpr float SIN_1 = -1.6666654611e-1f;
+    constexpr float SIN_2 = 8.3321608736e-3f;
+    constexpr float SIN_3 = -1.9515295891e-4f;
+    constexpr float COS_1 = 4.166664568298827e-2f;
+    constexpr float COS_2 = -1.388731625493765e-3f;
+    constexpr float COS_3 = 2.443315711809948e-5f;
+    constexpr float LOG2E = 1.44269504088896341f;
+    constexpr float LN2_HI = 0.693359375f;                ///< ln 2 en dos partes.
+    constexpr float LN2_LO = -2.12194440e-4f;
+    constexpr float SQRT_HALF = 0.707106781186547524f;
+  }
+
+
+  /**
+   * @brief Computes the square root with the CPU instruction (SQRTSS / FSQRT).
+   *
+   * Correctly rounded (max 0.5 ULP). Negative inputs return 0.
+   *
+   * @param value The value to compute the square root of.
+   * @return The computed square root.
+   */
+  inline float sqrt(float value) {
+    if (value < 0) {
+      return 0; // Handle negative input gracefully.
+    }
+    return HardwareSqrt(value);
+  }
+
+  /**
+   * @brief Computes 1 / sqrt(value).
+   *
+   * Correctly rounded square root followed by a division: max error 1.5 ULP.
+   * The batched rsqrt4/rsqrt8 trade accuracy for speed.
+   *
+   * @param value A positive value.
+   * @return The reciprocal square root.
+   */
+  inline float rsqrt(float value) {
+    return 1.0f / HardwareSqrt(value);
+  }
 
   /**
    * @brief Calcula el cuadrado de un nmero.
@@ -59,7 +100,7 @@ namespace EU {
    * @param value El valor del cual se desea calcular el cuadrado.
    * @return El cuadrado del valor dado.
    */
-  inline float square(float value) {
+  constexpr float square(float value) {
     return value * value;
   }
 
@@ -69,7 +110,7 @@ namespace EU {
    * @param value El valor del cual se desea calcular el cubo.
    * @return El cubo del valor dado.
    */
-  inline float cube(float value) {
+  constexpr float cube(float value) {
     return value * value * value;
   }
 
@@ -80,7 +121,7 @@ namespace EU {
    * @param exponent El exponente al que se eleva la base.
    * @return La base elevada al exponente.
    */
-  inline float power(float base, int exponent) {
+  constexpr float power(float base, int exponent) {
     if (exponent == 0) return 1;
     if (exponent < 0) return 1.0f / power(base, -exponent);
     float result = 1;
@@ -98,7 +139,7 @@ namespace EU {
    * @param value El valor del cual se desea calcular el valor absoluto.
    * @return El valor absoluto del valor dado.
    */
-  inline float abs(float value) {
+  constexpr float abs(float value) {
     return (value < 0) ? -value : value;
   }
 
@@ -109,7 +150,7 @@ namespace EU {
    * @param b El segundo valor.
    * @return El mayor de los dos valores dados.
    */
-  inline float EMax(float a, float b) {
+  constexpr float EMax(float a, float b) {
     return (a > b) ? a : b;
   }
 
@@ -120,7 +161,7 @@ namespace EU {
    * @param b El segundo valor.
    * @return El menor de los dos valores dados.
    */
-  inline float EMin(float a, float b) {
+  constexpr float EMin(float a, float b) {
     return (a < b) ? a : b;
   }
 
@@ -130,7 +171,7 @@ namespace EU {
    * @param value El valor que se desea redondear.
    * @return El valor redondeado al entero ms cercano.
    */
-  inline float round(float value) {
+  constexpr float round(float value) {
     return (value > 0) ? static_cast<int>(value + 0.5f) : static_cast<int>(value - 0.5f);
   }
 
@@ -140,7 +181,7 @@ namespace EU {
    * @param value El valor que se desea truncar.
    * @return La parte entera del valor dado, redondeada hacia abajo.
    */
-  inline float floor(float value) {
+  constexpr float floor(float value) {
     int intValue = static_cast<int>(value);
     return (value < intValue) ? intValue - 1 : intValue;
   }
@@ -151,7 +192,7 @@ namespace EU {
    * @param value El valor que se desea redondear hacia arriba.
    * @return El valor redondeado hacia arriba al entero ms cercano.
    */
-  inline float ceil(float value) {
+  constexpr float ceil(float value) {
     int intValue = static_cast<int>(value);
     return (value > intValue) ? intValue + 1 : intValue;
   }
@@ -161,46 +202,79 @@ namespace EU {
    * @param value Valor flotante.
    * @return Valor absoluto del nmero flotante.
    */
-  inline float fabs(float value) {
+  constexpr float fabs(float value) {
     return value < 0.0f ? -value : value;
   }
 
   // Funciones Trigonomtricas
+  /**
+   * Calcula seno y coseno de un ngulo en radianes con una sola reduccin de rango.
+   *
+   * El ngulo se reduce a r en [-pi/4, pi/4] restando k * pi/2 en tres partes (Cody-Waite)
+   * y se evalan los polinomios minimax de grado 7 (seno) y 8 (coseno); el cuadrante k decide
+   * cul se usa y con qu signo. Medido contra std::sin/std::cos en doble precisin: mximo
+   * 1.5 ULP en [-pi, pi] y error absoluto < 8e-8 para |angle| <= 8192 (cerca de las races de
+   * ngulos grandes eso son ms ULP). Ms all de 8192 la reduccin deja de ser exacta.
+   *
+   * @param angle ngulo en radianes.
+   * @param outSin Recibe el seno.
+   * @param outCos Recibe el coseno.
+   */
+  inline void sinCos(float angle, float& outSin, float& outCos) {
+    using namespace MathConstants;
+    const float k = RoundToNearest(angle * TWO_OVER_PI);
+    const float r = ((angle - k * PIO2_1) - k * PIO2_2) - k * PIO2_3;
+    const float z = r * r;
+    const float polySin = ((SIN_3 * z + SIN_2) * z + SIN_1) * z * r + r;
+    const float polyCos = ((COS_3 * z + COS_2) * z + COS_1) * z * z - 0.5f * z + 1.0f;
+
+    // Cuadrante: el bit 0 intercambia seno y coseno, el bit 1 cambia el signo (coseno = k + 1).
+    const int32_t quadrant = static_cast<int32_t>(k);
+    const float valueSin = (quadrant & 1) ? polyCos : polySin;
+    const float valueCos = (quadrant & 1) ? polySin : polyCos;
+    outSin = (quadrant & 2) ? -valueSin : valueSin;
+    outCos = ((quadrant + 1) & 2) ? -valueCos : valueCos;
+  }
+
   /**
    * Calcula el seno de un ngulo en radianes.
+   *
+   * Reduccin de rango + polinomio minimax (ver sinCos). Mximo 1.5 ULP en [-pi, pi].
+   *
    * @param angle ngulo en radianes.
    * @return Valor del seno del ngulo.
    */
   inline float sin(float angle) {
-    float result = 0.0f;
-    float term = angle;
-    float angle_squared = angle * angle;
-    int n = 1;
-    while (term > 1e-6f || term < -1e-6f) {
-      result += term;
-      term *= -angle_squared / ((2 * n) * (2 * n + 1));
-      ++n;
-    }
-    return result;
+    float s, c;
+    sinCos(angle, s, c);
+    return s;
   }
 
   /**
    * Calcula el coseno de un ngulo en radianes.
+   *
+   * Reduccin de rango + polinomio minimax (ver sinCos). Mximo 1.5 ULP en [-pi, pi].
+   *
    * @param angle ngulo en radianes.
    * @return Valor del coseno del ngulo.
    */
   inline float cos(float angle) {
-    return sin(angle + PI / 2);
+    float s, c;
+    sinCos(angle, s, c);
+    return c;
   }
 
   /**
    * Calcula la tangente de un ngulo en radianes.
+   *
+   * Cociente de seno y coseno de una nica reduccin: mximo 3.5 ULP en [-100, 100] lejos de los polos.
+   *
    * @param angle ngulo en radianes.
    * @return Valor de la tangente del ngulo.
    */
   inline float tan(float angle) {
-    float s = sin(angle);
-    float c = cos(angle);
+    float s, c;
+    sinCos(angle, s, c);
     return c != 0.0f ? s / c : 0.0f; // Evita la divisin por cero
   }
 
@@ -246,6 +320,97 @@ namespace EU {
     return result;
   }
 
+  // Funciones Exponenciales y Logartmicas
+  /**
+   * Calcula la funcin exponencial e^x.
+   *
+   * x = n * ln2 + r con |r| <= ln2 / 2, polinomio minimax de grado 7 para e^r y escalado
+   * por 2^n construyendo el exponente. Error mximo 1 ULP. Devuelve +inf por encima de
+   * 88.72 y 0 por debajo de -87.33 (no genera subnormales).
+   *
+   * @param value Exponente.
+   * @return Valor de e^x.
+   */
+  inline float exp(float value) {
+    using namespace MathConstants;
+    if (value > 88.72283935546875f) {
+      const uint32_t infinity = 0x7f800000u;
+      float result;
+      std::memcpy(&result, &infinity, sizeof(result));
+      return result;
+    }
+    if (value < -87.33654022216797f) {
+      return 0.0f;
+    }
+    const float n = RoundToNearest(value * LOG2E);
+    const float r = (value - n * LN2_HI) - n * LN2_LO;
+    const float z = r * r;
+    float result = (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+                   + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f) * z + r + 1.0f;
+
+    int32_t exponent = static_cast<int32_t>(n);
+    if (exponent > 127) {
+      result *= 2.0f;
+      --exponent;
+    }
+    const uint32_t scaleBits = static_cast<uint32_t>(exponent + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &scaleBits, sizeof(scale));
+    return result * scale;
+  }
+
+  /**
+   * Calcula el logaritmo natural de un valor.
+   *
+   * value = m * 2^e con m en [sqrt(1/2), sqrt(2)), polinomio minimax de grado 9 para
+   * log(m) y e * ln2 sumado en dos partes. Error mximo 1 ULP. Para value <= 0 devuelve 0.
+   *
+   * @param value Valor.
+   * @return Logaritmo natural.
+   */
+  inline float log(float value) {
+    using namespace MathConstants;
+    if (value <= 0) return 0;
+
+    int32_t exponent = 0;
+    if (value < 1.17549435e-38f) {
+      value *= 8388608.0f; // Subnormal: normalizar con 2^23.
+      exponent = -23;
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    exponent += static_cast<int32_t>((bits >> 23) & 0xff) - 126;
+    bits = (bits & 0x807fffffu) | 0x3f000000u;
+    float mantissa;
+    std::memcpy(&mantissa, &bits, sizeof(mantissa));
+
+    float x;
+    if (mantissa < SQRT_HALF) {
+      exponent -= 1;
+      x = mantissa + mantissa - 1.0f;
+    }
+    else {
+      x = mantissa - 1.0f;
+    }
+    const float z = x * x;
+    float y = ((((((((7.0376836292e-2f * x - 1.1514610310e-1f) * x + 1.1676998740e-1f) * x
+              - 1.2420140846e-1f) * x + 1.4249322787e-1f) * x - 1.6668057665e-1f) * x
+              + 2.0000714765e-1f) * x - 2.4999993993e-1f) * x + 3.3333331174e-1f) * x * z;
+    const float e = static_cast<float>(exponent);
+    y += LN2_LO * e;
+    y += -0.5f * z;
+    return (x + y) + LN2_HI * e;
+  }
+
+  /**
+   * Calcula el logaritmo en base 10 de un valor.
+   * @param value Valor.
+   * @return Logaritmo en base 10.
+   */
+  inline float log10(float value) {
+    return log(value) * 0.434294481903251828f;
+  }
+
   /**
    * Calcula el seno hiperblico de un valor.
    * @param value Valor.
@@ -279,7 +444,7 @@ namespace EU {
    * @param degrees ngulo en grados.
    * @return ngulo en radianes.
    */
-  inline float radians(float degrees) {
+  constexpr float radians(float degrees) {
     return degrees * PI / 180.0f;
   }
 
@@ -288,54 +453,10 @@ namespace EU {
    * @param radians ngulo en radianes.
    * @return ngulo en grados.
    */
-  inline float degrees(float radians) {
+  constexpr float degrees(float radians) {
     return radians * 180.0f / PI;
   }
 
-  // Funciones Exponenciales y Logartmicas
-  /**
-   * Calcula la funcin exponencial e^x.
-   * @param value Exponente.
-   * @return Valor de e^x.
-   */
-  inline float exp(float value) {
-    float result = 1.0f;
-    float term = 1.0f;
-    for (int n = 1; n < 20; ++n) {
-      term *= value / n;
-      result += term;
-    }
-    return result;
-  }
-
-  /**
-   * Calcula el logaritmo natural de un valor.
-   * @param value Valor.
-   * @return Logaritmo natural.
-   */
-  inline float log(float value) {
-    // Aproximacin usando la serie de Taylor
-    if (value <= 0) return 0;
-    float x = (value - 1) / (value + 1);
-    float x2 = x * x;
-    float result = 0.0f;
-    float term = x;
-    for (int n = 1; n < 20; ++n) {
-      result += term / (2 * n - 1);
-      term *= x2;
-    }
-    return 2 * result;
-  }
-
-  /**
-   * Calcula el logaritmo en base 10 de un valor.
-   * @param value Valor.
-   * @return Logaritmo en base 10.
-   */
-  inline float log10(float value) {
-    return log(value) / log(10);
-  }
-
   // Operaciones de Redondeo Avanzadas
   /**
    * Calcula el mdulo de dos nmeros.
@@ -343,7 +464,7 @@ namespace EU {
    * @param b Divisor.
    * @return Mdulo.
    */
-  inline float mod(float a, float b) {
+  constexpr float mod(float a, float b) {
     return a - b * static_cast<int>(a / b);
   }
 
@@ -353,7 +474,7 @@ namespace EU {
    * @param radius Radio del crculo.
    * @return rea del crculo.
    */
-  inline float circleArea(float radius) {
+  constexpr float circleArea(float radius) {
     return PI * radius * radius;
   }
 
@@ -362,7 +483,7 @@ namespace EU {
    * @param radius Radio del crculo.
    * @return Circunferencia del crculo.
    */
-  inline float circleCircumference(float radius) {
+  constexpr float circleCircumference(float radius) {
     return 2 * PI * radius;
   }
 
@@ -372,7 +493,7 @@ namespace EU {
    * @param height Alto del rectngulo.
    * @return rea del rectngulo.
    */
-  inline float rectangleArea(float width, float height) {
+  constexpr float rectangleArea(float width, float height) {
     return width * height;
   }
 
@@ -382,7 +503,7 @@ namespace EU {
    * @param height Alto del rectngulo.
    * @return Permetro del rectngulo.
    */
-  inline float rectanglePerimeter(float width, float height) {
+  constexpr float rectanglePerimeter(float width, float height) {
     return 2 * (width + height);
   }
 
@@ -392,7 +513,7 @@ namespace EU {
    * @param height Altura del tringulo.
    * @return rea del tringulo.
    */
-  inline float triangleArea(float base, float height) {
+  constexpr float triangleArea(float base, float height) {
     return 0.5f * base * height;
   }
 
@@ -418,7 +539,7 @@ namespace EU {
    * @param t Parmetro de interpolacin entre 0 y 1.
    * @return Valor interpolado.
    */
-  inline float lerp(float a, float b, float t) {
+  constexpr float lerp(float a, float b, float t) {
     return a + t * (b - a);
   }
 
@@ -427,7 +548,7 @@ namespace EU {
    * @param n Nmero entero no negativo.
    * @return Factorial de n.
    */
-  inline int factorial(int n) {
+  constexpr int factorial(int n) {
     int result = 1;
     for (int i = 2; i <= n; ++i) {
       result *= i;
@@ -442,8 +563,138 @@ namespace EU {
    * @param epsilon Margen de error.
    * @return Verdadero si los valores son aproximadamente iguales.
    */
-  inline bool approxEqual(float a, float b, float epsilon) {
+  constexpr bool approxEqual(float a, float b, float epsilon) {
     return fabs(a - b) < epsilon;
   }
 
+  // Variantes SIMD por lotes
+  /**
+   * @brief Seno y coseno de 4 ngulos; mismas operaciones (y mismos bits) que sinCos.
+   *
+   * @param angles Los ngulos en radianes.
+   * @param outSin Recibe los senos.
+   * @param outCos Recibe los cosenos.
+   */
+  inline void VectorSinCos(VectorRegister angles, VectorRegister& outSin, VectorRegister& outCos) {
+    using namespace MathConstants;
+    const VectorRegister quarter = VectorSplat(0.25f);
+    const VectorRegister half = VectorSplat(0.5f);
+    const VectorRegister one = VectorSplat(1.0f);
+    const VectorRegister two = VectorSplat(2.0f);
+    const VectorRegister k = VectorRoundToNearest(VectorMultiply(angles, VectorSplat(TWO_OVER_PI)));
+    VectorRegister r = VectorSubtract(angles, VectorMultiply(k, VectorSplat(PIO2_1)));
+    r = VectorSubtract(r, VectorMultiply(k, VectorSplat(PIO2_2)));
+    r = VectorSubtract(r, VectorMultiply(k, VectorSplat(PIO2_3)));
+    const VectorRegister z = VectorMultiply(r, r);
+
+    VectorRegister polySin = VectorAdd(VectorMultiply(VectorSplat(SIN_3), z), VectorSplat(SIN_2));
+    polySin = VectorAdd(VectorMultiply(polySin, z), VectorSplat(SIN_1));
+    polySin = VectorAdd(VectorMultiply(VectorMultiply(polySin, z), r), r);
+
+    VectorRegister polyCos = VectorAdd(VectorMultiply(VectorSplat(COS_3), z), VectorSplat(COS_2));
+    polyCos = VectorAdd(VectorMultiply(polyCos, z), VectorSplat(COS_1));
+    polyCos = VectorMultiply(VectorMultiply(polyCos, z), z);
+    polyCos = VectorAdd(VectorSubtract(polyCos, VectorMultiply(half, z)), one);
+
+    // Bits del cuadrante en coma flotante (sin operaciones enteras): floor(v / 2) = round(v / 2 - 1/4).
+    // Negar multiplicando por -1 es exacto, as que coincide con la versin escalar.
+    const VectorRegister halfK = VectorRoundToNearest(VectorSubtract(VectorMultiply(k, half), quarter));
+    const VectorRegister bit0 = VectorSubtract(k, VectorMultiply(two, halfK));
+    const VectorRegister bit1 = VectorSubtract(halfK, VectorMultiply(two, VectorRoundToNearest(VectorSubtract(VectorMultiply(halfK, half), quarter))));
+    const VectorRegister halfCos = VectorRoundToNearest(VectorSubtract(VectorMultiply(VectorAdd(k, one), half), quarter));
+    const VectorRegister bit1Cos = VectorSubtract(halfCos, VectorMultiply(two, VectorRoundToNearest(VectorSubtract(VectorMultiply(halfCos, half), quarter))));
+
+    const VectorRegister swap = VectorCompareGreaterEqual(bit0, half);
+    outSin = VectorMultiply(VectorSelect(swap, polyCos, polySin), VectorSubtract(one, VectorMultiply(two, bit1)));
+    outCos = VectorMultiply(VectorSelect(swap, polySin, polyCos), VectorSubtract(one, VectorMultiply(two, bit1Cos)));
+  }
+
+  inline VectorRegister VectorSin(VectorRegister angles) {
+    VectorRegister s, c;
+    VectorSinCos(angles, s, c);
+    return s;
+  }
+
+  inline VectorRegister VectorCos(VectorRegister angles) {
+    VectorRegister s, c;
+    VectorSinCos(angles, s, c);
+    return c;
+  }
+
+  /**
+   * @brief 1 / sqrt por carril: estimacin de la CPU + un paso de Newton-Raphson.
+   *
+   * Mximo 4 ULP en SSE. No coincide bit a bit entre backends;
+   * para el valor exacto usar rsqrt(). Las entradas deben ser > 0.
+   */
+  inline VectorRegister VectorReciprocalSqrt(VectorRegister values) {
+    const VectorRegister estimate = VectorReciprocalSqrtEstimate(values);
+    const VectorRegister halfValues = VectorMultiply(values, VectorSplat(0.5f));
+    const VectorRegister correction =
+      VectorSubtract(VectorSplat(1.5f), VectorMultiply(VectorMultiply(halfValues, estimate), estimate));
+    return VectorMultiply(estimate, correction);
+  }
+
+  /**
+   * @brief Seno de 4 ngulos consecutivos (sin requisito de alineacin).
+   */
+  inline void sin4(const float* angles, float* out) {
+    VectorStoreUnaligned(VectorSin(VectorLoadUnaligned(angles)), out);
+  }
+
+  /**
+   * @brief Coseno de 4 ngulos consecutivos (sin requisito de alineacin).
+   */
+  inline void cos4(const float* angles, float* out) {
+    VectorStoreUnaligned(VectorCos(VectorLoadUnaligned(angles)), out);
+  }
+
+  /**
+   * @brief Seno de 8 ngulos: dos registros independientes para ocultar la latencia.
+   */
+  inline void sin8(const float* angles, float* out) {
+    const VectorRegister a = VectorSin(VectorLoadUnaligned(angles));
+    const VectorRegister b = VectorSin(VectorLoadUnaligned(angles + 4));
+    VectorStoreUnaligned(a, out);
+    VectorStoreUnaligned(b, out + 4);
+  }
+
+  /**
+   * @brief Coseno de 8 ngulos: dos registros independientes para ocultar la latencia.
+   */
+  inline void cos8(const float* angles, float* out) {
+    const VectorRegister a = VectorCos(VectorLoadUnaligned(angles));
+    const VectorRegister b = VectorCos(VectorLoadUnaligned(angles + 4));
+    VectorStoreUnaligned(a, out);
+    VectorStoreUnaligned(b, out + 4);
+  }
+
+  /**
+   * @brief 1 / sqrt aproximado de 4 valores (ver VectorReciprocalSqrt).
+   */
+  inline void rsqrt4(const float* values, float* out) {
+    VectorStoreUnaligned(VectorReciprocalSqrt(VectorLoadUnaligned(values)), out);
+  }
+
+  /**
+   * @brief 1 / sqrt aproximado de 8 valores (ver VectorReciprocalSqrt).
+   */
+  inline void rsqrt8(const float* values, float* out) {
+    const VectorRegister a = VectorReciprocalSqrt(VectorLoadUnaligned(values));
+    const VectorRegister b = VectorReciprocalSqrt(VectorLoadUnaligned(values + 4));
+    VectorStoreUnaligned(a, out);
+    VectorStoreUnaligned(b, out + 4);
+  }
+
+  // Comprobaciones en tiempo de compilacin de las funciones constexpr
+  static_assert(square(3.0f) == 9.0f && cube(-2.0f) == -8.0f, "square/cube: resultado incorrecto");
+  static_assert(power(2.0f, 10) == 1024.0f && power(2.0f, -2) == 0.25f, "power: resultado incorrecto");
+  static_assert(abs(-2.5f) == 2.5f && fabs(-0.5f) == 0.5f, "abs/fabs: resultado incorrecto");
+  static_assert(EMax(1.0f, 2.0f) == 2.0f && EMin(1.0f, 2.0f) == 1.0f, "EMax/EMin: resultado incorrecto");
+  static_assert(round(2.5f) == 3.0f && round(-2.5f) == -3.0f, "round: resultado incorrecto");
+  static_assert(floor(-1.5f) == -2.0f && ceil(1.25f) == 2.0f, "floor/ceil: resultado incorrecto");
+  static_assert(approxEqual(radians(180.0f), PI, 1e-6f) && approxEqual(degrees(PI), 180.0f, 1e-4f),
+                "radians/degrees: resultado incorrecto");
+  static_assert(lerp(2.0f, 6.0f, 0.25f) == 3.0f && factorial(5) == 120, "lerp/factorial: resultado incorrecto");
 }
+EU_FLOAT_PRECISE_END
@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include "EngineUtilities/Structures/TMap.h"
+
+namespace EU {
+	/**
+	 * @brief Tabla global de nombres internados, compartida por todas las instancias de FName.
+	 *
+	 * Cada cadena distinta se guarda una sola vez y recibe un identificador de 32 bits. Las
+	 * bsquedas toman un bloqueo compartido y solo el alta de un nombre nuevo toma el exclusivo,
+	 * por lo que se puede internar desde cualquier hilo. Los nombres nunca se liberan.
+	 */
+	class FNameTable
+	{
+	private:
+		std::deque<std::string> Strings;          ///< Texto de cada nombre; deque mantiene las direcciones estables.
+		TMap<std::string_view, uint32_t> Lookup;  ///< Texto -> identificador (las vistas apuntan a Strings).
+		mutable std::shared_mutex Mutex;
+
+		FNameTable()
+		{
+			Strings.emplace_back();  ///< El identificador 0 es el nombre vaco (None).
+			Lookup.Add(std::string_view(Strings.back()), 0u);
+		}
+
+	public:
+		FNameTable(const FNameTable&) = delete;
+		FNameTable& operator=(const FNameTable&) = delete;
+
+		/**
+		 * @brief Devuelve la tabla nica del proceso.
+		 */
+		static FNameTable& Get()
+		{
+			static FNameTable Instance;
+			return Instance;
+		}
+
+		/**
+		 * @brief Devuelve el identificador de Text, aadindolo si an no existe.
+		 */
+		uint32_t Intern(std::string_view Text)
+		{
+			{
+				std::shared_lock<std::shared_mutex> Lock(Mutex);
+				if (const uint32_t* Existing = Lookup.Find(Text))
+				{
+					return *Existing;
+				}
+			}
+			std::unique_lock<std::shared_mutex> Lock(Mutex);
+			if (const uint32_t* Existing = Lookup.Find(Text))  ///< Otro hilo pudo aadirlo entre ambos bloqueos.
+			{
+				return *Existing;
+			}
+			const uint32_t Id = static_cast<uint32_t>(Strings.size());
+			Strings.emplace_back(Text);
+			Lookup.Add(std::string_view(Strings.back()), Id);
+			return Id;
+		}
+
+		/**
+		 * @brief Devuelve el texto de un identificador emitido por Intern.
+		 */
+		const std::string& GetString(uint32_t Id) const
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			return Strings[Id];
+		}
+
+		/**
+		 * @brief Nmero de nombres distintos internados (incluido None).
+		 */
+		size_t Num() const
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			return Strings.size();
+		}
+	};
+
+	/**
+	 * @brief FName es un nombre internado: un identificador de 32 bits en la tabla global de nombres.
+	 *
+	 * Copiar, comparar y hashear un FName cuesta lo mismo que hacerlo con un entero; el coste de
+	 * hashear el texto se paga una sola vez al construirlo. salo como clave de recursos, actores
+	 * y cualquier tabla consultada en bucles calientes. La comparacin es exacta (distingue maysculas).
+	 *
+	 * En compilaciones de depuracin guarda adems un puntero al texto para verlo en el depurador.
+	 */
+	class FName
+	{
+	private:
+		uint32_t Id;  ///< ndice en FNameTable; 0 es None.
+#if defined(_DEBUG)
+		const char* DebugText;  ///< Solo para el depurador.
+#endif
+
+		void SetFromText(std::string_view Text)
+		{
+			Id = FNameTable::Get().Intern(Text);
+#if defined(_DEBUG)
+			DebugText = FNameTable::Get().GetString(Id).c_str();
+#endif
+		}
+
+	public:
+		/**
+		 * @brief Crea el nombre vaco (None).
+		 */
+		FName() : Id(0)
+#if defined(_DEBUG)
+			, DebugText("")
+#endif
+		{
+		}
+
+		/**
+		 * @brief Interna el texto; se permite la conversin implcita desde cadenas.
+		 */
+		FName(const char* Text) { SetFromText(Text != nullptr ? std::string_view(Text) : std::string_view()); }
+		FName(const std::string& Text) { SetFromText(Text); }
+		FName(std::string_view Text) { SetFromText(Text); }
+
+		/**
+		 * @brief Devuelve el texto original del nombre.
+		 */
+		const std::string& ToString() const
+		{
+			return FNameTable::Get().GetString(Id);
+		}
+
+		/**
+		 * @brief Devuelve el identificador numrico del nombre.
+		 */
+		uint32_t GetId() const
+		{
+			return Id;
+		}
+
+		/**
+		 * @brief Indica si es el nombre vaco.
+		 */
+		bool IsNone() const
+		{
+			return Id == 0;
+		}
+
+		bool operator==(const FName& Other) const { return Id == Other.Id; }
+		bool operator!=(const FName& Other) const { return Id != Other.Id; }
+
+		/**
+		 * @brief Orden por identificador (orden de alta, no alfabtico); til para contenedores ordenados.
+		 */
+		bool operator<(const FName& Other) const { return Id < Other.Id; }
+	};
+
+	/**
+	 * @brief Hash de FName: el identificador (TMap y TSet ya lo mezclan con MixHash).
+	 */
+	template<>
+	struct THash<FName>
+	{
+		size_t operator()(const FName& Name) const
+		{
+			return Name.GetId();
+		}
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		// FName Example
+		FName Cube("CubeModel");
+		FName Same(std::string("CubeModel"));
+
+		std::cout << (Cube == Same) << std::endl;     // 1: comparacin de enteros.
+		std::cout << Cube.ToString() << std::endl;    // CubeModel
+
+		TMap<FName, int> Counts;
+		Counts.Add(Cube, 1);
+
+		return 0;
+	}
+	*/
+}
+
+namespace std {
+	template<>
+	struct hash<EU::FName>
+	{
+		size_t operator()(const EU::FName& Name) const
+		{
+			return Name.GetId();
+		}
+	};
+}
@@ -0,0 +1,312 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief EU_SSE2 vale 1 cuando el compilador garantiza SSE2 (x64 siempre lo tiene).
+ *
+ * Los contenedores y la biblioteca matemtica usan esta macro para elegir entre la ruta
+ * vectorial y la ruta escalar portable (ARM, x86 sin SSE2).
+ */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EU_SSE2 1
+#include <emmintrin.h>
+#else
+#define EU_SSE2 0
+#endif
+
+/**
+ * @brief EU_X86 vale 1 en x86/x64. Ah las funciones con EU_TARGET_AVX2 pueden usar AVX2 y FMA
+ * aunque el resto del programa se compile solo con SSE2; se llaman tras CpuSupportsAVX2FMA().
+ */
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64) || defined(__i386__) || defined(_M_IX86)
+#define EU_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define EU_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define EU_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#else
+#define EU_X86 0
+#endif
+
+/**
+ * @brief EU_NEON vale 1 en ARM64, donde NEON (Advanced SIMD) siempre est disponible.
+ */
+#if !EU_SSE2 && (defined(__aarch64__) || defined(_M_ARM64))
+#define EU_NEON 1
+#include <arm_neon.h>
+#else
+#define EU_NEON 0
+#endif
+
+/**
+ * @brief EU_IS_CONSTANT_EVALUATED() indica si el cdigo se est evaluando en tiempo de compilacin.
+ *
+ * Es std::is_constant_evaluated() de C++20, disponible como builtin en C++17 desde GCC 9,
+ * Clang 9 y MSVC 19.25. Con l, las funciones EU_SIMD_CONSTEXPR usan la ruta escalar en
+ * compilacin (los intrnsecos SIMD no son constexpr) y VectorRegister en ejecucin. Si el
+ * compilador no lo ofrece, EU_SIMD_CONSTEXPR queda vaco y esas funciones dejan de ser constexpr.
+ */
+#if !defined(EU_HAS_CONSTANT_EVALUATED)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define EU_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#endif
+#if !defined(EU_HAS_CONSTANT_EVALUATED)
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define EU_HAS_CONSTANT_EVALUATED 1
+#else
+#define EU_HAS_CONSTANT_EVALUATED 0
+#endif
+#endif
+
+#if EU_HAS_CONSTANT_EVALUATED
+#define EU_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#define EU_SIMD_CONSTEXPR constexpr
+#else
+#define EU_IS_CONSTANT_EVALUATED() false
+#define EU_SIMD_CONSTEXPR
+#endif
+
+/**
+ * @brief EU_FLOAT_PRECISE_BEGIN / EU_FLOAT_PRECISE_END delimitan cdigo que depende del orden exacto
+ * de las operaciones de coma flotante (bits iguales entre rutas, reducciones Cody-Waite).
+ *
+ * El proyecto compila con /fp:fast, que deja a MSVC reasociar sumas y productos y quitar las
+ * correcciones de redondeo. Dentro de la regin se aplica float_control(precise): se respeta el
+ * orden escrito. Clang entiende el mismo pragma. GCC no tiene equivalente por regin, as que
+ * esas cabeceras no admiten -ffast-math.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define EU_FLOAT_PRECISE_BEGIN __pragma(float_control(precise, on, push))
+#define EU_FLOAT_PRECISE_END __pragma(float_control(pop))
+#elif defined(__clang__)
+#define EU_FLOAT_PRECISE_BEGIN _Pragma("float_control(precise, on, push)")
+#define EU_FLOAT_PRECISE_END _Pragma("float_control(pop)")
+#else
+#define EU_FLOAT_PRECISE_BEGIN
+#define EU_FLOAT_PRECISE_END
+#endif
+
+namespace EU {
+	/**
+	 * @brief Tamao de lnea de cach asumido para separar datos compartidos entre hilos.
+	 */
+	constexpr size_t CacheLineSize = 64;
+
+	/**
+	 * @brief Devuelve el ndice del bit menos significativo activo.
+	 *
+	 * @param Value Valor distinto de cero.
+	 * @return El nmero de ceros a la derecha del primer bit activo.
+	 */
+	inline uint32_t CountTrailingZeros32(uint32_t Value)
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward(&Index, Value);
+		return static_cast<uint32_t>(Index);
+#else
+		return static_cast<uint32_t>(__builtin_ctz(Value));
+#endif
+	}
+
+	/**
+	 * @brief Versin de 64 bits de CountTrailingZeros32.
+	 *
+	 * @param Value Valor distinto de cero.
+	 * @return El nmero de ceros a la derecha del primer bit activo.
+	 */
+	inline uint32_t CountTrailingZeros64(uint64_t Value)
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		unsigned long Index;
+		_BitScanForward64(&Index, Value);
+		return static_cast<uint32_t>(Index);
+#elif defined(_MSC_VER)
+		const uint32_t Low = static_cast<uint32_t>(Value);
+		return Low != 0 ? CountTrailingZeros32(Low)
+		                : 32 + CountTrailingZeros32(static_cast<uint32_t>(Value >> 32));
+#else
+		return static_cast<uint32_t>(__builtin_ctzll(Value));
+#endif
+	}
+
+	/**
+	 * @brief Devuelve el ndice del bit ms significativo activo (floor(log2(Value))).
+	 *
+	 * @param Value Valor distinto de cero.
+	 * @return La posicin del bit activo ms alto.
+	 */
+	inline uint32_t FloorLog2_64(uint64_t Value)
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		unsigned long Index;
+		_BitScanReverse64(&Index, Value);
+		return static_cast<uint32_t>(Index);
+#elif defined(_MSC_VER)
+		unsigned long Index;
+		const uint32_t High = static_cast<uint32_t>(Value >> 32);
+		if (High != 0)
+		{
+			_BitScanReverse(&Index, High);
+			return 32 + static_cast<uint32_t>(Index);
+		}
+		_BitScanReverse(&Index, static_cast<uint32_t>(Value));
+		return static_cast<uint32_t>(Index);
+#else
+		return 63 - static_cast<uint32_t>(__builtin_clzll(Value));
+#endif
+	}
+
+	/**
+	 * @brief Raz cuadrada con redondeo correcto usando la instruccin de la CPU.
+	 *
+	 * SQRTSS en x86, FSQRT en ARM64 y __builtin_sqrtf en otros compiladores GCC/Clang.
+	 * Solo el ltimo recurso (Newton-Raphson) puede diferir en 1 ULP del resultado exacto.
+	 *
+	 * @param Value Valor no negativo.
+	 * @return La raz cuadrada de Value.
+	 */
+	inline float HardwareSqrt(float Value)
+	{
+#if EU_SSE2
+		return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(Value)));
+#elif EU_NEON
+		return vgetq_lane_f32(vsqrtq_f32(vdupq_n_f32(Value)), 0);
+#elif defined(__GNUC__) || defined(__clang__)
+		return __builtin_sqrtf(Value);
+#else
+		if (Value <= 0.0f)
+		{
+			return 0.0f;
+		}
+		float Result = Value > 1.0f ? Value * 0.5f : 1.0f;
+		for (int Iteration = 0; Iteration < 24; ++Iteration)
+		{
+			Result = 0.5f * (Result + Value / Result);
+		}
+		return Result;
+#endif
+	}
+
+	/**
+	 * @brief Redondea al entero ms cercano (empates al par) con la instruccin de la CPU.
+	 *
+	 * Se usa la conversin de la CPU en lugar del truco (v + 1.5 * 2^23) - 1.5 * 2^23, que un
+	 * compilador con /fp:fast puede simplificar a v. Vlido para |Value| < 2^31.
+	 *
+	 * @param Value El valor a redondear.
+	 * @return El entero ms cercano, como float.
+	 */
+	inline float RoundToNearest(float Value)
+	{
+#if EU_SSE2
+		return static_cast<float>(_mm_cvtss_si32(_mm_set_ss(Value)));
+#elif EU_NEON
+		return vgetq_lane_f32(vrndnq_f32(vdupq_n_f32(Value)), 0);
+#elif defined(__GNUC__) || defined(__clang__)
+		return __builtin_rintf(Value);
+#else
+		volatile float Shifted = Value + 12582912.0f;
+		return Shifted - 12582912.0f;
+#endif
+	}
+
+	/**
+	 * @brief Indica si la CPU y el sistema operativo admiten AVX2 y FMA (consultado una vez).
+	 *
+	 * @return true si se pueden llamar funciones marcadas con EU_TARGET_AVX2.
+	 */
+	inline bool CpuSupportsAVX2FMA()
+	{
+#if EU_X86
+		static const bool bSupported = []()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			int Info[4];
+			__cpuid(Info, 0);
+			if (Info[0] < 7)
+			{
+				return false;
+			}
+			__cpuid(Info, 1);
+			const bool bFMA = (Info[2] & (1 << 12)) != 0;
+			const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+			const bool bAVX = (Info[2] & (1 << 28)) != 0;
+			if (!bFMA || !bOSXSave || !bAVX || (_xgetbv(0) & 6) != 6)
+			{
+				return false;
+			}
+			__cpuidex(Info, 7, 0);
+			return (Info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+		}();
+		return bSupported;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Cuenta los bits activos de una palabra de 64 bits.
+	 *
+	 * Solo se usa la instruccin POPCNT si el compilador la garantiza (-mpopcnt o -march que la
+	 * incluya); si no, la versin SWAR en lnea. Sin -mpopcnt, __builtin_popcountll de GCC llama a
+	 * una funcin de libgcc; contar 1M bits con ella tarda 2,4 veces ms que con la SWAR.
+	 *
+	 * @param Value La palabra a contar.
+	 * @return El nmero de bits a 1.
+	 */
+	inline uint32_t PopCount64(uint64_t Value)
+	{
+#if defined(__POPCNT__)
+		return static_cast<uint32_t>(__builtin_popcountll(Value));
+#else
+		Value = Value - ((Value >> 1) & 0x5555555555555555ULL);
+		Value = (Value & 0x3333333333333333ULL) + ((Value >> 2) & 0x3333333333333333ULL);
+		Value = (Value + (Value >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+		return static_cast<uint32_t>((Value * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+}
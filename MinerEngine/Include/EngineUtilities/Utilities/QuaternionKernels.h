@@ -0,0 +1,353 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include "VectorRegister.h"
+#include "TransformKernels.h"
+#include "EngineUtilities/Vectors/Quaternion.h"
+
+EU_FLOAT_PRECISE_BEGIN
+namespace EU {
+	static_assert(sizeof(Quaternion) == 4 * sizeof(float) && alignof(Quaternion) == 16,
+	              "Los kernels AoS cargan cada Quaternion como un VectorRegister.");
+
+	/**
+	 * @brief Punteros a los 4 flujos (w, x, y, z) de un lote de cuaternios en SoA.
+	 *
+	 * Se pueden sacar de un TSoAArray<float, float, float, float> o de cuatro TArray<float>.
+	 *
+	 * @tparam T float para salida, const float para entrada.
+	 */
+	template<typename T>
+	struct TQuaternionStreams
+	{
+		T* W;  ///< Parte real.
+		T* X;  ///< Componente i.
+		T* Y;  ///< Componente j.
+		T* Z;  ///< Componente k.
+	};
+
+	using QuaternionStreams = TQuaternionStreams<float>;
+	using ConstQuaternionStreams = TQuaternionStreams<const float>;
+
+	/**
+	 * @brief Kernels de 4 carriles: cada registro lleva un componente de 4 cuaternios distintos.
+	 *
+	 * Cada carril repite exactamente las operaciones de Quaternion::slerp, nlerp y rotate, as que
+	 * el lote da los mismos bits que llamar a la versin individual elemento por elemento.
+	 */
+	namespace QuaternionKernels {
+		/**
+		 * @brief 4 cuaternios en SoA dentro de registros.
+		 */
+		struct FQuat4
+		{
+			VectorRegister W, X, Y, Z;
+		};
+
+		inline FQuat4 Load(const ConstQuaternionStreams& Streams, size_t Index)
+		{
+			return { VectorLoadUnaligned(Streams.W + Index), VectorLoadUnaligned(Streams.X + Index),
+			         VectorLoadUnaligned(Streams.Y + Index), VectorLoadUnaligned(Streams.Z + Index) };
+		}
+
+		inline void Store(const FQuat4& Quat, const QuaternionStreams& Streams, size_t Index)
+		{
+			VectorStoreUnaligned(Quat.W, Streams.W + Index);
+			VectorStoreUnaligned(Quat.X, Streams.X + Index);
+			VectorStoreUnaligned(Quat.Y, Streams.Y + Index);
+			VectorStoreUnaligned(Quat.Z, Streams.Z + Index);
+		}
+
+		/**
+		 * @brief Carga 4 Quaternion consecutivos y los traspone a SoA.
+		 */
+		inline FQuat4 LoadAoS(const Quaternion* Quats)
+		{
+			FQuat4 Result = { Quats[0].toRegister(), Quats[1].toRegister(), Quats[2].toRegister(), Quats[3].toRegister() };
+			VectorTranspose4x4(Result.W, Result.X, Result.Y, Result.Z);
+			return Result;
+		}
+
+		inline void StoreAoS(FQuat4 Quat, Quaternion* Quats)
+		{
+			VectorTranspose4x4(Quat.W, Quat.X, Quat.Y, Quat.Z);
+			VectorStore(Quat.W, &Quats[0].w);
+			VectorStore(Quat.X, &Quats[1].w);
+			VectorStore(Quat.Y, &Quats[2].w);
+			VectorStore(Quat.Z, &Quats[3].w);
+		}
+
+		/**
+		 * @brief Producto punto por carril, en el mismo orden que VectorDot4: ((w + x) + y) + z.
+		 */
+		inline VectorRegister Dot(const FQuat4& A, const FQuat4& B)
+		{
+			VectorRegister Result = VectorMultiply(A.W, B.W);
+			Result = VectorAdd(Result, VectorMultiply(A.X, B.X));
+			Result = VectorAdd(Result, VectorMultiply(A.Y, B.Y));
+			return VectorAdd(Result, VectorMultiply(A.Z, B.Z));
+		}
+
+		/**
+		 * @brief 1 si el coseno es >= 0 y -1 si no (elige el camino ms corto).
+		 */
+		inline VectorRegister ShortestPathSign(VectorRegister CosAngle)
+		{
+			return VectorSelect(VectorCompareGreaterEqual(CosAngle, VectorZero()), VectorSplat(1.0f), VectorSplat(-1.0f));
+		}
+
+		inline FQuat4 Slerp(const FQuat4& A, const FQuat4& B, VectorRegister T)
+		{
+			const VectorRegister CosAngle = Dot(A, B);
+			const VectorRegister Sign = ShortestPathSign(CosAngle);
+			const VectorRegister CosAbs = VectorMultiply(CosAngle, Sign);
+			const VectorRegister WeightA = VectorSlerpWeight(CosAbs, VectorSubtract(VectorSplat(1.0f), T));
+			const VectorRegister WeightB = VectorSlerpWeight(CosAbs, T);
+			// (-b) * w == b * (-w): negar es exacto, as que coincide con Quaternion::slerp.
+			auto Blend = [&](VectorRegister ComponentA, VectorRegister ComponentB) {
+				return VectorAdd(VectorMultiply(ComponentA, WeightA),
+				                 VectorMultiply(VectorMultiply(ComponentB, Sign), WeightB));
+			};
+			return { Blend(A.W, B.W), Blend(A.X, B.X), Blend(A.Y, B.Y), Blend(A.Z, B.Z) };
+		}
+
+		inline FQuat4 Nlerp(const FQuat4& A, const FQuat4& B, VectorRegister T)
+		{
+			const VectorRegister Sign = ShortestPathSign(Dot(A, B));
+			auto Blend = [&](VectorRegister ComponentA, VectorRegister ComponentB) {
+				return VectorAdd(ComponentA, VectorMultiply(VectorSubtract(VectorMultiply(ComponentB, Sign), ComponentA), T));
+			};
+			const FQuat4 Blended = { Blend(A.W, B.W), Blend(A.X, B.X), Blend(A.Y, B.Y), Blend(A.Z, B.Z) };
+			const VectorRegister Length = VectorSqrt(Dot(Blended, Blended));
+			return { VectorDivide(Blended.W, Length), VectorDivide(Blended.X, Length),
+			         VectorDivide(Blended.Y, Length), VectorDivide(Blended.Z, Length) };
+		}
+
+		/**
+		 * @brief Rota 4 vectores (X, Y, Z) por 4 cuaternios con la frmula de Quaternion::rotate.
+		 */
+		inline void Rotate(const FQuat4& Q, VectorRegister& X, VectorRegister& Y, VectorRegister& Z)
+		{
+			const VectorRegister Two = VectorSplat(2.0f);
+			const VectorRegister TX = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.Y, Z), VectorMultiply(Q.Z, Y)));
+			const VectorRegister TY = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.Z, X), VectorMultiply(Q.X, Z)));
+			const VectorRegister TZ = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.X, Y), VectorMultiply(Q.Y, X)));
+			const VectorRegister RX = VectorAdd(VectorAdd(X, VectorMultiply(Q.W, TX)),
+			                                    VectorSubtract(VectorMultiply(Q.Y, TZ), VectorMultiply(Q.Z, TY)));
+			const VectorRegister RY = VectorAdd(VectorAdd(Y, VectorMultiply(Q.W, TY)),
+			                                    VectorSubtract(VectorMultiply(Q.Z, TX), VectorMultiply(Q.X, TZ)));
+			const VectorRegister RZ = VectorAdd(VectorAdd(Z, VectorMultiply(Q.W, TZ)),
+			                                    VectorSubtract(VectorMultiply(Q.X, TY), VectorMultiply(Q.Y, TX)));
+			X = RX;
+			Y = RY;
+			Z = RZ;
+		}
+	}
+
+	/**
+	 * @brief Slerp de Count pares de cuaternios en SoA con el mismo factor T (mezcla de dos poses).
+	 *
+	 * Out puede coincidir con A o con B.
+	 *
+	 * @param A Las rotaciones en T = 0 (normalizadas).
+	 * @param B Las rotaciones en T = 1 (normalizadas).
+	 * @param T El factor de interpolacin.
+	 * @param Out Recibe las rotaciones interpoladas.
+	 * @param Count Nmero de cuaternios.
+	 */
+	inline void SlerpQuaternions(const ConstQuaternionStreams& A, const ConstQuaternionStreams& B, float T,
+	                             const QuaternionStreams& Out, size_t Count)
+	{
+		const VectorRegister Factor = VectorSplat(T);
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			QuaternionKernels::Store(QuaternionKernels::Slerp(QuaternionKernels::Load(A, Index),
+			                                                  QuaternionKernels::Load(B, Index), Factor), Out, Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			const Quaternion Result = Quaternion::slerp(Quaternion(A.W[Index], A.X[Index], A.Y[Index], A.Z[Index]),
+			                                            Quaternion(B.W[Index], B.X[Index], B.Y[Index], B.Z[Index]), T);
+			Out.W[Index] = Result.w;
+			Out.X[Index] = Result.x;
+			Out.Y[Index] = Result.y;
+			Out.Z[Index] = Result.z;
+		}
+	}
+
+	/**
+	 * @brief Nlerp de Count pares de cuaternios en SoA con el mismo factor T.
+	 */
+	inline void NlerpQuaternions(const ConstQuaternionStreams& A, const ConstQuaternionStreams& B, float T,
+	                             const QuaternionStreams& Out, size_t Count)
+	{
+		const VectorRegister Factor = VectorSplat(T);
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			QuaternionKernels::Store(QuaternionKernels::Nlerp(QuaternionKernels::Load(A, Index),
+			                                                  QuaternionKernels::Load(B, Index), Factor), Out, Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			const Quaternion Result = Quaternion::nlerp(Quaternion(A.W[Index], A.X[Index], A.Y[Index], A.Z[Index]),
+			                                            Quaternion(B.W[Index], B.X[Index], B.Y[Index], B.Z[Index]), T);
+			Out.W[Index] = Result.w;
+			Out.X[Index] = Result.x;
+			Out.Y[Index] = Result.y;
+			Out.Z[Index] = Result.z;
+		}
+	}
+
+	/**
+	 * @brief Slerp de Count pares de un arreglo de Quaternion; se trasponen a SoA de 4 en 4.
+	 *
+	 * Out puede coincidir con A o con B.
+	 */
+	inline void SlerpQuaternions(const Quaternion* A, const Quaternion* B, float T, Quaternion* Out, size_t Count)
+	{
+		const VectorRegister Factor = VectorSplat(T);
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			QuaternionKernels::StoreAoS(QuaternionKernels::Slerp(QuaternionKernels::LoadAoS(A + Index),
+			                                                     QuaternionKernels::LoadAoS(B + Index), Factor), Out + Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			Out[Index] = Quaternion::slerp(A[Index], B[Index], T);
+		}
+	}
+
+	/**
+	 * @brief Nlerp de Count pares de un arreglo de Quaternion.
+	 */
+	inline void NlerpQuaternions(const Quaternion* A, const Quaternion* B, float T, Quaternion* Out, size_t Count)
+	{
+		const VectorRegister Factor = VectorSplat(T);
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			QuaternionKernels::StoreAoS(QuaternionKernels::Nlerp(QuaternionKernels::LoadAoS(A + Index),
+			                                                     QuaternionKernels::LoadAoS(B + Index), Factor), Out + Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			Out[Index] = Quaternion::nlerp(A[Index], B[Index], T);
+		}
+	}
+
+	/**
+	 * @brief Rota cada vector In[i] por su cuaternio Rotations[i] (normalizado).
+	 *
+	 * In y Out pueden ser el mismo arreglo.
+	 *
+	 * @param Rotations Una rotacin por vector.
+	 * @param In Los vectores a rotar.
+	 * @param Out Recibe los vectores rotados.
+	 * @param Count Nmero de vectores.
+	 */
+	inline void RotateVectors(const Quaternion* Rotations, const Vector3* In, Vector3* Out, size_t Count)
+	{
+		const float* Source = reinterpret_cast<const float*>(In);
+		float* Destination = reinterpret_cast<float*>(Out);
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const float* Points = Source + Index * 3;
+			VectorRegister X, Y, Z;
+			TransformKernels::DeinterleaveXYZ(VectorLoadUnaligned(Points), VectorLoadUnaligned(Points + 4),
+			                                  VectorLoadUnaligned(Points + 8), X, Y, Z);
+			QuaternionKernels::Rotate(QuaternionKernels::LoadAoS(Rotations + Index), X, Y, Z);
+			VectorRegister A, B, C;
+			TransformKernels::InterleaveXYZ(X, Y, Z, A, B, C);
+			float* Target = Destination + Index * 3;
+			VectorStoreUnaligned(A, Target);
+			VectorStoreUnaligned(B, Target + 4);
+			VectorStoreUnaligned(C, Target + 8);
+		}
+		for (; Index < Count; ++Index)
+		{
+			Out[Index] = Rotations[Index].rotate(In[Index]);
+		}
+	}
+
+	/**
+	 * @brief RotateVectors con cuaternios y vectores en SoA.
+	 */
+	inline void RotateVectors(const ConstQuaternionStreams& Rotations,
+	                          const float* InX, const float* InY, const float* InZ,
+	                          float* OutX, float* OutY, float* OutZ, size_t Count)
+	{
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			VectorRegister X = VectorLoadUnaligned(InX + Index);
+			VectorRegister Y = VectorLoadUnaligned(InY + Index);
+			VectorRegister Z = VectorLoadUnaligned(InZ + Index);
+			QuaternionKernels::Rotate(QuaternionKernels::Load(Rotations, Index), X, Y, Z);
+			VectorStoreUnaligned(X, OutX + Index);
+			VectorStoreUnaligned(Y, OutY + Index);
+			VectorStoreUnaligned(Z, OutZ + Index);
+		}
+		for (; Index < Count; ++Index)
+		{
+			const Quaternion Rotation(Rotations.W[Index], Rotations.X[Index], Rotations.Y[Index], Rotations.Z[Index]);
+			const Vector3 Result = Rotation.rotate(Vector3(InX[Index], InY[Index], InZ[Index]));
+			OutX[Index] = Result.x;
+			OutY[Index] = Result.y;
+			OutZ[Index] = Result.z;
+		}
+	}
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		TArray<Quaternion> IdlePose = ...;                    // Rotacin local de cada hueso
+		TArray<Quaternion> RunPose = ...;
+		TArray<Quaternion> Blended = IdlePose;                 // Mismo nmero de huesos
+
+		SlerpQuaternions(IdlePose.GetData(), RunPose.GetData(), 0.3f, Blended.GetData(), Blended.Num());
+
+		// Los mismos datos en SoA
+		ConstQuaternionStreams A = { IdleW, IdleX, IdleY, IdleZ };
+		ConstQuaternionStreams B = { RunW, RunX, RunY, RunZ };
+		QuaternionStreams Out = { OutW, OutX, OutY, OutZ };
+		NlerpQuaternions(A, B, 0.3f, Out, BoneCount);
+
+		RotateVectors(Blended.GetData(), Offsets.GetData(), Offsets.GetData(), Offsets.Num());
+		return 0;
+	}
+	*/
+}
+EU_FLOAT_PRECISE_END
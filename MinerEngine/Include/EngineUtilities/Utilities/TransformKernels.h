@@ -0,0 +1,580 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include "Platform.h"
+#include "VectorRegister.h"
+#include "EngineUtilities/Matrix/Matrix4x4.h"
+#include "EngineUtilities/Vectors/Vector3.h"
+
+EU_FLOAT_PRECISE_BEGIN
+namespace EU {
+	static_assert(sizeof(Vector3) == 3 * sizeof(float), "Los kernels AoS asumen Vector3 = 3 floats contiguos.");
+
+	/**
+	 * @brief Caja alineada a los ejes, definida por sus esquinas mnima y mxima.
+	 */
+	struct AABB
+	{
+		Vector3 Min;  ///< Esquina con las coordenadas menores.
+		Vector3 Max;  ///< Esquina con las coordenadas mayores.
+	};
+
+	/**
+	 * @brief Implementacin de los kernels de transformacin por lotes.
+	 *
+	 * Hay dos rutas:
+	 *  - Portable (VectorRegister: SSE2, NEON o escalar), 4 puntos por iteracin. Da exactamente los
+	 *    mismos bits que Matrix4x4::transform punto a punto.
+	 *  - AVX2 + FMA, 8 puntos por iteracin. Se elige en tiempo de ejecucin si la CPU la admite
+	 *    (CpuSupportsAVX2FMA). Redondea una vez por FMA y suma en otro orden, as que difiere de la
+	 *    portable en menos de 7 ULP de |x * m0| + |y * m1| + |z * m2| + |m3| (se miden 3). Cerca
+	 *    de cero, donde esos trminos se cancelan, la diferencia relativa al resultado puede ser
+	 *    grande.
+	 *
+	 * Las matrices siguen la convencin de Matrix4x4 (vector fila): p' = x * fila0 + y * fila1 +
+	 * z * fila2 + fila3. Los vectores (direcciones) ignoran la fila 3.
+	 */
+	namespace TransformKernels {
+		/**
+		 * @brief Los kernels con ms elementos que esto se reparten entre hilos en las variantes Parallel*.
+		 */
+		constexpr size_t MinElementsPerThread = 64 * 1024;
+
+		/**
+		 * @brief Nmero mximo de hilos que usan las variantes Parallel*.
+		 */
+		constexpr uint32_t MaxThreads = 64;
+
+		/**
+		 * @brief Pasa 4 Vector3 consecutivos (A, B, C = 12 floats) a registros X, Y, Z.
+		 */
+		inline void DeinterleaveXYZ(VectorRegister A, VectorRegister B, VectorRegister C,
+		                            VectorRegister& X, VectorRegister& Y, VectorRegister& Z)
+		{
+			X = VectorShuffle<0, 3, 0, 2>(A, VectorShuffle<2, 2, 1, 1>(B, C));
+			Y = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 0, 0>(A, B), VectorShuffle<3, 3, 2, 2>(B, C));
+			Z = VectorShuffle<0, 2, 0, 3>(VectorShuffle<2, 2, 1, 1>(A, B), C);
+		}
+
+		/**
+		 * @brief Inversa de DeinterleaveXYZ.
+		 */
+		inline void InterleaveXYZ(VectorRegister X, VectorRegister Y, VectorRegister Z,
+		                          VectorRegister& A, VectorRegister& B, VectorRegister& C)
+		{
+			A = VectorShuffle<0, 2, 0, 2>(VectorShuffle<0, 0, 0, 0>(X, Y), VectorShuffle<0, 0, 1, 1>(Z, X));
+			B = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 1, 1>(Y, Z), VectorShuffle<2, 2, 2, 2>(X, Y));
+			C = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 3, 3>(Z, X), VectorShuffle<3, 3, 3, 3>(Y, Z));
+		}
+
+		/**
+		 * @brief Una coordenada de salida para 4 puntos: ((x * m0 + y * m1) + z * m2) [+ m3].
+		 */
+		template<bool bPoint>
+		inline VectorRegister CombineColumn(VectorRegister X, VectorRegister Y, VectorRegister Z,
+		                                    const Matrix4x4& Matrix, int Column)
+		{
+			VectorRegister Result = VectorMultiply(X, VectorSplat(Matrix.m[0][Column]));
+			Result = VectorAdd(Result, VectorMultiply(Y, VectorSplat(Matrix.m[1][Column])));
+			Result = VectorAdd(Result, VectorMultiply(Z, VectorSplat(Matrix.m[2][Column])));
+			if (bPoint)
+			{
+				Result = VectorAdd(Result, VectorSplat(Matrix.m[3][Column]));
+			}
+			return Result;
+		}
+
+		/**
+		 * @brief Transforma un nico punto o vector con las mismas operaciones que la ruta de 4.
+		 */
+		template<bool bPoint>
+		inline void TransformOne(const Matrix4x4& Matrix, float X, float Y, float Z, float* Out)
+		{
+			float Result[3];
+			for (int Column = 0; Column < 3; ++Column)
+			{
+				float Value = X * Matrix.m[0][Column];
+				Value = Value + Y * Matrix.m[1][Column];
+				Value = Value + Z * Matrix.m[2][Column];
+				if (bPoint)
+				{
+					Value = Value + Matrix.m[3][Column];
+				}
+				Result[Column] = Value;
+			}
+			Out[0] = Result[0];
+			Out[1] = Result[1];
+			Out[2] = Result[2];
+		}
+
+		template<bool bPoint>
+		inline void SoAPortable(const Matrix4x4& Matrix,
+		                        const float* InX, const float* InY, const float* InZ,
+		                        float* OutX, float* OutY, float* OutZ, size_t Begin, size_t End)
+		{
+			size_t Index = Begin;
+			for (; Index + 4 <= End; Index += 4)
+			{
+				const VectorRegister X = VectorLoadUnaligned(InX + Index);
+				const VectorRegister Y = VectorLoadUnaligned(InY + Index);
+				const VectorRegister Z = VectorLoadUnaligned(InZ + Index);
+				const VectorRegister ResultX = CombineColumn<bPoint>(X, Y, Z, Matrix, 0);
+				const VectorRegister ResultY = CombineColumn<bPoint>(X, Y, Z, Matrix, 1);
+				const VectorRegister ResultZ = CombineColumn<bPoint>(X, Y, Z, Matrix, 2);
+				VectorStoreUnaligned(ResultX, OutX + Index);
+				VectorStoreUnaligned(ResultY, OutY + Index);
+				VectorStoreUnaligned(ResultZ, OutZ + Index);
+			}
+			for (; Index < End; ++Index)
+			{
+				float Result[3];
+				TransformOne<bPoint>(Matrix, InX[Index], InY[Index], InZ[Index], Result);
+				OutX[Index] = Result[0];
+				OutY[Index] = Result[1];
+				OutZ[Index] = Result[2];
+			}
+		}
+
+		template<bool bPoint>
+		inline void AoSPortable(const Matrix4x4& Matrix, const float* In, float* Out, size_t Begin, size_t End)
+		{
+			size_t Index = Begin;
+			for (; Index + 4 <= End; Index += 4)
+			{
+				const float* Source = In + Index * 3;
+				VectorRegister X, Y, Z;
+				DeinterleaveXYZ(VectorLoadUnaligned(Source), VectorLoadUnaligned(Source + 4),
+				                VectorLoadUnaligned(Source + 8), X, Y, Z);
+				VectorRegister A, B, C;
+				InterleaveXYZ(CombineColumn<bPoint>(X, Y, Z, Matrix, 0),
+				              CombineColumn<bPoint>(X, Y, Z, Matrix, 1),
+				              CombineColumn<bPoint>(X, Y, Z, Matrix, 2), A, B, C);
+				float* Destination = Out + Index * 3;
+				VectorStoreUnaligned(A, Destination);
+				VectorStoreUnaligned(B, Destination + 4);
+				VectorStoreUnaligned(C, Destination + 8);
+			}
+			for (; Index < End; ++Index)
+			{
+				TransformOne<bPoint>(Matrix, In[Index * 3], In[Index * 3 + 1], In[Index * 3 + 2], Out + Index * 3);
+			}
+		}
+
+#if EU_X86
+		/**
+		 * @brief (A[X], A[Y], B[Z], B[W]) en cada mitad de 128 bits, como VectorShuffle.
+		 */
+#define EU_SHUFFLE256(A, B, X, Y, Z, W) _mm256_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X))
+
+		template<bool bPoint>
+		EU_TARGET_AVX2 inline __m256 CombineColumnAVX2(__m256 X, __m256 Y, __m256 Z,
+		                                                const Matrix4x4& Matrix, int Column)
+		{
+			__m256 Result = bPoint ? _mm256_set1_ps(Matrix.m[3][Column]) : _mm256_setzero_ps();
+			Result = _mm256_fmadd_ps(Z, _mm256_set1_ps(Matrix.m[2][Column]), Result);
+			Result = _mm256_fmadd_ps(Y, _mm256_set1_ps(Matrix.m[1][Column]), Result);
+			return _mm256_fmadd_ps(X, _mm256_set1_ps(Matrix.m[0][Column]), Result);
+		}
+
+		template<bool bPoint>
+		EU_TARGET_AVX2 inline void SoAAVX2(const Matrix4x4& Matrix,
+		                                   const float* InX, const float* InY, const float* InZ,
+		                                   float* OutX, float* OutY, float* OutZ, size_t Begin, size_t End)
+		{
+			size_t Index = Begin;
+			for (; Index + 8 <= End; Index += 8)
+			{
+				const __m256 X = _mm256_loadu_ps(InX + Index);
+				const __m256 Y = _mm256_loadu_ps(InY + Index);
+				const __m256 Z = _mm256_loadu_ps(InZ + Index);
+				const __m256 ResultX = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 0);
+				const __m256 ResultY = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 1);
+				const __m256 ResultZ = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 2);
+				_mm256_storeu_ps(OutX + Index, ResultX);
+				_mm256_storeu_ps(OutY + Index, ResultY);
+				_mm256_storeu_ps(OutZ + Index, ResultZ);
+			}
+			_mm256_zeroupper();
+			SoAPortable<bPoint>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Index, End);
+		}
+
+		/**
+		 * @brief Carga 8 Vector3: la mitad baja con los puntos 0-3 y la alta con los 4-7.
+		 */
+		EU_TARGET_AVX2 inline __m256 LoadHalves(const float* Low, const float* High)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Low)), _mm_loadu_ps(High), 1);
+		}
+
+		template<bool bPoint>
+		EU_TARGET_AVX2 inline void AoSAVX2(const Matrix4x4& Matrix, const float* In, float* Out,
+		                                   size_t Begin, size_t End)
+		{
+			size_t Index = Begin;
+			for (; Index + 8 <= End; Index += 8)
+			{
+				const float* Source = In + Index * 3;
+				const __m256 A = LoadHalves(Source, Source + 12);
+				const __m256 B = LoadHalves(Source + 4, Source + 16);
+				const __m256 C = LoadHalves(Source + 8, Source + 20);
+
+				// Mismo desentrelazado que DeinterleaveXYZ, en cada mitad de 128 bits.
+				const __m256 X = EU_SHUFFLE256(A, EU_SHUFFLE256(B, C, 2, 2, 1, 1), 0, 3, 0, 2);
+				const __m256 Y = EU_SHUFFLE256(EU_SHUFFLE256(A, B, 1, 1, 0, 0), EU_SHUFFLE256(B, C, 3, 3, 2, 2), 0, 2, 0, 2);
+				const __m256 Z = EU_SHUFFLE256(EU_SHUFFLE256(A, B, 2, 2, 1, 1), C, 0, 2, 0, 3);
+
+				const __m256 RX = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 0);
+				const __m256 RY = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 1);
+				const __m256 RZ = CombineColumnAVX2<bPoint>(X, Y, Z, Matrix, 2);
+
+				const __m256 OA = EU_SHUFFLE256(EU_SHUFFLE256(RX, RY, 0, 0, 0, 0), EU_SHUFFLE256(RZ, RX, 0, 0, 1, 1), 0, 2, 0, 2);
+				const __m256 OB = EU_SHUFFLE256(EU_SHUFFLE256(RY, RZ, 1, 1, 1, 1), EU_SHUFFLE256(RX, RY, 2, 2, 2, 2), 0, 2, 0, 2);
+				const __m256 OC = EU_SHUFFLE256(EU_SHUFFLE256(RZ, RX, 2, 2, 3, 3), EU_SHUFFLE256(RY, RZ, 3, 3, 3, 3), 0, 2, 0, 2);
+
+				float* Destination = Out + Index * 3;
+				_mm_storeu_ps(Destination, _mm256_castps256_ps128(OA));
+				_mm_storeu_ps(Destination + 4, _mm256_castps256_ps128(OB));
+				_mm_storeu_ps(Destination + 8, _mm256_castps256_ps128(OC));
+				_mm_storeu_ps(Destination + 12, _mm256_extractf128_ps(OA, 1));
+				_mm_storeu_ps(Destination + 16, _mm256_extractf128_ps(OB, 1));
+				_mm_storeu_ps(Destination + 20, _mm256_extractf128_ps(OC, 1));
+			}
+			_mm256_zeroupper();
+			AoSPortable<bPoint>(Matrix, In, Out, Index, End);
+		}
+
+#undef EU_SHUFFLE256
+#endif
+
+		template<bool bPoint>
+		inline void SoA(const Matrix4x4& Matrix,
+		                const float* InX, const float* InY, const float* InZ,
+		                float* OutX, float* OutY, float* OutZ, size_t Begin, size_t End)
+		{
+#if EU_X86
+			if (CpuSupportsAVX2FMA())
+			{
+				SoAAVX2<bPoint>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Begin, End);
+				return;
+			}
+#endif
+			SoAPortable<bPoint>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Begin, End);
+		}
+
+		template<bool bPoint>
+		inline void AoS(const Matrix4x4& Matrix, const Vector3* In, Vector3* Out, size_t Begin, size_t End)
+		{
+			const float* Source = reinterpret_cast<const float*>(In);
+			float* Destination = reinterpret_cast<float*>(Out);
+#if EU_X86
+			if (CpuSupportsAVX2FMA())
+			{
+				AoSAVX2<bPoint>(Matrix, Source, Destination, Begin, End);
+				return;
+			}
+#endif
+			AoSPortable<bPoint>(Matrix, Source, Destination, Begin, End);
+		}
+
+		/**
+		 * @brief Reparte [0, Count) en bloques contiguos, uno por hilo, y llama Body(Begin, End).
+		 *
+		 * El hilo que llama procesa el primer bloque. Los bordes son mltiplos de 8 para que cada
+		 * hilo use el kernel de 8 elementos completo. Con NumThreads = 0 se usan todos los ncleos.
+		 * Si crear un hilo falla o Body lanza en el hilo que llama, la excepcin sale de aqu
+		 * despus de esperar a los hilos ya creados.
+		 */
+		template<typename FBody>
+		inline void ParallelRanges(size_t Count, uint32_t NumThreads, FBody Body)
+		{
+			// hardware_concurrency() pregunta al sistema en cada llamada (unos s, ms que
+			// transformar 4K puntos): solo se consulta si hay trabajo para ms de un hilo.
+			const size_t MaxUseful = Count / MinElementsPerThread;
+			if (NumThreads == 0 && MaxUseful > 1)
+			{
+				NumThreads = std::thread::hardware_concurrency();
+			}
+			if (NumThreads > MaxUseful)
+			{
+				NumThreads = static_cast<uint32_t>(MaxUseful);
+			}
+			if (NumThreads > MaxThreads)
+			{
+				NumThreads = MaxThreads;
+			}
+			if (NumThreads <= 1)
+			{
+				Body(size_t(0), Count);
+				return;
+			}
+
+			const size_t Chunk = ((Count / NumThreads) + 7) & ~size_t(7);
+			std::thread Workers[MaxThreads];
+			auto JoinWorkers = [&Workers, NumThreads]() {
+				for (uint32_t Worker = 1; Worker < NumThreads; ++Worker)
+				{
+					if (Workers[Worker].joinable())
+					{
+						Workers[Worker].join();
+					}
+				}
+			};
+			try
+			{
+				for (uint32_t Worker = 1; Worker < NumThreads; ++Worker)
+				{
+					const size_t Begin = Chunk * Worker;
+					const size_t End = Worker + 1 == NumThreads ? Count : Chunk * (Worker + 1);
+					if (Begin < End)
+					{
+						Workers[Worker] = std::thread(Body, Begin, End);
+					}
+				}
+				Body(size_t(0), Chunk < Count ? Chunk : Count);
+			}
+			catch (...)
+			{
+				// Si no se puede crear un hilo (o Body lanza), destruir un std::thread que sigue
+				// corriendo llamara a std::terminate: esperar a los que arrancaron y relanzar.
+				JoinWorkers();
+				throw;
+			}
+			JoinWorkers();
+		}
+	}
+
+	/**
+	 * @brief Transforma Count puntos (w = 1) de un arreglo de Vector3.
+	 *
+	 * In y Out pueden ser el mismo arreglo (transformacin en el sitio).
+	 *
+	 * @param Matrix La transformacin (convencin vector fila de Matrix4x4).
+	 * @param In Los puntos de entrada.
+	 * @param Out Recibe los puntos transformados.
+	 * @param Count Nmero de puntos.
+	 */
+	inline void TransformPoints(const Matrix4x4& Matrix, const Vector3* In, Vector3* Out, size_t Count)
+	{
+		TransformKernels::AoS<true>(Matrix, In, Out, 0, Count);
+	}
+
+	/**
+	 * @brief Transforma Count vectores de direccin (w = 0: sin traslacin) de un arreglo de Vector3.
+	 */
+	inline void TransformVectors(const Matrix4x4& Matrix, const Vector3* In, Vector3* Out, size_t Count)
+	{
+		TransformKernels::AoS<false>(Matrix, In, Out, 0, Count);
+	}
+
+	/**
+	 * @brief Transforma Count puntos guardados en SoA (un arreglo por coordenada).
+	 *
+	 * Los arreglos de salida pueden coincidir con los de entrada.
+	 */
+	inline void TransformPoints(const Matrix4x4& Matrix,
+	                            const float* InX, const float* InY, const float* InZ,
+	                            float* OutX, float* OutY, float* OutZ, size_t Count)
+	{
+		TransformKernels::SoA<true>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, 0, Count);
+	}
+
+	/**
+	 * @brief Transforma Count vectores de direccin guardados en SoA.
+	 */
+	inline void TransformVectors(const Matrix4x4& Matrix,
+	                             const float* InX, const float* InY, const float* InZ,
+	                             float* OutX, float* OutY, float* OutZ, size_t Count)
+	{
+		TransformKernels::SoA<false>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, 0, Count);
+	}
+
+	/**
+	 * @brief Transforma puntos intercalados en otra estructura (por ejemplo SimpleVertex::Pos).
+	 *
+	 * Cada punto son 3 floats al inicio de un elemento de InStride bytes. Usa la ruta portable
+	 * de 4 en 4 (los datos se recogen con VectorSet, as que rinde menos que el AoS compacto).
+	 *
+	 * @param In Direccin del primer punto.
+	 * @param InStride Distancia en bytes entre puntos de entrada.
+	 * @param Out Direccin del primer punto de salida (puede ser In).
+	 * @param OutStride Distancia en bytes entre puntos de salida.
+	 */
+	inline void TransformPointsStrided(const Matrix4x4& Matrix, const void* In, size_t InStride,
+	                                   void* Out, size_t OutStride, size_t Count)
+	{
+		const unsigned char* Source = static_cast<const unsigned char*>(In);
+		unsigned char* Destination = static_cast<unsigned char*>(Out);
+		auto At = [](const unsigned char* Base, size_t Stride, size_t Index) {
+			return reinterpret_cast<const float*>(Base + Stride * Index);
+		};
+		size_t Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const float* P0 = At(Source, InStride, Index);
+			const float* P1 = At(Source, InStride, Index + 1);
+			const float* P2 = At(Source, InStride, Index + 2);
+			const float* P3 = At(Source, InStride, Index + 3);
+			const VectorRegister X = VectorSet(P0[0], P1[0], P2[0], P3[0]);
+			const VectorRegister Y = VectorSet(P0[1], P1[1], P2[1], P3[1]);
+			const VectorRegister Z = VectorSet(P0[2], P1[2], P2[2], P3[2]);
+			alignas(16) float Result[3][4];
+			VectorStore(TransformKernels::CombineColumn<true>(X, Y, Z, Matrix, 0), Result[0]);
+			VectorStore(TransformKernels::CombineColumn<true>(X, Y, Z, Matrix, 1), Result[1]);
+			VectorStore(TransformKernels::CombineColumn<true>(X, Y, Z, Matrix, 2), Result[2]);
+			for (size_t Lane = 0; Lane < 4; ++Lane)
+			{
+				float* Target = reinterpret_cast<float*>(Destination + OutStride * (Index + Lane));
+				Target[0] = Result[0][Lane];
+				Target[1] = Result[1][Lane];
+				Target[2] = Result[2][Lane];
+			}
+		}
+		for (; Index < Count; ++Index)
+		{
+			const float* Point = At(Source, InStride, Index);
+			TransformKernels::TransformOne<true>(Matrix, Point[0], Point[1], Point[2],
+			                                     reinterpret_cast<float*>(Destination + OutStride * Index));
+		}
+	}
+
+	/**
+	 * @brief Transforma Count cajas y devuelve las cajas alineadas a los ejes que las contienen.
+	 *
+	 * Mtodo de Arvo con centro y semiextensin: centro' = centro * M y
+	 * extensin' = |M3x3| * extensin. Da la caja mnima que contiene a la caja transformada,
+	 * con 2 productos de fila por caja en lugar de transformar las 8 esquinas.
+	 */
+	inline void TransformAABBs(const Matrix4x4& Matrix, const AABB* In, AABB* Out, size_t Count)
+	{
+		const VectorRegister Row0 = Matrix.row(0);
+		const VectorRegister Row1 = Matrix.row(1);
+		const VectorRegister Row2 = Matrix.row(2);
+		const VectorRegister Row3 = Matrix.row(3);
+		const VectorRegister AbsRow0 = VectorAbs(Row0);
+		const VectorRegister AbsRow1 = VectorAbs(Row1);
+		const VectorRegister AbsRow2 = VectorAbs(Row2);
+		const VectorRegister Half = VectorSplat(0.5f);
+
+		for (size_t Index = 0; Index < Count; ++Index)
+		{
+			const AABB& Box = In[Index];
+			const VectorRegister Min = VectorSet(Box.Min.x, Box.Min.y, Box.Min.z, 0.0f);
+			const VectorRegister Max = VectorSet(Box.Max.x, Box.Max.y, Box.Max.z, 0.0f);
+			const VectorRegister Center = VectorMultiply(VectorAdd(Min, Max), Half);
+			const VectorRegister Extent = VectorMultiply(VectorSubtract(Max, Min), Half);
+
+			VectorRegister NewCenter = VectorMultiply(VectorReplicate<0>(Center), Row0);
+			NewCenter = VectorAdd(NewCenter, VectorMultiply(VectorReplicate<1>(Center), Row1));
+			NewCenter = VectorAdd(NewCenter, VectorMultiply(VectorReplicate<2>(Center), Row2));
+			NewCenter = VectorAdd(NewCenter, Row3);
+
+			VectorRegister NewExtent = VectorMultiply(VectorReplicate<0>(Extent), AbsRow0);
+			NewExtent = VectorAdd(NewExtent, VectorMultiply(VectorReplicate<1>(Extent), AbsRow1));
+			NewExtent = VectorAdd(NewExtent, VectorMultiply(VectorReplicate<2>(Extent), AbsRow2));
+
+			alignas(16) float NewMin[4];
+			alignas(16) float NewMax[4];
+			VectorStore(VectorSubtract(NewCenter, NewExtent), NewMin);
+			VectorStore(VectorAdd(NewCenter, NewExtent), NewMax);
+			Out[Index].Min = Vector3(NewMin[0], NewMin[1], NewMin[2]);
+			Out[Index].Max = Vector3(NewMax[0], NewMax[1], NewMax[2]);
+		}
+	}
+
+	/**
+	 * @brief TransformPoints (AoS) repartido entre hilos para arreglos muy grandes.
+	 *
+	 * Por debajo de TransformKernels::MinElementsPerThread elementos por hilo se queda en el hilo
+	 * actual. El resultado es idntico al de TransformPoints.
+	 *
+	 * @param NumThreads Hilos a usar; 0 = std::thread::hardware_concurrency().
+	 */
+	inline void ParallelTransformPoints(const Matrix4x4& Matrix, const Vector3* In, Vector3* Out,
+	                                    size_t Count, uint32_t NumThreads = 0)
+	{
+		TransformKernels::ParallelRanges(Count, NumThreads, [&Matrix, In, Out](size_t Begin, size_t End) {
+			TransformKernels::AoS<true>(Matrix, In, Out, Begin, End);
+		});
+	}
+
+	/**
+	 * @brief TransformVectors (AoS) repartido entre hilos para arreglos muy grandes.
+	 */
+	inline void ParallelTransformVectors(const Matrix4x4& Matrix, const Vector3* In, Vector3* Out,
+	                                     size_t Count, uint32_t NumThreads = 0)
+	{
+		TransformKernels::ParallelRanges(Count, NumThreads, [&Matrix, In, Out](size_t Begin, size_t End) {
+			TransformKernels::AoS<false>(Matrix, In, Out, Begin, End);
+		});
+	}
+
+	/**
+	 * @brief TransformPoints (SoA) repartido entre hilos para arreglos muy grandes.
+	 */
+	inline void ParallelTransformPoints(const Matrix4x4& Matrix,
+	                                    const float* InX, const float* InY, const float* InZ,
+	                                    float* OutX, float* OutY, float* OutZ,
+	                                    size_t Count, uint32_t NumThreads = 0)
+	{
+		TransformKernels::ParallelRanges(Count, NumThreads,
+			[&Matrix, InX, InY, InZ, OutX, OutY, OutZ](size_t Begin, size_t End) {
+				TransformKernels::SoA<true>(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Begin, End);
+			});
+	}
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		Matrix4x4 World(1, 0, 0, 0,
+		                0, 1, 0, 0,
+		                0, 0, 1, 0,
+		                5, 0, 0, 1);                            // Traslacin (5, 0, 0)
+
+		TArray<Vector3> Positions = ...;
+		TransformPoints(World, Positions.GetData(), Positions.GetData(), Positions.Num());
+
+		// Posiciones dentro de los vrtices, sin copiarlas antes
+		TransformPointsStrided(World, &Vertices[0].Pos, sizeof(SimpleVertex),
+		                       &Vertices[0].Pos, sizeof(SimpleVertex), Vertices.size());
+
+		AABB Local = { Vector3(-1, -1, -1), Vector3(1, 1, 1) };
+		AABB WorldBox;
+		TransformAABBs(World, &Local, &WorldBox, 1);         // (4,-1,-1) - (6,1,1)
+
+		ParallelTransformPoints(World, Cloud, Cloud, 10000000);
+		return 0;
+	}
+	*/
+}
+EU_FLOAT_PRECISE_END
@@ -0,0 +1,517 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstring>
+#include "Platform.h"
+
+/**
+ * @brief Backend de VectorRegister.
+ *
+ * SSE2 en x86/x64, NEON en ARM64 y escalar en el resto. Definir EU_MATH_SCALAR antes de incluir
+ * fuerza la ruta escalar (til para depurar o comparar resultados entre plataformas).
+ */
+#if EU_SSE2 && !defined(EU_MATH_SCALAR)
+#define EU_VECTOR_SSE 1
+#define EU_VECTOR_NEON 0
+#elif EU_NEON && !defined(EU_MATH_SCALAR)
+#define EU_VECTOR_SSE 0
+#define EU_VECTOR_NEON 1
+#else
+#define EU_VECTOR_SSE 0
+#define EU_VECTOR_NEON 0
+#endif
+
+EU_FLOAT_PRECISE_BEGIN
+namespace EU {
+	/**
+	 * @brief Registro de 4 floats sobre el que se construyen Vector4, Matrix4x4 y Quaternion.
+	 *
+	 * Todas las operaciones son suma, resta, producto, divisin, raz cuadrada o reordenacin de
+	 * carriles: operaciones que IEEE 754 define con redondeo exacto, as que SSE, NEON y la ruta
+	 * escalar producen exactamente los mismos bits. Por eso no se usan FMA (redondea una vez en
+	 * lugar de dos) ni las aproximaciones rcp/rsqrt, y las sumas horizontales siguen siempre el
+	 * orden ((x + y) + z) + w, el mismo de una expresin escalar escrita de izquierda a derecha.
+	 *
+	 * El proyecto compila con /fp:fast, as que esta cabecera y las que se apoyan en ella (Vector4,
+	 * Matrix4x4, Quaternion, QuaternionKernels, TransformKernels) van dentro de
+	 * EU_FLOAT_PRECISE_BEGIN/END: MSVC no reordena ni fusiona esas operaciones aunque el resto del
+	 * motor siga en /fp:fast. GCC y Clang fusionan mul + add cuando el objetivo tiene FMA (-mfma,
+	 * -march=native), as que esas compilaciones necesitan -ffp-contract=off, y GCC no debe usar
+	 * -ffast-math.
+	 * Tests/VectorMathTest compara bit a bit esta ruta con la de EU_MATH_SCALAR.
+	 */
+#if EU_VECTOR_SSE
+	typedef __m128 VectorRegister;
+#elif EU_VECTOR_NEON
+	typedef float32x4_t VectorRegister;
+#else
+	struct alignas(16) VectorRegister
+	{
+		float V[4];
+	};
+#endif
+
+	/**
+	 * @brief Carga 4 floats de una direccin alineada a 16 bytes.
+	 */
+	inline VectorRegister VectorLoad(const float* Ptr)
+	{
+#if EU_VECTOR_SSE
+		return _mm_load_ps(Ptr);
+#elif EU_VECTOR_NEON
+		return vld1q_f32(Ptr);
+#else
+		return VectorRegister{ { Ptr[0], Ptr[1], Ptr[2], Ptr[3] } };
+#endif
+	}
+
+	/**
+	 * @brief Carga 4 floats de una direccin sin requisito de alineacin.
+	 */
+	inline VectorRegister VectorLoadUnaligned(const float* Ptr)
+	{
+#if EU_VECTOR_SSE
+		return _mm_loadu_ps(Ptr);
+#else
+		return VectorLoad(Ptr);
+#endif
+	}
+
+	/**
+	 * @brief Guarda el registro en una direccin alineada a 16 bytes.
+	 */
+	inline void VectorStore(VectorRegister Vec, float* Ptr)
+	{
+#if EU_VECTOR_SSE
+		_mm_store_ps(Ptr, Vec);
+#elif EU_VECTOR_NEON
+		vst1q_f32(Ptr, Vec);
+#else
+		Ptr[0] = Vec.V[0]; Ptr[1] = Vec.V[1]; Ptr[2] = Vec.V[2]; Ptr[3] = Vec.V[3];
+#endif
+	}
+
+	/**
+	 * @brief Guarda el registro en una direccin sin requisito de alineacin.
+	 */
+	inline void VectorStoreUnaligned(VectorRegister Vec, float* Ptr)
+	{
+#if EU_VECTOR_SSE
+		_mm_storeu_ps(Ptr, Vec);
+#else
+		VectorStore(Vec, Ptr);
+#endif
+	}
+
+	/**
+	 * @brief Construye un registro (X, Y, Z, W).
+	 */
+	inline VectorRegister VectorSet(float X, float Y, float Z, float W)
+	{
+#if EU_VECTOR_SSE
+		return _mm_setr_ps(X, Y, Z, W);
+#elif EU_VECTOR_NEON
+		alignas(16) const float Lanes[4] = { X, Y, Z, W };
+		return vld1q_f32(Lanes);
+#else
+		return VectorRegister{ { X, Y, Z, W } };
+#endif
+	}
+
+	/**
+	 * @brief Registro con los 4 carriles a Value.
+	 */
+	inline VectorRegister VectorSplat(float Value)
+	{
+#if EU_VECTOR_SSE
+		return _mm_set1_ps(Value);
+#elif EU_VECTOR_NEON
+		return vdupq_n_f32(Value);
+#else
+		return VectorRegister{ { Value, Value, Value, Value } };
+#endif
+	}
+
+	inline VectorRegister VectorZero()
+	{
+#if EU_VECTOR_SSE
+		return _mm_setzero_ps();
+#else
+		return VectorSplat(0.0f);
+#endif
+	}
+
+	/**
+	 * @brief Devuelve el carril Lane del registro.
+	 */
+	template<int Lane>
+	inline float VectorGetComponent(VectorRegister Vec)
+	{
+		static_assert(Lane >= 0 && Lane < 4, "Carril fuera de rango.");
+#if EU_VECTOR_SSE
+		return _mm_cvtss_f32(_mm_shuffle_ps(Vec, Vec, _MM_SHUFFLE(Lane, Lane, Lane, Lane)));
+#elif EU_VECTOR_NEON
+		return vgetq_lane_f32(Vec, Lane);
+#else
+		return Vec.V[Lane];
+#endif
+	}
+
+	/**
+	 * @brief Mezcla dos registros: (A[X], A[Y], B[Z], B[W]), como _mm_shuffle_ps.
+	 */
+	template<int X, int Y, int Z, int W>
+	inline VectorRegister VectorShuffle(VectorRegister A, VectorRegister B)
+	{
+		static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 && Z >= 0 && Z < 4 && W >= 0 && W < 4,
+		              "Carril fuera de rango.");
+#if EU_VECTOR_SSE
+		return _mm_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X));
+#elif EU_VECTOR_NEON
+		alignas(16) const float Lanes[4] = {
+			vgetq_lane_f32(A, X), vgetq_lane_f32(A, Y), vgetq_lane_f32(B, Z), vgetq_lane_f32(B, W) };
+		return vld1q_f32(Lanes);
+#else
+		return VectorRegister{ { A.V[X], A.V[Y], B.V[Z], B.V[W] } };
+#endif
+	}
+
+	/**
+	 * @brief Reordena los carriles de un registro: (V[X], V[Y], V[Z], V[W]).
+	 */
+	template<int X, int Y, int Z, int W>
+	inline VectorRegister VectorSwizzle(VectorRegister Vec)
+	{
+		return VectorShuffle<X, Y, Z, W>(Vec, Vec);
+	}
+
+	/**
+	 * @brief Copia el carril Lane a los 4 carriles.
+	 */
+	template<int Lane>
+	inline VectorRegister VectorReplicate(VectorRegister Vec)
+	{
+#if EU_VECTOR_NEON
+		return vdupq_laneq_f32(Vec, Lane);
+#else
+		return VectorSwizzle<Lane, Lane, Lane, Lane>(Vec);
+#endif
+	}
+
+	inline VectorRegister VectorAdd(VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_add_ps(A, B);
+#elif EU_VECTOR_NEON
+		return vaddq_f32(A, B);
+#else
+		return VectorRegister{ { A.V[0] + B.V[0], A.V[1] + B.V[1], A.V[2] + B.V[2], A.V[3] + B.V[3] } };
+#endif
+	}
+
+	inline VectorRegister VectorSubtract(VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_sub_ps(A, B);
+#elif EU_VECTOR_NEON
+		return vsubq_f32(A, B);
+#else
+		return VectorRegister{ { A.V[0] - B.V[0], A.V[1] - B.V[1], A.V[2] - B.V[2], A.V[3] - B.V[3] } };
+#endif
+	}
+
+	inline VectorRegister VectorMultiply(VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_mul_ps(A, B);
+#elif EU_VECTOR_NEON
+		return vmulq_f32(A, B);
+#else
+		return VectorRegister{ { A.V[0] * B.V[0], A.V[1] * B.V[1], A.V[2] * B.V[2], A.V[3] * B.V[3] } };
+#endif
+	}
+
+	inline VectorRegister VectorDivide(VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_div_ps(A, B);
+#elif EU_VECTOR_NEON
+		return vdivq_f32(A, B);
+#else
+		return VectorRegister{ { A.V[0] / B.V[0], A.V[1] / B.V[1], A.V[2] / B.V[2], A.V[3] / B.V[3] } };
+#endif
+	}
+
+	/**
+	 * @brief Raz cuadrada por carril, con redondeo correcto.
+	 */
+	inline VectorRegister VectorSqrt(VectorRegister Vec)
+	{
+#if EU_VECTOR_SSE
+		return _mm_sqrt_ps(Vec);
+#elif EU_VECTOR_NEON
+		return vsqrtq_f32(Vec);
+#else
+		return VectorRegister{ { HardwareSqrt(Vec.V[0]), HardwareSqrt(Vec.V[1]),
+		                         HardwareSqrt(Vec.V[2]), HardwareSqrt(Vec.V[3]) } };
+#endif
+	}
+
+	/**
+	 * @brief Redondea cada carril al entero ms cercano (empates al par). Vlido para |v| < 2^31.
+	 */
+	inline VectorRegister VectorRoundToNearest(VectorRegister Vec)
+	{
+#if EU_VECTOR_SSE
+		return _mm_cvtepi32_ps(_mm_cvtps_epi32(Vec));
+#elif EU_VECTOR_NEON
+		return vrndnq_f32(Vec);
+#else
+		return VectorRegister{ { RoundToNearest(Vec.V[0]), RoundToNearest(Vec.V[1]),
+		                         RoundToNearest(Vec.V[2]), RoundToNearest(Vec.V[3]) } };
+#endif
+	}
+
+	/**
+	 * @brief Estimacin rpida de 1 / sqrt(Vec) (unos 12 bits de precisin).
+	 *
+	 * Es la nica operacin que NO da los mismos bits en todos los backends: cada ISA tiene su
+	 * propia tabla de estimacin (en NEON se refina un paso para igualar la precisin de SSE y la
+	 * ruta escalar devuelve el valor exacto). Usar solo donde baste una aproximacin.
+	 */
+	inline VectorRegister VectorReciprocalSqrtEstimate(VectorRegister Vec)
+	{
+#if EU_VECTOR_SSE
+		return _mm_rsqrt_ps(Vec);
+#elif EU_VECTOR_NEON
+		const float32x4_t Estimate = vrsqrteq_f32(Vec);
+		return vmulq_f32(Estimate, vrsqrtsq_f32(vmulq_f32(Vec, Estimate), Estimate));
+#else
+		return VectorDivide(VectorSplat(1.0f), VectorSqrt(Vec));
+#endif
+	}
+
+	/**
+	 * @brief Mscara por carril: todos los bits a 1 donde A >= B, a 0 en el resto.
+	 */
+	inline VectorRegister VectorCompareGreaterEqual(VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_cmpge_ps(A, B);
+#elif EU_VECTOR_NEON
+		return vreinterpretq_f32_u32(vcgeq_f32(A, B));
+#else
+		VectorRegister Mask;
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			const uint32_t Bits = A.V[Lane] >= B.V[Lane] ? 0xffffffffu : 0u;
+			std::memcpy(&Mask.V[Lane], &Bits, sizeof(Bits));
+		}
+		return Mask;
+#endif
+	}
+
+	/**
+	 * @brief Elige por carril: A donde la mscara est activa, B en el resto.
+	 *
+	 * @param Mask Resultado de una comparacin (VectorCompare*).
+	 */
+	inline VectorRegister VectorSelect(VectorRegister Mask, VectorRegister A, VectorRegister B)
+	{
+#if EU_VECTOR_SSE
+		return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+#elif EU_VECTOR_NEON
+		return vbslq_f32(vreinterpretq_u32_f32(Mask), A, B);
+#else
+		VectorRegister Result;
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			uint32_t Bits;
+			std::memcpy(&Bits, &Mask.V[Lane], sizeof(Bits));
+			Result.V[Lane] = Bits != 0 ? A.V[Lane] : B.V[Lane];
+		}
+		return Result;
+#endif
+	}
+
+	/**
+	 * @brief Indica si la mscara est activa en los 4 carriles.
+	 *
+	 * @param Mask Resultado de una comparacin (VectorCompare*).
+	 */
+	inline bool VectorAllTrue(VectorRegister Mask)
+	{
+#if EU_VECTOR_SSE
+		return _mm_movemask_ps(Mask) == 0xF;
+#elif EU_VECTOR_NEON
+		const uint32x4_t Bits = vreinterpretq_u32_f32(Mask);
+		const uint32x2_t Pair = vand_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+		return (vget_lane_u32(Pair, 0) & vget_lane_u32(Pair, 1)) != 0;
+#else
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			uint32_t Bits;
+			std::memcpy(&Bits, &Mask.V[Lane], sizeof(Bits));
+			if (Bits == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+#endif
+	}
+
+	/**
+	 * @brief Indica si la mscara est activa en algn carril.
+	 *
+	 * @param Mask Resultado de una comparacin (VectorCompare*).
+	 */
+	inline bool VectorAnyTrue(VectorRegister Mask)
+	{
+#if EU_VECTOR_SSE
+		return _mm_movemask_ps(Mask) != 0;
+#elif EU_VECTOR_NEON
+		const uint32x4_t Bits = vreinterpretq_u32_f32(Mask);
+		const uint32x2_t Pair = vorr_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+		return (vget_lane_u32(Pair, 0) | vget_lane_u32(Pair, 1)) != 0;
+#else
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			uint32_t Bits;
+			std::memcpy(&Bits, &Mask.V[Lane], sizeof(Bits));
+			if (Bits != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief A * B + C con dos redondeos (no FMA), igual que la expresin escalar.
+	 */
+	inline VectorRegister VectorMultiplyAdd(VectorRegister A, VectorRegister B, VectorRegister C)
+	{
+		return VectorAdd(VectorMultiply(A, B), C);
+	}
+
+	inline VectorRegister VectorNegate(VectorRegister Vec)
+	{
+#if EU_VECTOR_SSE
+		return _mm_xor_ps(Vec, _mm_set1_ps(-0.0f));
+#elif EU_VECTOR_NEON
+		return vnegq_f32(Vec);
+#else
+		return VectorRegister{ { -Vec.V[0], -Vec.V[1], -Vec.V[2], -Vec.V[3] } };
+#endif
+	}
+
+	/**
+	 * @brief Valor absoluto por carril (borra el bit de signo).
+	 */
+	inline VectorRegister VectorAbs(VectorRegister Vec)
+	{
+#if EU_VECTOR_SSE
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec);
+#elif EU_VECTOR_NEON
+		return vabsq_f32(Vec);
+#else
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			uint32_t Bits;
+			std::memcpy(&Bits, &Vec.V[Lane], sizeof(Bits));
+			Bits &= 0x7fffffffu;
+			std::memcpy(&Vec.V[Lane], &Bits, sizeof(Bits));
+		}
+		return Vec;
+#endif
+	}
+
+	/**
+	 * @brief Suma los 4 carriles en el orden ((x + y) + z) + w.
+	 */
+	inline float VectorSum(VectorRegister Vec)
+	{
+		VectorRegister Sum = VectorAdd(Vec, VectorReplicate<1>(Vec));
+		Sum = VectorAdd(Sum, VectorReplicate<2>(Vec));
+		Sum = VectorAdd(Sum, VectorReplicate<3>(Vec));
+		return VectorGetComponent<0>(Sum);
+	}
+
+	/**
+	 * @brief Producto punto de 4 componentes.
+	 */
+	inline float VectorDot4(VectorRegister A, VectorRegister B)
+	{
+		return VectorSum(VectorMultiply(A, B));
+	}
+
+	/**
+	 * @brief Producto cruz de los carriles XYZ; el carril W resultante es 0.
+	 */
+	inline VectorRegister VectorCross3(VectorRegister A, VectorRegister B)
+	{
+		VectorRegister Left = VectorMultiply(VectorSwizzle<1, 2, 0, 3>(A), VectorSwizzle<2, 0, 1, 3>(B));
+		VectorRegister Right = VectorMultiply(VectorSwizzle<2, 0, 1, 3>(A), VectorSwizzle<1, 2, 0, 3>(B));
+		return VectorSubtract(Left, Right);
+	}
+
+	/**
+	 * @brief Transpone en el sitio la matriz 4x4 cuyas filas son R0..R3.
+	 */
+	inline void VectorTranspose4x4(VectorRegister& R0, VectorRegister& R1,
+	                               VectorRegister& R2, VectorRegister& R3)
+	{
+		const VectorRegister T0 = VectorShuffle<0, 1, 0, 1>(R0, R1);
+		const VectorRegister T1 = VectorShuffle<2, 3, 2, 3>(R0, R1);
+		const VectorRegister T2 = VectorShuffle<0, 1, 0, 1>(R2, R3);
+		const VectorRegister T3 = VectorShuffle<2, 3, 2, 3>(R2, R3);
+		R0 = VectorShuffle<0, 2, 0, 2>(T0, T2);
+		R1 = VectorShuffle<1, 3, 1, 3>(T0, T2);
+		R2 = VectorShuffle<0, 2, 0, 2>(T1, T3);
+		R3 = VectorShuffle<1, 3, 1, 3>(T1, T3);
+	}
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		alignas(16) float Position[4] = { 1.0f, 2.0f, 3.0f, 1.0f };
+		VectorRegister P = VectorLoad(Position);
+		VectorRegister Offset = VectorSet(0.5f, 0.0f, 0.0f, 0.0f);
+
+		VectorStore(VectorAdd(P, Offset), Position);   // (1.5, 2, 3, 1)
+		float LengthSq = VectorDot4(P, P);            // 15
+		return 0;
+	}
+	*/
+}
+EU_FLOAT_PRECISE_END
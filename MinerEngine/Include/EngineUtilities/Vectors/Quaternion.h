@@ -28,16 +28,94 @@
 */
 #pragma once
 
-#include "Utilities/EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
+#include "EngineUtilities/Utilities/VectorRegister.h"
+#include "EngineUtilities/Matrix/Matrix4x4.h"
 #include "Vector3.h"
+EU_FLOAT_PRECISE_BEGIN
 namespace EU {
 	/**
+	 * @brief Polynomial form of sin(t * angle) / sin(angle) from D. Eberly, "A Fast and Accurate
+	 * Algorithm for Computing SLERP" (2011): no acos, sin or division.
+	 *
+	 * The absolute error is below 1e-7 for cosAngle >= 0.7 (rotations less than about 90 degrees
+	 * apart) but grows to 1.9e-5 near cosAngle = 0.1. Use VectorSlerpWeight, which keeps it in range.
+	 *
+	 * @param cosAngle Cosine of the angle between the quaternions, in [0, 1].
+	 * @param t Interpolation factor of each lane, in [0, 1].
+	 */
+	inline VectorRegister VectorSlerpWeightPolynomial(VectorRegister cosAngle, VectorRegister t) {
+		// u[i] = 1 / (i * (2i + 1)), v[i] = i / (2i + 1); the last term is scaled by mu
+		// to absorb the truncation error of the series.
+		static const float u[8] = {
+			1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+			1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), 1.85298109240830f / (8 * 17)
+		};
+		static const float v[8] = {
+			1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+			5.0f / 11, 6.0f / 13, 7.0f / 15, 1.85298109240830f * 8 / 17
+		};
+		const VectorRegister one = VectorSplat(1.0f);
+		const VectorRegister cosMinusOne = VectorSubtract(cosAngle, one);
+		const VectorRegister tSquared = VectorMultiply(t, t);
+		VectorRegister result = one;
+		for (int i = 7; i >= 0; --i) {
+			const VectorRegister b = VectorMultiply(
+				VectorSubtract(VectorMultiply(VectorSplat(u[i]), tSquared), VectorSplat(v[i])), cosMinusOne);
+			result = VectorAdd(one, VectorMultiply(b, result));
+		}
+		return VectorMultiply(t, result);
+	}
+
+	/**
+	 * @brief Per-lane slerp weight sin(t * angle) / sin(angle), with cos(angle) = cosAngle.
+	 *
+	 * Lanes with cosAngle >= 0.7 use VectorSlerpWeightPolynomial directly. Wider lanes work
+	 * on the half angle h, whose cosine sqrt((1 + cosAngle) / 2) is at least 0.707:
+	 *   sin(t * angle) / sin(angle) = W(h, a) / (2 cos h) + W(h, b),
+	 *   a = 1 - |1 - 2t|, b = max(2t - 1, 0),
+	 * where W(h, s) = sin(s * h) / sin(h) and both a and b stay in [0, 1]. Each path only
+	 * runs when some lane needs it. Measured against the exact double weight on a grid over
+	 * cosAngle in [0, 1] and t in [0, 1]: absolute error below 2e-7.
+	 * Quaternion::slerp and the batch kernels share it, so they give the same bits.
+	 *
+	 * @param cosAngle Cosine of the angle between the quaternions, in [0, 1].
+	 * @param t Interpolation factor of each lane, in [0, 1].
+	 * @return The weight of each lane.
+	 */
+	inline VectorRegister VectorSlerpWeight(VectorRegister cosAngle, VectorRegister t) {
+		const VectorRegister isNarrow = VectorCompareGreaterEqual(cosAngle, VectorSplat(0.7f));
+		if (VectorAllTrue(isNarrow)) {
+			return VectorSlerpWeightPolynomial(cosAngle, t);
+		}
+
+		const VectorRegister one = VectorSplat(1.0f);
+		const VectorRegister cosHalf = VectorSqrt(VectorMultiply(VectorAdd(one, cosAngle), VectorSplat(0.5f)));
+		const VectorRegister twoT = VectorAdd(t, t);
+		const VectorRegister a = VectorSubtract(one, VectorAbs(VectorSubtract(one, twoT)));
+		const VectorRegister excess = VectorSubtract(twoT, one);
+		const VectorRegister b = VectorSelect(VectorCompareGreaterEqual(excess, VectorZero()), excess, VectorZero());
+		const VectorRegister halved = VectorAdd(
+			VectorDivide(VectorSlerpWeightPolynomial(cosHalf, a), VectorAdd(cosHalf, cosHalf)),
+			VectorSlerpWeightPolynomial(cosHalf, b));
+		if (!VectorAnyTrue(isNarrow)) {
+			return halved;
+		}
+		return VectorSelect(isNarrow, VectorSlerpWeightPolynomial(cosAngle, t), halved);
+	}
+
+	/**
  * @brief A quaternion class.
  *
  * This class represents a quaternion, providing operations such as addition,
  * subtraction, scalar multiplication, normalization, and quaternion multiplication.
+ *
+ * The four components are stored 16-byte aligned in (w, x, y, z) order and every
+ * operation runs on a VectorRegister (SSE2/NEON, same bits as the scalar path).
+ * The arithmetic operators are EU_SIMD_CONSTEXPR and take that scalar path during
+ * constant evaluation, so constant rotations can be composed at compile time.
  */
-	class Quaternion {
+	class alignas(16) Quaternion {
 	public:
 		float w; /**< The real part of the quaternion. */
 		float x; /**< The i component of the quaternion. */
@@ -49,7 +127,7 @@ namespace EU {
 		 *
 		 * Initializes the quaternion to (1, 0, 0, 0).
 		 */
-		Quaternion() : w(1), x(0), y(0), z(0) {}
+		constexpr Quaternion() : w(1), x(0), y(0), z(0) {}
 
 		/**
 		 * @brief Parameterized constructor.
@@ -61,7 +139,21 @@ namespace EU {
 		 * @param y The j component.
 		 * @param z The k component.
 		 */
-		Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
+		constexpr Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
+
+		/**
+		 * @brief Builds the quaternion from a SIMD register holding (w, x, y, z).
+		 */
+		explicit Quaternion(VectorRegister vec) {
+			VectorStore(vec, &w);
+		}
+
+		/**
+		 * @brief Loads the quaternion into a SIMD register as (w, x, y, z).
+		 */
+		VectorRegister toRegister() const {
+			return VectorLoad(&w);
+		}
 
 		/**
 		 * @brief Adds another quaternion to this quaternion.
@@ -69,8 +161,11 @@ namespace EU {
 		 * @param other The quaternion to add.
 		 * @return The result of the addition.
 		 */
-		Quaternion operator+(const Quaternion& other) const {
-			return Quaternion(w + other.w, x + other.x, y + other.y, z + other.z);
+		EU_SIMD_CONSTEXPR Quaternion operator+(const Quaternion& other) const {
+			if (EU_IS_CONSTANT_EVALUATED()) {
+				return Quaternion(w + other.w, x + other.x, y + other.y, z + other.z);
+			}
+			return Quaternion(VectorAdd(toRegister(), other.toRegister()));
 		}
 
 		/**
@@ -79,8 +174,11 @@ namespace EU {
 		 * @param other The quaternion to subtract.
 		 * @return The result of the subtraction.
 		 */
-		Quaternion operator-(const Quaternion& other) const {
-			return Quaternion(w - other.w, x - other.x, y - other.y, z - other.z);
+		EU_SIMD_CONSTEXPR Quaternion operator-(const Quaternion& other) const {
+			if (EU_IS_CONSTANT_EVALUATED()) {
+				return Quaternion(w - other.w, x - other.x, y - other.y, z - other.z);
+			}
+			return Quaternion(VectorSubtract(toRegister(), other.toRegister()));
 		}
 
 		/**
@@ -89,8 +187,11 @@ namespace EU {
 		 * @param scalar The scalar to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Quaternion operator*(float scalar) const {
-			return Quaternion(w * scalar, x * scalar, y * scalar, z * scalar);
+		EU_SIMD_CONSTEXPR Quaternion operator*(float scalar) const {
+			if (EU_IS_CONSTANT_EVALUATED()) {
+				return Quaternion(w * scalar, x * scalar, y * scalar, z * scalar);
+			}
+			return Quaternion(VectorMultiply(toRegister(), VectorSplat(scalar)));
 		}
 
 		/**
@@ -99,13 +200,30 @@ namespace EU {
 		 * @param other The quaternion to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Quaternion operator*(const Quaternion& other) const {
-			return Quaternion(
-				w * other.w - x * other.x - y * other.y - z * other.z,
-				w * other.x + x * other.w + y * other.z - z * other.y,
-				w * other.y - x * other.z + y * other.w + z * other.x,
-				w * other.z + x * other.y - y * other.x + z * other.w
-			);
+		EU_SIMD_CONSTEXPR Quaternion operator*(const Quaternion& other) const {
+			if (EU_IS_CONSTANT_EVALUATED()) {
+				return Quaternion(w * other.w - x * other.x - y * other.y - z * other.z,
+				                  w * other.x + x * other.w + y * other.z - z * other.y,
+				                  w * other.y - x * other.z + y * other.w + z * other.x,
+				                  w * other.z + x * other.y - y * other.x + z * other.w);
+			}
+			// (w, x, y, z) lanes:
+			//   w * ow - x * ox - y * oy - z * oz
+			//   w * ox + x * ow + y * oz - z * oy
+			//   w * oy - x * oz + y * ow + z * ox
+			//   w * oz + x * oy - y * ox + z * ow
+			// Each column is a scalar times a permutation of other, with the signs applied
+			// by an exact multiply by +-1.
+			const VectorRegister a = toRegister();
+			const VectorRegister b = other.toRegister();
+			VectorRegister result = VectorMultiply(VectorReplicate<0>(a), b);
+			result = VectorAdd(result, VectorMultiply(VectorMultiply(VectorReplicate<1>(a), VectorSwizzle<1, 0, 3, 2>(b)),
+			                                          VectorSet(-1.0f, 1.0f, -1.0f, 1.0f)));
+			result = VectorAdd(result, VectorMultiply(VectorMultiply(VectorReplicate<2>(a), VectorSwizzle<2, 3, 0, 1>(b)),
+			                                          VectorSet(-1.0f, 1.0f, 1.0f, -1.0f)));
+			result = VectorAdd(result, VectorMultiply(VectorMultiply(VectorReplicate<3>(a), VectorSwizzle<3, 2, 1, 0>(b)),
+			                                          VectorSet(-1.0f, -1.0f, 1.0f, 1.0f)));
+			return Quaternion(result);
 		}
 
 		/**
@@ -114,7 +232,7 @@ namespace EU {
 		 * @param other The quaternion to compare with.
 		 * @return True if the quaternions are equal, false otherwise.
 		 */
-		bool operator==(const Quaternion& other) const {
+		constexpr bool operator==(const Quaternion& other) const {
 			return (w == other.w && x == other.x && y == other.y && z == other.z);
 		}
 
@@ -124,7 +242,7 @@ namespace EU {
 		 * @param other The quaternion to compare with.
 		 * @return True if the quaternions are not equal, false otherwise.
 		 */
-		bool operator!=(const Quaternion& other) const {
+		constexpr bool operator!=(const Quaternion& other) const {
 			return !(*this == other);
 		}
 
@@ -134,7 +252,7 @@ namespace EU {
 		 * @return The magnitude of the quaternion.
 		 */
 		float magnitude() const {
-			return EngineUtilities::sqrt(w * w + x * x + y * y + z * z);
+			return EU::sqrt(VectorDot4(toRegister(), toRegister()));
 		}
 
 		/**
@@ -147,7 +265,7 @@ namespace EU {
 			if (mag == 0) {
 				return Quaternion(1, 0, 0, 0);
 			}
-			return Quaternion(w / mag, x / mag, y / mag, z / mag);
+			return Quaternion(VectorDivide(toRegister(), VectorSplat(mag)));
 		}
 
 		/**
@@ -155,7 +273,7 @@ namespace EU {
 		 *
 		 * @return The conjugated quaternion.
 		 */
-		Quaternion conjugate() const {
+		constexpr Quaternion conjugate() const {
 			return Quaternion(w, -x, -y, -z);
 		}
 
@@ -165,7 +283,7 @@ namespace EU {
 		 * @return The inverted quaternion.
 		 */
 		Quaternion inverse() const {
-			float magSquared = w * w + x * x + y * y + z * z;
+			float magSquared = VectorDot4(toRegister(), toRegister());
 			if (magSquared == 0) {
 				// Handling division by zero
 				return Quaternion(1, 0, 0, 0);
@@ -176,13 +294,75 @@ namespace EU {
 		/**
 		 * @brief Rotates a vector by this quaternion.
 		 *
+		 * Uses v' = v + w * t + q.xyz x t, with t = 2 * (q.xyz x v). That is 15 multiplies,
+		 * against more than 30 plus a division for q * v * q^-1.
+		 *
 		 * @param v The vector to rotate.
 		 * @return The rotated vector.
+		 * @note The quaternion must be normalized.
 		 */
-		Vector3 rotate(const Vector3& v) const {
-			Quaternion qv(0, v.x, v.y, v.z);
-			Quaternion result = (*this) * qv * this->inverse();
-			return Vector3(result.x, result.y, result.z);
+		constexpr Vector3 rotate(const Vector3& v) const {
+			const float tx = 2.0f * (y * v.z - z * v.y);
+			const float ty = 2.0f * (z * v.x - x * v.z);
+			const float tz = 2.0f * (x * v.y - y * v.x);
+			return Vector3(v.x + w * tx + (y * tz - z * ty),
+			               v.y + w * ty + (z * tx - x * tz),
+			               v.z + w * tz + (x * ty - y * tx));
+		}
+
+		/**
+		 * @brief Dot product of two quaternions (cosine of half the angle between unit rotations).
+		 */
+		static EU_SIMD_CONSTEXPR float dot(const Quaternion& a, const Quaternion& b) {
+			if (EU_IS_CONSTANT_EVALUATED()) {
+				return a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+			}
+			return VectorDot4(a.toRegister(), b.toRegister());
+		}
+
+		/**
+		 * @brief Normalized linear interpolation along the shortest path.
+		 *
+		 * It is the cheapest blend. Its angular speed is not constant, but the error is small
+		 * for the nearby rotations of animation blending.
+		 *
+		 * @param a The rotation at t = 0.
+		 * @param b The rotation at t = 1.
+		 * @param t The interpolation factor.
+		 * @return The normalized interpolated quaternion.
+		 */
+		static Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) {
+			const VectorRegister ra = a.toRegister();
+			VectorRegister rb = b.toRegister();
+			if (VectorDot4(ra, rb) < 0.0f) {
+				rb = VectorNegate(rb);
+			}
+			return Quaternion(VectorAdd(ra, VectorMultiply(VectorSubtract(rb, ra), VectorSplat(t)))).normalize();
+		}
+
+		/**
+		 * @brief Spherical linear interpolation along the shortest path (constant angular speed).
+		 *
+		 * The weights come from VectorSlerpWeight: a polynomial with no acos or sin, within
+		 * 2e-7 of the exact slerp weights at any angle (see VectorSlerpWeight). Both weights
+		 * are computed in one register.
+		 *
+		 * @param a The rotation at t = 0 (normalized).
+		 * @param b The rotation at t = 1 (normalized).
+		 * @param t The interpolation factor.
+		 * @return The interpolated quaternion.
+		 */
+		static Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) {
+			const VectorRegister ra = a.toRegister();
+			VectorRegister rb = b.toRegister();
+			float cosAngle = VectorDot4(ra, rb);
+			if (cosAngle < 0.0f) {
+				cosAngle = -cosAngle;
+				rb = VectorNegate(rb);
+			}
+			const VectorRegister weights = VectorSlerpWeight(VectorSplat(cosAngle), VectorSet(1.0f - t, t, 0.0f, 0.0f));
+			return Quaternion(VectorAdd(VectorMultiply(ra, VectorReplicate<0>(weights)),
+			                            VectorMultiply(rb, VectorReplicate<1>(weights))));
 		}
 
 		/**
@@ -194,9 +374,9 @@ namespace EU {
 		 */
 		static Quaternion fromAxisAngle(const Vector3& axis, float angle) {
 			float halfAngle = angle * 0.5f;
-			float sinHalfAngle = EngineUtilities::sin(halfAngle);
+			float sinHalfAngle = EU::sin(halfAngle);
 			return Quaternion(
-				EngineUtilities::cos(halfAngle),
+				EU::cos(halfAngle),
 				axis.x * sinHalfAngle,
 				axis.y * sinHalfAngle,
 				axis.z * sinHalfAngle
@@ -208,28 +388,104 @@ namespace EU {
 		 *
 		 * @return Pointer to the first element (w, x, y, z).
 		 */
-		const float* data() const {
+		constexpr const float* data() const {
 			return &w;
 		}
 
 		/**
 		 * @brief Converts the quaternion to a 4x4 rotation matrix.
 		 *
+		 * Uses the Matrix4x4 convention (row vectors, v * M), the same as
+		 * XMMatrixRotationQuaternion, so v * toMatrix() == rotate(v).
+		 *
 		 * @return The 4x4 matrix representing the rotation.
+		 * @note The quaternion must be normalized.
+		 */
+		constexpr Matrix4x4 toMatrix() const {
+			const float xx = x * x, yy = y * y, zz = z * z;
+			const float xy = x * y, xz = x * z, yz = y * z;
+			const float wx = w * x, wy = w * y, wz = w * z;
+			return Matrix4x4(1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy), 0,
+			                 2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx), 0,
+			                 2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy), 0,
+			                 0, 0, 0, 1);
+		}
+
+		/**
+		 * @brief Extracts the rotation of a matrix (inverse of toMatrix).
+		 *
+		 * Shepperd's method: the square root is taken of the largest of w, x, y and z, so the
+		 * division never goes through a value close to zero.
+		 *
+		 * @param m A matrix whose upper 3x3 block is a pure rotation.
+		 * @return The normalized quaternion of the rotation.
 		 */
-		/*Matrix4x4 toMatrix() const {
-			Matrix4x4 result;
-			result[0][0] = 1 - 2 * (y * y + z * z);
-			result[0][1] = 2 * (x * y - z * w);
-			result[0][2] = 2 * (x * z + y * w);
-			result[1][0] = 2 * (x * y + z * w);
-			result[1][1] = 1 - 2 * (x * x + z * z);
-			result[1][2] = 2 * (y * z - x * w);
-			result[2][0] = 2 * (x * z - y * w);
-			result[2][1] = 2 * (y * z + x * w);
-			result[2][2] = 1 - 2 * (x * x + y * y);
-			result[3][3] = 1;
-			return result;
-		}*/
+		static Quaternion fromMatrix(const Matrix4x4& m) {
+			const float trace = m.m[0][0] + m.m[1][1] + m.m[2][2];
+			if (trace > 0.0f) {
+				const float s = EU::sqrt(trace + 1.0f) * 2.0f;
+				const float invS = 1.0f / s;
+				return Quaternion(0.25f * s,
+				                  (m.m[1][2] - m.m[2][1]) * invS,
+				                  (m.m[2][0] - m.m[0][2]) * invS,
+				                  (m.m[0][1] - m.m[1][0]) * invS);
+			}
+			if (m.m[0][0] > m.m[1][1] && m.m[0][0] > m.m[2][2]) {
+				const float s = EU::sqrt(1.0f + m.m[0][0] - m.m[1][1] - m.m[2][2]) * 2.0f;
+				const float invS = 1.0f / s;
+				return Quaternion((m.m[1][2] - m.m[2][1]) * invS,
+				                  0.25f * s,
+				                  (m.m[0][1] + m.m[1][0]) * invS,
+				                  (m.m[2][0] + m.m[0][2]) * invS);
+			}
+			if (m.m[1][1] > m.m[2][2]) {
+				const float s = EU::sqrt(1.0f + m.m[1][1] - m.m[0][0] - m.m[2][2]) * 2.0f;
+				const float invS = 1.0f / s;
+				return Quaternion((m.m[2][0] - m.m[0][2]) * invS,
+				                  (m.m[0][1] + m.m[1][0]) * invS,
+				                  0.25f * s,
+				                  (m.m[1][2] + m.m[2][1]) * invS);
+			}
+			const float s = EU::sqrt(1.0f + m.m[2][2] - m.m[0][0] - m.m[1][1]) * 2.0f;
+			const float invS = 1.0f / s;
+			return Quaternion((m.m[0][1] - m.m[1][0]) * invS,
+			                  (m.m[2][0] + m.m[0][2]) * invS,
+			                  (m.m[1][2] + m.m[2][1]) * invS,
+			                  0.25f * s);
+		}
+
+		/**
+		 * @brief Builds the rotation of XMMatrixRotationRollPitchYaw(pitch, yaw, roll).
+		 *
+		 * Roll (around Z) is applied first, then pitch (around X), then yaw (around Y).
+		 *
+		 * @param pitch Angle around the X axis, in radians.
+		 * @param yaw Angle around the Y axis, in radians.
+		 * @param roll Angle around the Z axis, in radians.
+		 * @return The normalized quaternion of the rotation.
+		 */
+		static Quaternion fromRollPitchYaw(float pitch, float yaw, float roll) {
+			float sp, cp, sy, cy, sr, cr;
+			EU::sinCos(pitch * 0.5f, sp, cp);
+			EU::sinCos(yaw * 0.5f, sy, cy);
+			EU::sinCos(roll * 0.5f, sr, cr);
+			// qYaw * qPitch * qRoll, expanded.
+			return Quaternion(cy * cp * cr + sy * sp * sr,
+			                  cy * sp * cr + sy * cp * sr,
+			                  sy * cp * cr - cy * sp * sr,
+			                  cy * cp * sr - sy * sp * cr);
+		}
 	};
+
+	static_assert(Quaternion(0, 0, 0, 1).rotate(Vector3(1, 0, 0)) == Vector3(-1, 0, 0), "Quaternion::rotate: resultado incorrecto");
+	static_assert(Quaternion(0, 1, 0, 0).toMatrix() == Matrix4x4(1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1),
+	              "Quaternion::toMatrix: resultado incorrecto");
+#if EU_HAS_CONSTANT_EVALUATED
+	static_assert(Quaternion(0, 1, 0, 0) * Quaternion(0, 0, 1, 0) == Quaternion(0, 0, 0, 1), "Quaternion: i * j != k");
+	static_assert(Quaternion(1, 2, 3, 4) * Quaternion(1, 2, 3, 4).conjugate() == Quaternion(30, 0, 0, 0),
+	              "Quaternion: resultado incorrecto");
+	static_assert(Quaternion::dot(Quaternion(1, 2, 3, 4) + Quaternion() - Quaternion(), Quaternion(1, 1, 1, 1) * 2.0f) == 20.0f,
+	              "Quaternion::dot: resultado incorrecto");
+#endif
 }
+EU_FLOAT_PRECISE_END
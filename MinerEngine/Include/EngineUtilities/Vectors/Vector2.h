@@ -27,7 +27,7 @@
  * SOFTWARE.
 */
 #pragma once
-#include "EngineUtilities\Utilities\EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
 namespace EU {
   /**
    * @brief A 2D vector class.
@@ -47,7 +47,7 @@ namespace EU {
      *
      * Initializes the vector to (0, 0).
      */
-    Vector2() : x(0), y(0) {}
+    constexpr Vector2() : x(0), y(0) {}
 
     /**
      * @brief Parameterized constructor.
@@ -57,7 +57,7 @@ namespace EU {
      * @param x The x-coordinate.
      * @param y The y-coordinate.
      */
-    Vector2(float x, float y) : x(x), y(y) {}
+    constexpr Vector2(float x, float y) : x(x), y(y) {}
 
     /**
      * @brief Adds another vector to this vector.
@@ -65,7 +65,7 @@ namespace EU {
      * @param other The vector to add.
      * @return The result of the addition.
      */
-    Vector2
+    constexpr Vector2
       operator+(const Vector2& other) const {
       return Vector2(x + other.x, y + other.y);
     }
@@ -76,7 +76,7 @@ namespace EU {
      * @param other The vector to subtract.
      * @return The result of the subtraction.
      */
-    Vector2
+    constexpr Vector2
       operator-(const Vector2& other) const {
       return Vector2(x - other.x, y - other.y);
     }
@@ -87,11 +87,33 @@ namespace EU {
      * @param scalar The scalar to multiply by.
      * @return The result of the multiplication.
      */
-    Vector2
+    constexpr Vector2
       operator*(float scalar) const {
       return Vector2(x * scalar, y * scalar);
     }
 
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The vector to compare with.
+     * @return True if the vectors are equal, false otherwise.
+     */
+    constexpr bool
+      operator==(const Vector2& other) const {
+      return x == other.x && y == other.y;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The vector to compare with.
+     * @return True if the vectors are not equal, false otherwise.
+     */
+    constexpr bool
+      operator!=(const Vector2& other) const {
+      return !(*this == other);
+    }
+
     /**
      * @brief Calculates the magnitude (length) of the vector.
      *
@@ -125,4 +147,6 @@ namespace EU {
       return &x;
     }
   };
+
+  static_assert(Vector2(1, 2) + Vector2(3, 4) - Vector2(1, 1) * 2.0f == Vector2(2, 4), "Vector2: resultado incorrecto");
 }
\ No newline at end of file
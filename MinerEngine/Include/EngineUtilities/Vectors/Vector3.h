@@ -28,7 +28,7 @@
 */
 #pragma once
 
-#include "EngineUtilities\Utilities\EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
 namespace EU {
 	/**
  * @brief A 3D vector class.
@@ -48,7 +48,7 @@ namespace EU {
 		 *
 		 * Initializes the vector to (0, 0, 0).
 		 */
-		Vector3() : x(0), y(0), z(0) {}
+		constexpr Vector3() : x(0), y(0), z(0) {}
 
 		/**
 		 * @brief Parameterized constructor.
@@ -59,7 +59,7 @@ namespace EU {
 		 * @param y The y-coordinate.
 		 * @param z The z-coordinate.
 		 */
-		Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+		constexpr Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
 
 		/**
 		 * @brief Adds another vector to this vector.
@@ -67,12 +67,12 @@ namespace EU {
 		 * @param other The vector to add.
 		 * @return The result of the addition.
 		 */
-		Vector3 operator+(const Vector3& other) const {
+		constexpr Vector3 operator+(const Vector3& other) const {
 			return Vector3(x + other.x, y + other.y, z + other.z);
 		}
 
 		// Operador += (para acumuladores de tangentes/bitangentes)
-		Vector3& operator+=(const Vector3& other) {
+		constexpr Vector3& operator+=(const Vector3& other) {
 			x += other.x; y += other.y; z += other.z;
 			return *this;
 		}
@@ -83,7 +83,7 @@ namespace EU {
 		 * @param other The vector to subtract.
 		 * @return The result of the subtraction.
 		 */
-		Vector3 operator-(const Vector3& other) const {
+		constexpr Vector3 operator-(const Vector3& other) const {
 			return Vector3(x - other.x, y - other.y, z - other.z);
 		}
 
@@ -93,10 +93,30 @@ namespace EU {
 		 * @param scalar The scalar to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Vector3 operator*(float scalar) const {
+		constexpr Vector3 operator*(float scalar) const {
 			return Vector3(x * scalar, y * scalar, z * scalar);
 		}
 
+		/**
+		 * @brief Equality operator.
+		 *
+		 * @param other The vector to compare with.
+		 * @return True if the vectors are equal, false otherwise.
+		 */
+		constexpr bool operator==(const Vector3& other) const {
+			return x == other.x && y == other.y && z == other.z;
+		}
+
+		/**
+		 * @brief Inequality operator.
+		 *
+		 * @param other The vector to compare with.
+		 * @return True if the vectors are not equal, false otherwise.
+		 */
+		constexpr bool operator!=(const Vector3& other) const {
+			return !(*this == other);
+		}
+
 		/**
 		 * @brief Calculates the magnitude (length) of the vector.
 		 *
@@ -119,23 +139,23 @@ namespace EU {
 			return Vector3(x / mag, y / mag, z / mag);
 		}
 
-		void
+		constexpr void
 			zero() {
-			Vector3(0, 0, 0);
+			*this = Vector3(0, 0, 0);
 		}
 
-		void
+		constexpr void
 			one() {
-			Vector3(1, 1, 1);
+			*this = Vector3(1, 1, 1);
 		}
 
 
 		// ---- helpers con tu Vector3 ----
-		float dot(const Vector3& a, const Vector3& b) {
+		static constexpr float dot(const Vector3& a, const Vector3& b) {
 			return a.x * b.x + a.y * b.y + a.z * b.z;
 		}
 
-		Vector3 cross(const Vector3& a, const Vector3& b) {
+		static constexpr Vector3 cross(const Vector3& a, const Vector3& b) {
 			return Vector3(
 				a.y * b.z - a.z * b.y,
 				a.z * b.x - a.x * b.z,
@@ -145,7 +165,11 @@ namespace EU {
 
 		// Mtodo para obtener un puntero a los datos como un arreglo
 		// @return: Puntero a los componentes del vector
-		float* data() { return &x; }
-		const float* data() const { return &x; }
+		constexpr float* data() { return &x; }
+		constexpr const float* data() const { return &x; }
 	};
+
+	static_assert(Vector3::cross(Vector3(1, 0, 0), Vector3(0, 1, 0)) == Vector3(0, 0, 1), "Vector3::cross: resultado incorrecto");
+	static_assert(Vector3::dot(Vector3(1, 2, 3), Vector3(4, -5, 6)) == 12.0f, "Vector3::dot: resultado incorrecto");
+	static_assert(Vector3(1, 2, 3) * 2.0f - Vector3(1, 1, 1) + Vector3() == Vector3(1, 3, 5), "Vector3: resultado incorrecto");
 }
\ No newline at end of file
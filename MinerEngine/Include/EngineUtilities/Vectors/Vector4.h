@@ -28,7 +28,9 @@
 */
 #pragma once
 
-#include "EngineUtilities\Utilities\EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
+#include "EngineUtilities/Utilities/VectorRegister.h"
+EU_FLOAT_PRECISE_BEGIN
 namespace EU {
   /**
  * @brief A 4D vector class.
@@ -36,8 +38,13 @@ namespace EU {
  * This class represents a vector in 4-dimensional space and provides
  * basic vector operations such as addition, subtraction, scalar multiplication,
  * and normalization.
+ *
+ * Storage is 16-byte aligned so the vector loads straight into a VectorRegister;
+ * the arithmetic runs on SSE2/NEON and gives the same bits as the scalar path.
+ * The operators are EU_SIMD_CONSTEXPR: during constant evaluation they take that
+ * scalar path, so compile-time and run-time results are identical.
  */
-  class Vector4 {
+  class alignas(16) Vector4 {
   public:
     float x; /**< The x-coordinate of the vector. */
     float y; /**< The y-coordinate of the vector. */
@@ -49,7 +56,7 @@ namespace EU {
      *
      * Initializes the vector to (0, 0, 0, 0).
      */
-    Vector4() : x(0), y(0), z(0), w(0) {}
+    constexpr Vector4() : x(0), y(0), z(0), w(0) {}
 
     /**
      * @brief Parameterized constructor.
@@ -61,7 +68,25 @@ namespace EU {
      * @param z The z-coordinate.
      * @param w The w-coordinate.
      */
-    Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+    /**
+     * @brief Builds the vector from a SIMD register.
+     *
+     * @param vec The register holding (x, y, z, w).
+     */
+    explicit Vector4(VectorRegister vec) {
+      VectorStore(vec, &x);
+    }
+
+    /**
+     * @brief Loads the vector into a SIMD register.
+     *
+     * @return The register holding (x, y, z, w).
+     */
+    VectorRegister toRegister() const {
+      return VectorLoad(&x);
+    }
 
     /**
      * @brief Adds another vector to this vector.
@@ -69,8 +94,11 @@ namespace EU {
      * @param other The vector to add.
      * @return The result of the addition.
      */
-    Vector4 operator+(const Vector4& other) const {
-      return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
+    EU_SIMD_CONSTEXPR Vector4 operator+(const Vector4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
+      }
+      return Vector4(VectorAdd(toRegister(), other.toRegister()));
     }
 
     /**
@@ -79,8 +107,23 @@ namespace EU {
      * @param other The vector to subtract.
      * @return The result of the subtraction.
      */
-    Vector4 operator-(const Vector4& other) const {
-      return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
+    EU_SIMD_CONSTEXPR Vector4 operator-(const Vector4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
+      }
+      return Vector4(VectorSubtract(toRegister(), other.toRegister()));
+    }
+
+    /**
+     * @brief Negates the vector.
+     *
+     * @return The negated vector.
+     */
+    EU_SIMD_CONSTEXPR Vector4 operator-() const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(-x, -y, -z, -w);
+      }
+      return Vector4(VectorNegate(toRegister()));
     }
 
     /**
@@ -89,8 +132,72 @@ namespace EU {
      * @param scalar The scalar to multiply by.
      * @return The result of the multiplication.
      */
-    Vector4 operator*(float scalar) const {
-      return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
+    EU_SIMD_CONSTEXPR Vector4 operator*(float scalar) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
+      }
+      return Vector4(VectorMultiply(toRegister(), VectorSplat(scalar)));
+    }
+
+    /**
+     * @brief Component-wise multiplication.
+     *
+     * @param other The vector to multiply by.
+     * @return The result of the multiplication.
+     */
+    EU_SIMD_CONSTEXPR Vector4 operator*(const Vector4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return Vector4(x * other.x, y * other.y, z * other.z, w * other.w);
+      }
+      return Vector4(VectorMultiply(toRegister(), other.toRegister()));
+    }
+
+    /**
+     * @brief Adds another vector to this vector in place.
+     *
+     * @param other The vector to add.
+     * @return Reference to this vector.
+     */
+    EU_SIMD_CONSTEXPR Vector4& operator+=(const Vector4& other) {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        *this = *this + other;
+        return *this;
+      }
+      VectorStore(VectorAdd(toRegister(), other.toRegister()), &x);
+      return *this;
+    }
+
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The vector to compare with.
+     * @return True if the vectors are equal, false otherwise.
+     */
+    constexpr bool operator==(const Vector4& other) const {
+      return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The vector to compare with.
+     * @return True if the vectors are not equal, false otherwise.
+     */
+    constexpr bool operator!=(const Vector4& other) const {
+      return !(*this == other);
+    }
+
+    /**
+     * @brief Computes the dot product with another vector.
+     *
+     * @param other The other vector.
+     * @return The dot product.
+     */
+    EU_SIMD_CONSTEXPR float dot(const Vector4& other) const {
+      if (EU_IS_CONSTANT_EVALUATED()) {
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+      }
+      return VectorDot4(toRegister(), other.toRegister());
     }
 
     /**
@@ -99,7 +206,7 @@ namespace EU {
      * @return The magnitude of the vector.
      */
     float magnitude() const {
-      return EU::sqrt(x * x + y * y + z * z + w * w);
+      return EU::sqrt(dot(*this));
     }
 
     /**
@@ -112,16 +219,23 @@ namespace EU {
       if (mag == 0) {
         return Vector4(0, 0, 0, 0);
       }
-      return Vector4(x / mag, y / mag, z / mag, w / mag);
+      return Vector4(VectorDivide(toRegister(), VectorSplat(mag)));
     }
 
     /**
-     * @brief Returns a pointer to the quaternion's data.
+     * @brief Returns a pointer to the vector's data.
      *
      * @return Pointer to the first element (x, y, z, w).
      */
-    const float* data() const {
+    constexpr const float* data() const {
       return &x;
     }
   };
-}
\ No newline at end of file
+
+#if EU_HAS_CONSTANT_EVALUATED
+  static_assert(Vector4(1, 2, 3, 4) * 2.0f - Vector4(1, 1, 1, 1) == Vector4(1, 3, 5, 7), "Vector4: resultado incorrecto");
+  static_assert(-Vector4(1, 2, 3, 4) * Vector4(2, 2, 2, 2) + Vector4() == Vector4(-2, -4, -6, -8), "Vector4: resultado incorrecto");
+  static_assert(Vector4(1, 2, 3, 4).dot(Vector4(4, 3, 2, 1)) == 20.0f, "Vector4::dot: resultado incorrecto");
+#endif
+}
+EU_FLOAT_PRECISE_END
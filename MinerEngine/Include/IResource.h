@@ -19,7 +19,9 @@ enum class
 	Failed
 };
 
-class IResource {
+/// Recuento de referencias intrusivo: los recursos se comparten con EU::TRefPtr
+/// sin bloque de control aparte.
+class IResource : public EU::TRefCounted<> {
 public:
 	IResource(const std::string& name)
 		: m_name(name)
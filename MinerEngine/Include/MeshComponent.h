@@ -13,9 +13,12 @@ class DeviceContext;
  * - Lista de vrtices (posicin, normal, UV, etc.).
  * - Lista de ndices que definen las primitivas (tringulos, lneas).
  * - Contadores de vrtices e ndices.
+ *
+ * Las instancias creadas con new/MakeRef salen de @c EU::TPool<MeshComponent>, de modo que
+ * los componentes de malla quedan contiguos en memoria.
  */
 class
-  MeshComponent : public Component {
+  MeshComponent : public Component, public EU::TPoolAllocated<MeshComponent> {
 public:
   /**
    * @brief Constructor por defecto.
@@ -73,6 +76,16 @@ public:
     destroy() override {};
 
 public:
+  /**
+   * @brief Vrtices en CPU; sus reservas se atribuyen a @c EU::MemoryTag::Mesh.
+   */
+  using VertexArray = std::vector<SimpleVertex, EU::TTaggedAllocator<SimpleVertex, EU::MemoryTag::Mesh>>;
+
+  /**
+   * @brief ndices en CPU; sus reservas se atribuyen a @c EU::MemoryTag::Mesh.
+   */
+  using IndexArray = std::vector<unsigned int, EU::TTaggedAllocator<unsigned int, EU::MemoryTag::Mesh>>;
+
   /**
    * @brief Nombre de la malla.
    */
@@ -81,12 +94,12 @@ public:
   /**
    * @brief Lista de vrtices de la malla.
    */
-  std::vector<SimpleVertex> m_vertex;
+  VertexArray m_vertex;
 
   /**
    * @brief Lista de ndices que definen las primitivas de la malla.
    */
-  std::vector<unsigned int> m_index;
+  IndexArray m_index;
 
   /**
    * @brief Nmero total de vrtices en la malla.
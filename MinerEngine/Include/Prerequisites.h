@@ -24,6 +24,14 @@
 #include "EngineUtilities\Memory\TWeakPointer.h"
 #include "EngineUtilities\Memory\TStaticPtr.h"
 #include "EngineUtilities\Memory\TUniquePtr.h"
+#include "EngineUtilities\Memory\TRefPtr.h"
+#include "EngineUtilities\Memory\FrameArena.h"
+#include "EngineUtilities\Memory\TPool.h"
+#include "EngineUtilities\Memory\MemoryTracker.h"
+#include "EngineUtilities\Memory\VirtualArena.h"
+#include "EngineUtilities\Memory\StackAllocator.h"
+#include "EngineUtilities\Structures\TInlineArray.h"
+#include "EngineUtilities\Utilities\FName.h"
 
 // MACROS
 #define SAFE_RELEASE(x) if(x != nullptr) x->Release(); x = nullptr;
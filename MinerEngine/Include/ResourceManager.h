@@ -18,24 +18,25 @@ public:
 	ResourceManager& operator=(const ResourceManager&) = delete;
 
 	/// Obtener o cargar un recurso de tipo T (T debe heredar de IResource).
+	/// La clave es un EU::FName: la bsqueda en el cach compara enteros, no cadenas.
+	/// El cach guarda una referencia; ReleaseUnused() libera los recursos que ya nadie ms usa.
 	template<typename T, typename... Args>
-	std::shared_ptr<T> GetOrLoad(const std::string& key,
+	EU::TRefPtr<T> GetOrLoad(const EU::FName& key,
                                const std::string& filename,
                                Args&&... args) {
 		static_assert(std::is_base_of<IResource, T>::value,
                       "T debe heredar de IResource");
 		// 1. Ya existe el recurso en el cach?
-		auto it = m_resources.find(key);
-		if (it != m_resources.end()) {
+		if (EU::TRefPtr<IResource>* cached = m_resources.Find(key)) {
 			// Intentar castear al tipo correcto
-			auto existing = std::dynamic_pointer_cast<T>(it->second);
+			auto existing = cached->template dynamic_pointer_cast<T>();
 			if (existing && existing->GetState() == ResourceState::Loaded) {
 				return existing; // Flyweight: reutilizamos la instancia
 			}
 		}
 
 		// 2. No existe o no est cargado -> crearlo y cargarlo
-		std::shared_ptr<T> resource = std::make_shared<T>(key, std::forward<Args>(args)...);
+		EU::TRefPtr<T> resource = EU::MakeRef<T>(key.ToString(), std::forward<Args>(args)...);
 
 		if (!resource->load(filename)) {
 			// Puedes manejar errores ms fino aqu
@@ -47,41 +48,72 @@ public:
 		}
 
 		// 3. Guardar en el cach y devolver
-		m_resources[key] = resource;
+		m_resources.FindOrAdd(key) = EU::TRefPtr<IResource>(resource);
 		return resource;
 	}
 
 	/// Obtener un recurso ya cargado, sin cargarlo si no existe.
 	template<typename T>
-	std::shared_ptr<T> Get(const std::string& key) const
+	EU::TRefPtr<T> Get(const EU::FName& key) const
 	{
-		auto it = m_resources.find(key);
-		if (it == m_resources.end()) return nullptr;
+		const EU::TRefPtr<IResource>* cached = m_resources.Find(key);
+		if (cached == nullptr) return EU::TRefPtr<T>();
 
-		return std::dynamic_pointer_cast<T>(it->second);
+		return cached->template dynamic_pointer_cast<T>();
 	}
 
 	/// Liberar un recurso especfico
-	void Unload(const std::string& key)
+	void Unload(const EU::FName& key)
 	{
-		auto it = m_resources.find(key);
-		if (it != m_resources.end()) {
-			it->second->unload();
-			m_resources.erase(it);
+		if (EU::TRefPtr<IResource>* cached = m_resources.Find(key)) {
+			(*cached)->unload();
+			m_resources.Remove(key);
 		}
 	}
 
 	/// Liberar todos los recursos
 	void UnloadAll()
 	{
-		for (auto& [key, res] : m_resources) {
-			if (res) {
-				res->unload();
+		for (auto& entry : m_resources) {
+			if (entry.Value) {
+				entry.Value->unload();
 			}
 		}
-		m_resources.clear();
+		m_resources.Clear();
+	}
+
+	/// Liberar los recursos cuya nica referencia es la del cach.
+	/// Llamarlo al terminar de cargar o al cambiar de escena. BaseApp an no carga nada a travs del
+	/// cach, as que por ahora solo destroy() lo vaca (UnloadAll).
+	void ReleaseUnused()
+	{
+		EU::TInlineArray<EU::FName, 16> unused;
+		for (auto& entry : m_resources) {
+			if (entry.Value->GetRefCount() == 1) {
+				unused.Add(entry.Key);
+			}
+		}
+		for (const EU::FName& key : unused) {
+			Unload(key);
+		}
+	}
+
+	/// Suma de getSizeInBytes() de todos los recursos cargados (para presupuestos y profiler).
+	size_t GetTotalSizeInBytes() const
+	{
+		size_t total = 0;
+		for (const auto& entry : m_resources) {
+			if (entry.Value && entry.Value->GetState() == ResourceState::Loaded) {
+				total += entry.Value->getSizeInBytes();
+			}
+		}
+		return total;
 	}
 
 private:
-	std::unordered_map<std::string, std::shared_ptr<IResource>> m_resources;
+	/// Referencias fuertes a propsito. IResource lleva el recuento dentro (TRefCounted) y
+	/// TWeakPointer solo sabe observar el bloque de control de un TSharedPointer, que sobrevive
+	/// al objeto; con el contador dentro del recurso no queda nada que consultar una vez
+	/// destruido. Por eso el cach retiene y ReleaseUnused() suelta lo que nadie ms usa.
+	EU::TMap<EU::FName, EU::TRefPtr<IResource>> m_resources;
 };
\ No newline at end of file
@@ -1,5 +1,18 @@
 #include "BaseApp.h"
 #include "ResourceManager.h"
+#include <algorithm>
+
+namespace {
+	/**
+	 * @brief Clave de orden de dibujo: profundidad en espacio de vista y actor al que pertenece.
+	 */
+	struct FDrawKey
+	{
+		float Depth;
+		uint32_t ActorIndex;
+	};
+}
+
 int
 BaseApp::run(HINSTANCE hInst, int nCmdShow) {
 	if (FAILED(m_window.init(hInst, nCmdShow, WndProc))) {
@@ -93,7 +106,10 @@ BaseApp::init() {
 	// Load Resources -> Modelos, Texturas e Interfaz de usuario
 
 	// Set Printstream Actor
-	m_Printstream = EU::MakeShared<Actor>(m_device);
+	{
+		EU::FScopedMemoryTag ecsTag(EU::MemoryTag::ECS);
+		m_Printstream = EU::MakePooledShared<Actor>(m_device);
+	}
 
 	if (!m_Printstream.isNull()) {
 		// Crear vertex buffer y index buffer para el pistol
@@ -114,7 +130,7 @@ BaseApp::init() {
 		m_Printstream->setMesh(m_device, PrintstreamMeshes);
 		m_Printstream->setTextures(PrintstreamTextures);
 		m_Printstream->setName("Printstream");
-		m_actors.push_back(m_Printstream);
+		m_actors.Add(m_Printstream);
 
 		m_Printstream->getComponent<Transform>()->setTransform(EU::Vector3(0.0f, 2.5f, -4.5f),
 			EU::Vector3(0.0f, 1.57f, 0.0f),
@@ -174,7 +190,7 @@ BaseApp::init() {
 	//}
 
 	//auto& resourceMan = ResourceManager::getInstance();
-	//std::shared_ptr<Model3D> model = resourceMan.GetOrLoad<Model3D>("CubeModel", "Printstream.fbx", ModelType::FBX);
+	//EU::TRefPtr<Model3D> model = resourceMan.GetOrLoad<Model3D>("CubeModel", "Printstream.fbx", ModelType::FBX);
 
 
 	// Create the constant buffers
@@ -227,6 +243,10 @@ BaseApp::init() {
 
 void BaseApp::update(float deltaTime)
 {
+	// Nuevo frame: recicla la memoria temporal de hace dos frames
+	EU::FrameArena::Get().BeginFrame();
+	EU::MemoryTracker::Get().BeginFrame();
+
 	// Update our time
 	static float t = 0.0f;
 	if (m_swapChain.m_driverType == D3D_DRIVER_TYPE_REFERENCE)
@@ -295,9 +315,18 @@ BaseApp::render() {
 	m_cbNeverChanges.render(m_deviceContext, 0, 1);
 	m_cbChangeOnResize.render(m_deviceContext, 1, 1);
 
-	// Render all actors
-	for (auto& actor : m_actors) {
-		actor->render(m_deviceContext);
+	// Render all actors, de delante hacia atrs para que el depth test descarte lo tapado.
+	// Las claves viven en la FrameArena del frame: sin reservas en rgimen estable.
+	EU::TSpan<FDrawKey> drawOrder = EU::FrameArena::Get().NewArray<FDrawKey>(m_actors.Num());
+	for (size_t i = 0; i < drawOrder.Num(); ++i) {
+		const EU::Vector3 position = m_actors[i]->getComponent<Transform>()->getPosition();
+		const XMVECTOR viewPosition = XMVector3TransformCoord(XMVectorSet(position.x, position.y, position.z, 1.0f), m_View);
+		drawOrder[i] = { XMVectorGetZ(viewPosition), static_cast<uint32_t>(i) };
+	}
+	std::sort(drawOrder.begin(), drawOrder.end(),
+		[](const FDrawKey& a, const FDrawKey& b) { return a.Depth < b.Depth; });
+	for (const FDrawKey& key : drawOrder) {
+		m_actors[key.ActorIndex]->render(m_deviceContext);
 	}
 
 	// Render UI
@@ -332,6 +361,8 @@ BaseApp::destroy() {
 	//m_vertexBuffer.destroy();
 	//m_indexBuffer.destroy();
 	m_shaderProgram.destroy();
+	// Los recursos del cach pueden tener objetos de GPU: liberarlos antes que el dispositivo
+	ResourceManager::getInstance().UnloadAll();
 	m_depthStencil.destroy();
 	m_depthStencilView.destroy();
 	m_renderTargetView.destroy();
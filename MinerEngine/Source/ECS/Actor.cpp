@@ -4,14 +4,16 @@
 #include "DeviceContext.h"
 
 Actor::Actor(Device& device) {
+	EU::FScopedMemoryTag ecsTag(EU::MemoryTag::ECS);
+
 	// Setup Default Components
-	EU::TSharedPointer<Transform> transform = EU::MakeShared<Transform>();
+	EU::TRefPtr<Transform> transform = EU::MakeRef<Transform>();
 	addComponent(transform);
-	EU::TSharedPointer<MeshComponent> meshComponent = EU::MakeShared<MeshComponent>();
+	EU::TRefPtr<MeshComponent> meshComponent = EU::MakeRef<MeshComponent>();
 	addComponent(meshComponent);
 
 	HRESULT hr;
-	std::string classNameType = "Actor -> " + m_name;
+	std::string classNameType = "Actor -> " + m_name.ToString();
 	hr = m_modelBuffer.init(device, sizeof(CBChangesEveryFrame));
 	if (FAILED(hr)) {
 		ERROR("Actor", classNameType.c_str(), "Failed to create new CBChangesEveryFrame");
@@ -73,11 +75,12 @@ Actor::update(float deltaTime, DeviceContext& deviceContext) {
 		}
 	}
 
-	// Update the model buffer
-	m_model.mWorld = XMMatrixTranspose(getComponent<Transform>()->matrix);
-	m_model.vMeshColor = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
+	// Update the model buffer (UpdateSubresource copia los datos, basta un local)
+	CBChangesEveryFrame model;
+	model.mWorld = XMMatrixTranspose(getComponent<Transform>()->matrix);
+	model.vMeshColor = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
 	// Update the constant buffer
-	m_modelBuffer.update(deviceContext, nullptr, 0, nullptr, &m_model, 0, 0);
+	m_modelBuffer.update(deviceContext, nullptr, 0, nullptr, &model, 0, 0);
 }
 
 void
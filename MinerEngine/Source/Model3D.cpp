@@ -28,7 +28,13 @@ void Model3D::unload()
 
 size_t Model3D::getSizeInBytes() const
 {
-  return 0;
+  // Memoria en CPU de las mallas (los buffers de GPU viven en los Actor)
+  size_t size = sizeof(*this);
+  for (const MeshComponent& mesh : m_meshes) {
+    size += mesh.m_vertex.capacity() * sizeof(SimpleVertex);
+    size += mesh.m_index.capacity() * sizeof(unsigned int);
+  }
+  return size;
 }
 
 bool
@@ -61,6 +67,8 @@ Model3D::InitializeFBXManager() {
 
 std::vector<MeshComponent>
 Model3D::LoadFBXModel(const std::string& filePath) {
+  EU::FScopedMemoryTag loaderTag(EU::MemoryTag::Loader);
+
   // 01. Initialize the SDK from FBX Manager
   if (InitializeFBXManager()) {
     // 02. Create an importer using the SDK manager
@@ -161,10 +169,13 @@ Model3D::ProcessFBXMesh(FbxNode* node) {
   const FbxGeometryElementTangent* tanElem = (mesh->GetElementTangentCount() > 0) ? mesh->GetElementTangent(0) : nullptr;
   const FbxGeometryElementBinormal* binElem = (mesh->GetElementBinormalCount() > 0) ? mesh->GetElementBinormal(0) : nullptr;
 
-  std::vector<SimpleVertex>       vertices;
-  std::vector<unsigned int> indices;
-  vertices.reserve(mesh->GetPolygonCount() * 3);
-  indices.reserve(mesh->GetPolygonCount() * 3);
+  MeshComponent::VertexArray vertices;
+  MeshComponent::IndexArray indices;
+  // Cada polgono de n esquinas se abanica en n - 2 tringulos
+  const int polygonVertexCount = mesh->GetPolygonVertexCount();
+  const int triangleCount = polygonVertexCount - 2 * mesh->GetPolygonCount();
+  vertices.reserve(polygonVertexCount);
+  indices.reserve(triangleCount > 0 ? triangleCount * 3 : 0);
 
   // Helpers de lectura (control point vs. polygon-vertex)
   auto readV2 = [](const FbxGeometryElementUV* elem, int cpIdx, int pvIdx) -> FbxVector2 {
@@ -192,7 +203,7 @@ Model3D::ProcessFBXMesh(FbxNode* node) {
   for (int p = 0; p < mesh->GetPolygonCount(); ++p)
   {
     const int polySize = mesh->GetPolygonSize(p);
-    std::vector<unsigned> cornerIdx; cornerIdx.reserve(polySize);
+    EU::TInlineArray<unsigned, 8> cornerIdx; cornerIdx.Reserve(polySize);
 
     for (int v = 0; v < polySize; ++v)
     {
@@ -235,7 +246,7 @@ Model3D::ProcessFBXMesh(FbxNode* node) {
       //}
       //else out.Bitangent = { 0,0,0 };
 
-      cornerIdx.push_back((unsigned)vertices.size());
+      cornerIdx.Add((unsigned)vertices.size());
       vertices.push_back(out);
     }
 
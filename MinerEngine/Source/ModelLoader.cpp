@@ -1,6 +1,11 @@
 #include "ModelLoader.h"
 #include <cstdio>
 
+// Temporales de carga: viven en la pila temporal del hilo (MemoryTag::Loader) y
+// se liberan en bloque al salir de init, reutilizando las mismas pginas en cada carga
+template<typename T>
+using LoaderArray = std::vector<T, EU::TStackStdAllocator<T>>;
+
 struct VertexData
 {
   unsigned int PosIndex;
@@ -21,12 +26,15 @@ ModelLoader::init(MeshComponent& mesh, const std::string& fileName) {
     return E_INVALIDARG;
   }
 
-  std::vector<XMFLOAT3> temp_positions;
-  std::vector<XMFLOAT2> temp_texcoords;
-  std::vector<XMFLOAT3> temp_normals;
+  EU::FScopedMemoryTag loaderTag(EU::MemoryTag::Loader);
+  EU::FScopedStackMarker scratch;
+
+  LoaderArray<XMFLOAT3> temp_positions;
+  LoaderArray<XMFLOAT2> temp_texcoords;
+  LoaderArray<XMFLOAT3> temp_normals;
 
-  std::vector<VertexData> face_data;
-  std::vector<VertexData> unique_vertices;
+  LoaderArray<VertexData> face_data;
+  LoaderArray<VertexData> unique_vertices;
 
   mesh.m_vertex.clear();
   mesh.m_index.clear();
@@ -38,7 +46,40 @@ ModelLoader::init(MeshComponent& mesh, const std::string& fileName) {
     return E_FAIL;
   }
 
+  // Primera pasada: contar elementos para reservar cada array una sola vez. Un
+  // array de la pila temporal que crece pide el bloque nuevo antes de soltar el
+  // viejo, as que cada realojo dejara un hueco hasta el final de la carga.
+  size_t positionCount = 0;
+  size_t texcoordCount = 0;
+  size_t normalCount = 0;
+  size_t faceCornerCount = 0;
+
   char lineBuffer[1024];
+  while (std::fgets(lineBuffer, 1024, file) != nullptr) {
+    if (lineBuffer[0] == 'v') {
+      if (lineBuffer[1] == ' ' || lineBuffer[1] == '\t') ++positionCount;
+      else if (lineBuffer[1] == 't') ++texcoordCount;
+      else if (lineBuffer[1] == 'n') ++normalCount;
+    }
+    else if (lineBuffer[0] == 'f' && (lineBuffer[1] == ' ' || lineBuffer[1] == '\t')) {
+      size_t corners = 0;
+      bool inToken = false;
+      for (const char* c = lineBuffer + 1; *c != '\0'; ++c) {
+        const bool space = (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n');
+        if (!space && !inToken) ++corners;
+        inToken = !space;
+      }
+      if (corners >= 3) faceCornerCount += (corners - 2) * 3;
+    }
+  }
+  std::rewind(file);
+
+  temp_positions.reserve(positionCount);
+  temp_texcoords.reserve(texcoordCount);
+  temp_normals.reserve(normalCount);
+  face_data.reserve(faceCornerCount);
+  unique_vertices.reserve(faceCornerCount);
+
   while (std::fgets(lineBuffer, 1024, file) != nullptr) {
     std::string line(lineBuffer);
     if (line.empty() || line[0] == '#') continue;
@@ -64,7 +105,7 @@ ModelLoader::init(MeshComponent& mesh, const std::string& fileName) {
       temp_normals.push_back(normal);
     }
     else if (prefix == "f") {
-      std::vector<VertexData> face_indices;
+      EU::TInlineArray<VertexData, 8> face_indices;
       std::string segment;
 
       while (ss >> segment) {
@@ -88,7 +129,7 @@ ModelLoader::init(MeshComponent& mesh, const std::string& fileName) {
           vd.TexIndex = (vd.TexIndex > 0) ? vd.TexIndex - 1 : 0;
           vd.NormalIndex = (vd.NormalIndex > 0) ? vd.NormalIndex - 1 : 0;
 
-          face_indices.push_back(vd);
+          face_indices.Add(vd);
 
         }
         catch (const std::exception& e) {
@@ -99,7 +140,7 @@ ModelLoader::init(MeshComponent& mesh, const std::string& fileName) {
         }
       }
 
-      for (size_t i = 1; i < face_indices.size() - 1; ++i) {
+      for (size_t i = 1; i + 1 < face_indices.Num(); ++i) {
         face_data.push_back(face_indices[0]);
         face_data.push_back(face_indices[i]);
         face_data.push_back(face_indices[i + 1]);
@@ -83,7 +83,7 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 	}
 
 	HRESULT hr = S_OK;
-	ID3DBlob* shaderData = nullptr;
+	EU::TComPtr<ID3DBlob> shaderData;
 
 	const char* shaderEntryPoint = (type == ShaderType::PIXEL_SHADER) ? "PS" : "VS";
 	const char* shaderModel = (type == ShaderType::PIXEL_SHADER) ? "ps_4_0" : "vs_4_0";
@@ -92,7 +92,7 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 	hr = CompileShaderFromFile(m_shaderFileName.data(),
 		shaderEntryPoint,
 		shaderModel,
-		&shaderData);
+		shaderData.resetAndGetAddress());
 
 	if (FAILED(hr)) {
 		ERROR("ShaderProgram", "CreateShader",
@@ -117,18 +117,17 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 	if (FAILED(hr)) {
 		ERROR("ShaderProgram", "CreateShader",
 			"Failed to create shader object from compiled data.");
-		shaderData->Release();
 		return hr;
 	}
 
 	// Store the compiled shader data
 	if (type == PIXEL_SHADER) {
 		SAFE_RELEASE(m_pixelShaderData);
-		m_pixelShaderData = shaderData;
+		m_pixelShaderData = shaderData.release();
 	}
 	else {
 		SAFE_RELEASE(m_vertexShaderData);
-		m_vertexShaderData = shaderData;
+		m_vertexShaderData = shaderData.release();
 	}
 
 	return S_OK;
@@ -174,7 +173,7 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 	// the release configuration of this program.
 	dwShaderFlags |= D3DCOMPILE_DEBUG;
 #endif
-	ID3DBlob* pErrorBlob;
+	EU::TComPtr<ID3DBlob> pErrorBlob;
 	hr = D3DX11CompileFromFile(szFileName,
 														 nullptr,
 														 nullptr,
@@ -184,7 +183,7 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 														 0,
 														 nullptr,
 														 ppBlobOut,
-														 &pErrorBlob,
+														 pErrorBlob.resetAndGetAddress(),
 														 nullptr);
 
 	if (FAILED(hr)) {
@@ -192,8 +191,6 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 			ERROR("ShaderProgram", "CompileShaderFromFile",
 				"Failed to compile shader from file: %s. Error: %s",
 				szFileName, static_cast<const char*>(pErrorBlob->GetBufferPointer()));
-
-			pErrorBlob->Release();
 		}
 		else {
 			ERROR("ShaderProgram", "CompileShaderFromFile",
@@ -203,8 +200,6 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 		return hr;
 	}
 
-	SAFE_RELEASE(pErrorBlob)
-
 	return S_OK;
 }
 
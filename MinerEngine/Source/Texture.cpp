@@ -1,3 +1,8 @@
+#include "EngineUtilities\Memory\MemoryTracker.h"
+// Los pxeles decodificados por stb_image se atribuyen a MemoryTag::Texture
+#define STBI_MALLOC(size)          EU::TaggedMemory::Allocate((size), 16, EU::MemoryTag::Texture)
+#define STBI_REALLOC(ptr, newSize) EU::TaggedMemory::Reallocate((ptr), (newSize))
+#define STBI_FREE(ptr)             EU::TaggedMemory::Free(ptr)
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 #include "Texture.h"
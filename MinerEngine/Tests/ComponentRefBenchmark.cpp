@@ -0,0 +1,207 @@
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+#include "EngineUtilities/Memory/TRefCounted.h"
+#include "EngineUtilities/Memory/TRefPtr.h"
+#include "EngineUtilities/Memory/TSharedPointer.h"
+#include "EngineUtilities/Structures/TInlineArray.h"
+#include "EUBenchmark.h"
+
+/**
+ * 100K actores con 2 componentes cada uno (Transform y MeshComponent, como Actor), guardados como
+ * ahora en Entity (EU::TRefPtr con recuento intrusivo) y como antes (EU::TSharedPointer creado con
+ * MakeShared y dynamic_pointer_cast en addComponent/getComponent).
+ *
+ * Fases: crear los actores y sus componentes, buscar los dos componentes de cada actor (lo que
+ * hace BaseApp::render al ordenar por distancia), copiar las referencias a una lista aparte y
+ * destruirlo todo. Los actores van en TSharedPointer en las dos versiones, como en BaseApp.
+ */
+namespace {
+	constexpr size_t ActorCount = 100000;
+
+	/**
+	 * @brief Transform y MeshComponent sobre una u otra clase base de componente.
+	 */
+	template<typename FComponentBase>
+	struct TStandIn
+	{
+		struct FTransform : FComponentBase
+		{
+			float Position[3] = { 0.0f, 0.0f, 0.0f };
+			float Rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+			float Scale[3] = { 1.0f, 1.0f, 1.0f };
+			float Matrix[16] = {};
+		};
+
+		struct FMesh : FComponentBase
+		{
+			uint32_t VertexCount = 0;
+			uint32_t IndexCount = 0;
+			void* Buffers[2] = { nullptr, nullptr };
+		};
+	};
+
+	/// Componente con recuento intrusivo (Component actual).
+	struct FRefComponent : EU::TRefCounted<>
+	{
+		virtual ~FRefComponent() = default;
+		virtual void update(float) {}
+	};
+
+	/// Componente sin recuento propio (Component antes de TRefCounted).
+	struct FSharedComponent
+	{
+		virtual ~FSharedComponent() = default;
+		virtual void update(float) {}
+	};
+
+	using FRefTypes = TStandIn<FRefComponent>;
+	using FSharedTypes = TStandIn<FSharedComponent>;
+
+	/// Entity actual: TRefPtr y dynamic_cast sobre el puntero crudo.
+	struct FRefActor
+	{
+		template<typename T> using TPtr = EU::TRefPtr<T>;
+		using FTransform = FRefTypes::FTransform;
+		using FMesh = FRefTypes::FMesh;
+
+		template<typename T>
+		static TPtr<T> Make() { return EU::MakeRef<T>(); }
+
+		template<typename T>
+		void addComponent(EU::TRefPtr<T> component)
+		{
+			m_components.Add(EU::TRefPtr<FRefComponent>(component));
+		}
+
+		template<typename T>
+		EU::TRefPtr<T> getComponent()
+		{
+			for (auto& component : m_components)
+			{
+				if (T* specificComponent = dynamic_cast<T*>(component.get()))
+				{
+					return EU::TRefPtr<T>(specificComponent);
+				}
+			}
+			return EU::TRefPtr<T>();
+		}
+
+		EU::TInlineArray<EU::TRefPtr<FRefComponent>, 4> m_components;
+	};
+
+	/// Entity anterior: TSharedPointer y dynamic_pointer_cast.
+	struct FSharedActor
+	{
+		template<typename T> using TPtr = EU::TSharedPointer<T>;
+		using FTransform = FSharedTypes::FTransform;
+		using FMesh = FSharedTypes::FMesh;
+
+		template<typename T>
+		static TPtr<T> Make() { return EU::MakeShared<T>(); }
+
+		template<typename T>
+		void addComponent(EU::TSharedPointer<T> component)
+		{
+			m_components.Add(component.template dynamic_pointer_cast<FSharedComponent>());
+		}
+
+		template<typename T>
+		EU::TSharedPointer<T> getComponent()
+		{
+			for (auto& component : m_components)
+			{
+				EU::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
+				if (specificComponent)
+				{
+					return specificComponent;
+				}
+			}
+			return EU::TSharedPointer<T>();
+		}
+
+		EU::TInlineArray<EU::TSharedPointer<FSharedComponent>, 4> m_components;
+	};
+
+	struct FTimes
+	{
+		double CreateMs = 0.0;
+		double LookupMs = 0.0;
+		double CopyMs = 0.0;
+		double DestroyMs = 0.0;
+	};
+
+	template<typename FActor>
+	FTimes Run()
+	{
+		using FTransform = typename FActor::FTransform;
+		using FMesh = typename FActor::FMesh;
+		using FComponentPtr = typename std::remove_reference<decltype(std::declval<FActor&>().m_components[0])>::type;
+
+		FTimes Times;
+		std::vector<EU::TSharedPointer<FActor>> Actors;
+		std::vector<FComponentPtr> Copies;
+		Actors.reserve(ActorCount);
+		Copies.reserve(ActorCount * 2);
+
+		// Crear y destruir no se repiten sobre el mismo mundo: se repite el ciclo entero y se queda
+		// el mejor tiempo de cada fase.
+		for (int Repeat = 0; Repeat < 3; ++Repeat)
+		{
+			const double CreateMs = EUBench::MeasureMs([&]() {
+				for (size_t i = 0; i < ActorCount; ++i)
+				{
+					EU::TSharedPointer<FActor> Actor = EU::MakeShared<FActor>();
+					Actor->addComponent(FActor::template Make<FTransform>());
+					Actor->addComponent(FActor::template Make<FMesh>());
+					Actors.push_back(Actor);
+				}
+			}, 1);
+
+			const double LookupMs = EUBench::MeasureMs([&]() {
+				uint64_t Sum = 0;
+				for (EU::TSharedPointer<FActor>& Actor : Actors)
+				{
+					Sum += static_cast<uint64_t>(Actor->template getComponent<FTransform>()->Scale[0]);
+					Sum += Actor->template getComponent<FMesh>()->VertexCount;
+				}
+				EUBench::Consume(Sum);
+			});
+
+			const double CopyMs = EUBench::MeasureMs([&]() {
+				for (EU::TSharedPointer<FActor>& Actor : Actors)
+				{
+					for (FComponentPtr& Component : Actor->m_components) Copies.push_back(Component);
+				}
+				EUBench::Consume(Copies.size());
+				Copies.clear();
+			});
+
+			const double DestroyMs = EUBench::MeasureMs([&]() { Actors.clear(); }, 1);
+
+			Times.CreateMs = Repeat == 0 || CreateMs < Times.CreateMs ? CreateMs : Times.CreateMs;
+			Times.LookupMs = Repeat == 0 || LookupMs < Times.LookupMs ? LookupMs : Times.LookupMs;
+			Times.CopyMs = Repeat == 0 || CopyMs < Times.CopyMs ? CopyMs : Times.CopyMs;
+			Times.DestroyMs = Repeat == 0 || DestroyMs < Times.DestroyMs ? DestroyMs : Times.DestroyMs;
+		}
+		return Times;
+	}
+
+	void Report(const char* Name, const FTimes& Times)
+	{
+		std::printf("%-22s %10.2f %10.2f %10.2f %10.2f\n", Name, Times.CreateMs, Times.LookupMs,
+			Times.CopyMs, Times.DestroyMs);
+	}
+}
+
+int main()
+{
+	std::printf("%zu actores x 2 componentes, ms\n", ActorCount);
+	std::printf("%-22s %10s %10s %10s %10s\n", "", "crear", "buscar", "copiar", "destruir");
+	Report("TRefPtr (actual)", Run<FRefActor>());
+	Report("TSharedPointer", Run<FSharedActor>());
+	std::printf("\nBytes por Transform: %zu con TRefPtr, %zu con MakeShared (bloque incluido)\n",
+		sizeof(FRefTypes::FTransform), sizeof(EU::TInlineControlBlock<FSharedTypes::FTransform, EU::RefCountMode::ThreadSafe>));
+	return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Utilidades mnimas para los benchmarks de EngineUtilities.
+ *
+ * MeasureMs() devuelve el mejor de Repeats tiempos (en ms) para filtrar el ruido del sistema;
+ * Consume() obliga al compilador a conservar un resultado que de otro modo eliminara.
+ */
+namespace EUBench {
+	using FClock = std::chrono::steady_clock;
+
+	template<typename F>
+	double MeasureMs(F&& Body, int Repeats = 3)
+	{
+		double Best = 0.0;
+		for (int i = 0; i < Repeats; ++i)
+		{
+			const FClock::time_point Start = FClock::now();
+			Body();
+			const double Elapsed = std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+			if (i == 0 || Elapsed < Best)
+			{
+				Best = Elapsed;
+			}
+		}
+		return Best;
+	}
+
+	inline void Consume(uint64_t Value)
+	{
+		static volatile uint64_t Sink = 0;
+		Sink = Sink + Value;
+	}
+
+	/**
+	 * @brief Generador xorshift64* reproducible (mismas claves en todas las plataformas).
+	 */
+	struct FRandom
+	{
+		uint64_t State;
+
+		explicit FRandom(uint64_t Seed) : State(Seed ? Seed : 1) {}
+
+		uint64_t Next()
+		{
+			State ^= State >> 12;
+			State ^= State << 25;
+			State ^= State >> 27;
+			return State * 2685821657736338717ull;
+		}
+	};
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdio>
+
+/**
+ * @brief Comprobaciones mnimas para las pruebas de EngineUtilities.
+ *
+ * EU_CHECK informa de la lnea que falla y sigue; EU_TEST_RESULT() devuelve el cdigo de salida
+ * que CTest interpreta (0 si todo pas).
+ */
+namespace EUTest {
+	inline int& Failures()
+	{
+		static int Count = 0;
+		return Count;
+	}
+}
+
+#define EU_CHECK(Condition)                                                   \
+	do {                                                                      \
+		if (!(Condition)) {                                                   \
+			std::fprintf(stderr, "%s:%d: fallo: %s\n", __FILE__, __LINE__, #Condition); \
+			++EUTest::Failures();                                             \
+		}                                                                     \
+	} while (0)
+
+#define EU_TEST_RESULT() (EUTest::Failures() == 0 ? 0 : 1)
@@ -0,0 +1,175 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "EngineUtilities/Utilities/EngineMath.h"
+#include "EUBenchmark.h"
+
+/**
+ * Precisin y velocidad de EngineMath contra <cmath>.
+ *
+ * El error se mide contra la funcin double de <cmath> redondeada a float, en ULP del resultado
+ * (y en error absoluto donde el resultado cruza cero, como sin/cos con ngulos grandes). La
+ * velocidad es ns por valor sobre un array de entradas independientes, EU frente a la versin
+ * float de std.
+ */
+namespace {
+	constexpr size_t SampleCount = 1 << 21;
+	constexpr size_t TimedCount = 1 << 16;
+
+	double UlpOf(float Reference)
+	{
+		const float Magnitude = std::fabs(Reference);
+		return double(std::nextafter(Magnitude, INFINITY)) - double(Magnitude);
+	}
+
+	std::vector<float> Uniform(float Low, float High, size_t Count, uint64_t Seed)
+	{
+		std::vector<float> Values(Count);
+		EUBench::FRandom Random(Seed);
+		for (float& Value : Values)
+		{
+			Value = Low + (High - Low) * (static_cast<float>(Random.Next() >> 40) / 16777216.0f);
+		}
+		return Values;
+	}
+
+	/**
+	 * @brief Floats positivos con todos los exponentes normales y subnormales por igual.
+	 */
+	std::vector<float> AllExponents(size_t Count, uint64_t Seed)
+	{
+		std::vector<float> Values(Count);
+		EUBench::FRandom Random(Seed);
+		for (float& Value : Values)
+		{
+			uint32_t Bits = static_cast<uint32_t>(Random.Next() >> 33) % 0x7f800000u;
+			Bits = Bits == 0 ? 1 : Bits;
+			std::memcpy(&Value, &Bits, sizeof(Value));
+		}
+		return Values;
+	}
+
+	struct FError
+	{
+		double MaxUlp = 0.0;
+		double MaxAbs = 0.0;
+	};
+
+	template<typename FEngine, typename FReference>
+	FError MeasureError(const std::vector<float>& Inputs, FEngine&& Engine, FReference&& Reference)
+	{
+		FError Error;
+		for (float Input : Inputs)
+		{
+			const double Exact = Reference(double(Input));
+			const double Diff = std::fabs(double(Engine(Input)) - Exact);
+			const double Ulp = Diff / UlpOf(static_cast<float>(Exact));
+			Error.MaxUlp = Ulp > Error.MaxUlp ? Ulp : Error.MaxUlp;
+			Error.MaxAbs = Diff > Error.MaxAbs ? Diff : Error.MaxAbs;
+		}
+		return Error;
+	}
+
+	template<typename F>
+	double NsPerValue(const std::vector<float>& Inputs, F&& Function)
+	{
+		std::vector<float> Out(Inputs.size());
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (size_t i = 0; i < Inputs.size(); ++i) Out[i] = Function(Inputs[i]);
+			EUBench::Consume(static_cast<uint64_t>(Out[Inputs.size() / 2] * 1000.0f));
+		});
+		return Ms * 1e6 / double(Inputs.size());
+	}
+
+	/**
+	 * @brief Versin por lotes: Function procesa 8 valores consecutivos.
+	 */
+	template<typename F>
+	double NsPerValueBatched(const std::vector<float>& Inputs, F&& Function)
+	{
+		std::vector<float> Out(Inputs.size());
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (size_t i = 0; i + 8 <= Inputs.size(); i += 8) Function(&Inputs[i], &Out[i]);
+			EUBench::Consume(static_cast<uint64_t>(Out[Inputs.size() / 2] * 1000.0f));
+		});
+		return Ms * 1e6 / double(Inputs.size());
+	}
+
+	void ReportError(const char* Name, const char* Range, const FError& Error)
+	{
+		std::printf("%-8s %-22s max %8.2f ULP   max abs %.3g\n", Name, Range, Error.MaxUlp, Error.MaxAbs);
+	}
+
+	void ReportSpeed(const char* Name, double EngineNs, double StdNs)
+	{
+		std::printf("%-8s EU %6.2f ns   std %6.2f ns\n", Name, EngineNs, StdNs);
+	}
+}
+
+static void RunAccuracy()
+{
+	std::printf("Error frente a <cmath> en double, %zu muestras por rango\n", SampleCount);
+	const std::vector<float> Circle = Uniform(-EU::PI, EU::PI, SampleCount, 1);
+	const std::vector<float> Wide = Uniform(-8192.0f, 8192.0f, SampleCount, 2);
+	ReportError("sin", "[-pi, pi]", MeasureError(Circle, [](float x) { return EU::sin(x); }, [](double x) { return std::sin(x); }));
+	ReportError("cos", "[-pi, pi]", MeasureError(Circle, [](float x) { return EU::cos(x); }, [](double x) { return std::cos(x); }));
+	ReportError("sin", "[-8192, 8192]", MeasureError(Wide, [](float x) { return EU::sin(x); }, [](double x) { return std::sin(x); }));
+	ReportError("cos", "[-8192, 8192]", MeasureError(Wide, [](float x) { return EU::cos(x); }, [](double x) { return std::cos(x); }));
+
+	// tan lejos de los polos: se descartan las muestras con |cos| < 1e-3.
+	std::vector<float> TanInputs;
+	for (float x : Uniform(-100.0f, 100.0f, SampleCount, 3))
+	{
+		if (std::fabs(std::cos(double(x))) >= 1e-3) TanInputs.push_back(x);
+	}
+	ReportError("tan", "[-100, 100] sin polos", MeasureError(TanInputs, [](float x) { return EU::tan(x); }, [](double x) { return std::tan(x); }));
+
+	ReportError("exp", "[-87, 88.7]", MeasureError(Uniform(-87.0f, 88.7f, SampleCount, 4),
+		[](float x) { return EU::exp(x); }, [](double x) { return std::exp(x); }));
+	const std::vector<float> Positive = AllExponents(SampleCount, 5);
+	ReportError("log", "todos los exponentes", MeasureError(Positive, [](float x) { return EU::log(x); }, [](double x) { return std::log(x); }));
+	ReportError("sqrt", "todos los exponentes", MeasureError(Positive, [](float x) { return EU::sqrt(x); }, [](double x) { return std::sqrt(x); }));
+	ReportError("rsqrt", "todos los exponentes", MeasureError(Positive, [](float x) { return EU::rsqrt(x); }, [](double x) { return 1.0 / std::sqrt(x); }));
+	// La estimacin de la CPU no admite subnormales: rsqrt4 se mide solo con normales.
+	std::vector<float> Normal;
+	for (float x : Positive)
+	{
+		if (x >= 1.17549435e-38f) Normal.push_back(x);
+	}
+	ReportError("rsqrt4", "normales", MeasureError(Normal, [](float x) {
+		float In[4] = { x, x, x, x };
+		float Out[4];
+		EU::rsqrt4(In, Out);
+		return Out[0];
+	}, [](double x) { return 1.0 / std::sqrt(x); }));
+}
+
+static void RunSpeed()
+{
+	std::printf("\nns por valor, %zu entradas independientes\n", TimedCount);
+	const std::vector<float> Angles = Uniform(-EU::PI, EU::PI, TimedCount, 11);
+	const std::vector<float> Exponents = Uniform(-80.0f, 80.0f, TimedCount, 12);
+	const std::vector<float> Positive = Uniform(1e-3f, 1e6f, TimedCount, 13);
+	ReportSpeed("sin", NsPerValue(Angles, [](float x) { return EU::sin(x); }), NsPerValue(Angles, [](float x) { return std::sin(x); }));
+	ReportSpeed("cos", NsPerValue(Angles, [](float x) { return EU::cos(x); }), NsPerValue(Angles, [](float x) { return std::cos(x); }));
+	ReportSpeed("tan", NsPerValue(Angles, [](float x) { return EU::tan(x); }), NsPerValue(Angles, [](float x) { return std::tan(x); }));
+	ReportSpeed("exp", NsPerValue(Exponents, [](float x) { return EU::exp(x); }), NsPerValue(Exponents, [](float x) { return std::exp(x); }));
+	ReportSpeed("log", NsPerValue(Positive, [](float x) { return EU::log(x); }), NsPerValue(Positive, [](float x) { return std::log(x); }));
+	ReportSpeed("sqrt", NsPerValue(Positive, [](float x) { return EU::sqrt(x); }), NsPerValue(Positive, [](float x) { return std::sqrt(x); }));
+	ReportSpeed("rsqrt", NsPerValue(Positive, [](float x) { return EU::rsqrt(x); }), NsPerValue(Positive, [](float x) { return 1.0f / std::sqrt(x); }));
+	ReportSpeed("sin8", NsPerValueBatched(Angles, [](const float* In, float* Out) { EU::sin8(In, Out); }),
+		NsPerValue(Angles, [](float x) { return std::sin(x); }));
+	ReportSpeed("cos8", NsPerValueBatched(Angles, [](const float* In, float* Out) { EU::cos8(In, Out); }),
+		NsPerValue(Angles, [](float x) { return std::cos(x); }));
+	ReportSpeed("rsqrt8", NsPerValueBatched(Positive, [](const float* In, float* Out) { EU::rsqrt8(In, Out); }),
+		NsPerValue(Positive, [](float x) { return 1.0f / std::sqrt(x); }));
+}
+
+int main()
+{
+	RunAccuracy();
+	RunSpeed();
+	return 0;
+}
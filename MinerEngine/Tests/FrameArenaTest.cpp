@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "EngineUtilities/Memory/FrameArena.h"
+#include "EUTest.h"
+
+/**
+ * Cuenta todas las reservas del proceso sustituyendo el operator new global (con
+ * EU_MEMORY_TRACKING, que CMakeLists.txt activa en las pruebas, TaggedMemory y por tanto
+ * FrameArena reservan a travs de l).
+ */
+static std::atomic<uint64_t> GAllocations(0);
+
+void* operator new(size_t Size)
+{
+	++GAllocations;
+	if (void* Memory = std::malloc(Size ? Size : 1)) return Memory;
+	throw std::bad_alloc();
+}
+
+#if defined(_MSC_VER)
+static void* AlignedMalloc(size_t Size, size_t Align) { return _aligned_malloc(Size, Align); }
+static void AlignedFree(void* Memory) { _aligned_free(Memory); }
+#else
+static void* AlignedMalloc(size_t Size, size_t Align) { return std::aligned_alloc(Align, (Size + Align - 1) / Align * Align); }
+static void AlignedFree(void* Memory) { std::free(Memory); }
+#endif
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+	++GAllocations;
+	if (void* Memory = AlignedMalloc(Size ? Size : 1, static_cast<size_t>(Alignment))) return Memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* Memory) noexcept { std::free(Memory); }
+void operator delete(void* Memory, size_t) noexcept { std::free(Memory); }
+void operator delete(void* Memory, std::align_val_t) noexcept { AlignedFree(Memory); }
+void operator delete(void* Memory, size_t, std::align_val_t) noexcept { AlignedFree(Memory); }
+
+namespace {
+	struct alignas(16) FMatrix
+	{
+		float M[16];
+	};
+
+	struct FDrawKey
+	{
+		float Depth;
+		uint32_t ActorIndex;
+	};
+
+	/**
+	 * Trabajo de un frame con el mismo patrn que BaseApp::render: claves de orden de dibujo en
+	 * la arena ordenadas con std::sort, ms datos por actor con New<T>. BaseApp necesita Direct3D
+	 * y no se compila aqu; esto reproduce su uso de la arena.
+	 */
+	void SimulateFrame(EU::FrameArena& Arena, uint32_t Actors, uint32_t Keys)
+	{
+		Arena.BeginFrame();
+		for (uint32_t i = 0; i < Actors; ++i)
+		{
+			FMatrix* World = Arena.New<FMatrix>();
+			World->M[0] = static_cast<float>(i);
+			EU_CHECK(reinterpret_cast<uintptr_t>(World) % alignof(FMatrix) == 0);
+		}
+		EU::TSpan<FDrawKey> DrawKeys = Arena.NewArray<FDrawKey>(Keys);
+		for (size_t i = 0; i < DrawKeys.Num(); ++i)
+		{
+			DrawKeys[i] = { static_cast<float>((i * 7919) % 1000), static_cast<uint32_t>(i) };
+		}
+		std::sort(DrawKeys.begin(), DrawKeys.end(),
+			[](const FDrawKey& A, const FDrawKey& B) { return A.Depth < B.Depth; });
+		for (size_t i = 1; i < DrawKeys.Num(); ++i)
+		{
+			EU_CHECK(DrawKeys[i - 1].Depth <= DrawKeys[i].Depth);
+		}
+	}
+}
+
+static void TestSteadyStateDoesNotAllocate()
+{
+	// Arena pequea a propsito: los primeros frames desbordan y hacen crecer cada bloque
+	EU::FrameArena Arena(4096, 2);
+
+	const uint64_t Start = GAllocations.load();
+	for (int Frame = 0; Frame < 4; ++Frame)
+	{
+		SimulateFrame(Arena, 64, 512);
+	}
+	EU_CHECK(GAllocations.load() - Start > 0);  ///< El calentamiento s tuvo que reservar.
+
+	const uint64_t Before = GAllocations.load();
+	for (uint32_t Frame = 0; Frame < 100; ++Frame)
+	{
+		// Carga variable pero sin superar el pico del calentamiento
+		SimulateFrame(Arena, 16 + Frame % 48, 128 + (Frame * 37) % 384);
+		EU_CHECK(!Arena.GetCurrentArena().HasOverflowed());
+	}
+	EU_CHECK(GAllocations.load() - Before == 0);
+}
+
+static void TestOverflowAndGrowth()
+{
+	EU::FrameArena Arena(1024, 1);
+	Arena.BeginFrame();
+	EU::TSpan<uint64_t> Big = Arena.NewArray<uint64_t>(1000);
+	EU_CHECK(Big.Num() == 1000);
+	EU_CHECK(Arena.GetCurrentArena().HasOverflowed());
+	EU_CHECK(Arena.GetCurrentArena().GetUsed() >= 8000);
+
+	// El siguiente Reset() absorbe el desbordamiento en el bloque principal
+	Arena.BeginFrame();
+	EU_CHECK(Arena.GetCurrentArena().GetCapacity() >= 8000);
+	Arena.NewArray<uint64_t>(1000);
+	EU_CHECK(!Arena.GetCurrentArena().HasOverflowed());
+}
+
+static void TestPreviousFrameSurvives()
+{
+	EU::FrameArena Arena(4096, 2);
+	Arena.BeginFrame();
+	uint64_t* Previous = Arena.New<uint64_t>(42u);
+
+	// Con dos arenas, lo del frame anterior sigue intacto durante el frame actual
+	Arena.BeginFrame();
+	EU::TSpan<uint64_t> Current = Arena.NewArray<uint64_t>(256);
+	for (size_t i = 0; i < Current.Num(); ++i) Current[i] = ~0ull;
+	EU_CHECK(*Previous == 42u);
+	EU_CHECK(Arena.GetFrameNumber() == 2);
+}
+
+int main()
+{
+	TestSteadyStateDoesNotAllocate();
+	TestOverflowAndGrowth();
+	TestPreviousFrameSurvives();
+	return EU_TEST_RESULT();
+}
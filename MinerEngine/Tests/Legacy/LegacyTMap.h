@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdlib>
+#include <iostream>
+
+// Copia de EU::TMap anterior a la tabla Robin Hood (bsqueda lineal), solo para comparar en
+// los benchmarks. No usar en el motor.
+namespace EULegacy {
+	/**
+	 * @brief TMap es una clase de mapa (diccionario) dinmica para almacenar pares clave-valor.
+	 *
+	 * Esta implementacin de TMap proporciona una forma sencilla de almacenar y gestionar
+	 * colecciones de pares clave-valor, con operaciones bsicas como agregar, eliminar y acceder a valores.
+	 * La memoria se gestiona dinmicamente, aumentando la capacidad del mapa segn sea necesario.
+	 *
+	 * @tparam K El tipo de las claves.
+	 * @tparam V El tipo de los valores.
+	 */
+	template<typename K, typename V>
+	class TMap
+	{
+	private:
+		struct Pair
+		{
+			K Key;
+			V Value;
+
+			Pair() : Key(), Value() {}
+			Pair(const K& Key, const V& Value) : Key(Key), Value(Value) {}
+		};
+
+		Pair* Data;        ///< Puntero a la memoria donde se almacenan los pares clave-valor.
+		size_t Capacity;   ///< Capacidad actual del mapa (nmero de pares que puede almacenar).
+		size_t Size;       ///< Nmero de pares actualmente en el mapa.
+
+		/**
+		 * @brief Redimensiona el mapa para tener una nueva capacidad.
+		 *
+		 * @param NewCapacity La nueva capacidad del mapa.
+		 */
+		void Resize(size_t NewCapacity)
+		{
+			Pair* NewData = new Pair[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
+			for (size_t i = 0; i < Size; ++i)
+			{
+				NewData[i] = Data[i];  ///< Copiar los pares existentes al nuevo bloque de memoria.
+			}
+			delete[] Data;  ///< Liberar la memoria del mapa antiguo.
+			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
+			Capacity = NewCapacity;  ///< Actualizar la capacidad del mapa.
+		}
+
+	public:
+		/**
+		 * @brief Constructor por defecto que inicializa el mapa con capacidad y tamao cero.
+		 */
+		TMap()
+			: Data(nullptr), Capacity(0), Size(0)
+		{
+		}
+
+		/**
+		 * @brief Destructor que libera la memoria asignada al mapa.
+		 */
+		~TMap()
+		{
+			delete[] Data;  ///< Liberar la memoria del mapa.
+		}
+
+		/**
+		 * @brief Aade un nuevo par clave-valor al mapa.
+		 *
+		 * @param Key La clave del nuevo par.
+		 * @param Value El valor del nuevo par.
+		 */
+		void Add(const K& Key, const V& Value)
+		{
+			for (size_t i = 0; i < Size; ++i)
+			{
+				if (Data[i].Key == Key)
+				{
+					Data[i].Value = Value;  ///< Actualizar el valor si la clave ya existe.
+					return;
+				}
+			}
+			if (Size == Capacity)
+			{
+				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+			}
+			Data[Size++] = Pair(Key, Value);  ///< Aadir el nuevo par y aumentar el tamao.
+		}
+
+		/**
+		 * @brief Elimina el par clave-valor en la posicin especificada.
+		 *
+		 * @param Key La clave del par a eliminar.
+		 */
+		void Remove(const K& Key)
+		{
+			for (size_t i = 0; i < Size; ++i)
+			{
+				if (Data[i].Key == Key)
+				{
+					for (size_t j = i; j < Size - 1; ++j)
+					{
+						Data[j] = Data[j + 1];  ///< Desplazar los pares hacia la izquierda para llenar el hueco.
+					}
+					--Size;  ///< Disminuir el tamao del mapa.
+					return;
+				}
+			}
+			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+		}
+
+		/**
+		 * @brief Sobrecarga del operador [] para acceder a valores por clave.
+		 *
+		 * @param Key La clave del valor a acceder.
+		 * @return Referencia al valor asociado con la clave especificada.
+		 */
+		V& operator[](const K& Key)
+		{
+			for (size_t i = 0; i < Size; ++i)
+			{
+				if (Data[i].Key == Key)
+				{
+					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
+				}
+			}
+			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+			exit(1);  ///< Salir del programa en caso de error.
+		}
+
+		/**
+		 * @brief Versin constante de la sobrecarga del operador [] para acceder a valores por clave.
+		 *
+		 * @param Key La clave del valor a acceder.
+		 * @return Referencia constante al valor asociado con la clave especificada.
+		 */
+		const V& operator[](const K& Key) const
+		{
+			for (size_t i = 0; i < Size; ++i)
+			{
+				if (Data[i].Key == Key)
+				{
+					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
+				}
+			}
+			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+			exit(1);  ///< Salir del programa en caso de error.
+		}
+
+		/**
+		 * @brief Devuelve el nmero de pares actualmente en el mapa.
+		 *
+		 * @return El nmero de pares en el mapa.
+		 */
+		size_t Num() const
+		{
+			return Size;  ///< Devolver el tamao actual del mapa.
+		}
+
+		/**
+		 * @brief Devuelve la capacidad actual del mapa.
+		 *
+		 * @return La capacidad del mapa.
+		 */
+		size_t GetCapacity() const
+		{
+			return Capacity;  ///< Devolver la capacidad actual del mapa.
+		}
+	};
+}
@@ -0,0 +1,164 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Memory/MemoryTracker.h"
+#include "EUTest.h"
+
+/**
+ * Se compila dos veces: MemoryTrackerTest con EU_MEMORY_TRACKING = 1 y MemoryTrackerUntrackedTest
+ * con 0. El operator new global cuenta las llamadas para comprobar por dnde reserva TaggedMemory.
+ */
+static std::atomic<uint64_t> GOperatorNews(0);
+
+void* operator new(size_t Size)
+{
+	++GOperatorNews;
+	if (void* Memory = std::malloc(Size ? Size : 1)) return Memory;
+	throw std::bad_alloc();
+}
+
+#if defined(_MSC_VER)
+static void* AlignedMalloc(size_t Size, size_t Align) { return _aligned_malloc(Size, Align); }
+static void AlignedFree(void* Memory) { _aligned_free(Memory); }
+#else
+static void* AlignedMalloc(size_t Size, size_t Align) { return std::aligned_alloc(Align, (Size + Align - 1) / Align * Align); }
+static void AlignedFree(void* Memory) { std::free(Memory); }
+#endif
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+	++GOperatorNews;
+	if (void* Memory = AlignedMalloc(Size ? Size : 1, static_cast<size_t>(Alignment))) return Memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* Memory) noexcept { std::free(Memory); }
+void operator delete(void* Memory, size_t) noexcept { std::free(Memory); }
+void operator delete(void* Memory, std::align_val_t) noexcept { AlignedFree(Memory); }
+void operator delete(void* Memory, size_t, std::align_val_t) noexcept { AlignedFree(Memory); }
+
+using namespace EU;
+
+static_assert(std::allocator_traits<TTaggedAllocator<int, MemoryTag::Mesh>>::is_always_equal::value,
+	"TTaggedAllocator no tiene estado");
+
+static void TestAlignment()
+{
+	for (size_t Alignment = 1; Alignment <= 4096; Alignment *= 2)
+	{
+		for (size_t Size : { size_t(0), size_t(1), size_t(7), size_t(100), size_t(5000) })
+		{
+			uint8_t* Memory = static_cast<uint8_t*>(TaggedMemory::Allocate(Size, Alignment, MemoryTag::Loader));
+			EU_CHECK(Memory != nullptr);
+			EU_CHECK(reinterpret_cast<uintptr_t>(Memory) % Alignment == 0);
+			std::memset(Memory, 0xAB, Size);
+			TaggedMemory::Free(Memory);
+		}
+	}
+	TaggedMemory::Free(nullptr);
+}
+
+static void TestReallocate()
+{
+	uint8_t* Memory = static_cast<uint8_t*>(TaggedMemory::Allocate(10, 16, MemoryTag::Texture));
+	for (uint8_t i = 0; i < 10; ++i) Memory[i] = i;
+	Memory = static_cast<uint8_t*>(TaggedMemory::Reallocate(Memory, 100000));
+	EU_CHECK(reinterpret_cast<uintptr_t>(Memory) % 16 == 0);
+	bool Kept = true;
+	for (uint8_t i = 0; i < 10; ++i) Kept = Kept && Memory[i] == i;
+	EU_CHECK(Kept);
+	Memory = static_cast<uint8_t*>(TaggedMemory::Reallocate(Memory, 4));
+	EU_CHECK(Memory[3] == 3);
+	TaggedMemory::Free(Memory);
+
+	void* Fresh = TaggedMemory::Reallocate(nullptr, 32);
+	EU_CHECK(Fresh != nullptr);
+	TaggedMemory::Free(Fresh);
+}
+
+#if EU_MEMORY_TRACKING
+/**
+ * Contadores por etiqueta con reservas desde varios hilos y etiquetas a la vez.
+ */
+static void TestCounters()
+{
+	MemoryTracker& Tracker = MemoryTracker::Get();
+	const FMemoryTagStats Before = Tracker.GetStats(MemoryTag::ECS);
+
+	constexpr int Threads = 4;
+	constexpr int PerThread = 10000;
+	std::vector<std::thread> Workers;
+	for (int t = 0; t < Threads; ++t)
+	{
+		Workers.emplace_back([t]() {
+			const MemoryTag Tag = t % 2 == 0 ? MemoryTag::ECS : MemoryTag::Mesh;
+			for (int i = 0; i < PerThread; ++i)
+			{
+				TaggedMemory::Free(TaggedMemory::Allocate(48, 16, Tag));
+			}
+		});
+	}
+	for (std::thread& Worker : Workers) Worker.join();
+
+	const FMemoryTagStats After = Tracker.GetStats(MemoryTag::ECS);
+	EU_CHECK(After.NumAllocations - Before.NumAllocations == uint64_t(Threads / 2) * PerThread);
+	EU_CHECK(After.LiveBytes == Before.LiveBytes);
+	EU_CHECK(After.PeakBytes >= 48);
+
+	void* Held = TaggedMemory::Allocate(1000, 16, MemoryTag::ECS);
+	EU_CHECK(Tracker.GetStats(MemoryTag::ECS).LiveBytes == Before.LiveBytes + 1000);
+	Tracker.BeginFrame();
+	Tracker.BeginFrame();
+	EU_CHECK(Tracker.GetStats(MemoryTag::ECS).FrameAllocations == 0);
+	TaggedMemory::Free(TaggedMemory::Allocate(8, 8, MemoryTag::ECS));
+	Tracker.BeginFrame();
+	EU_CHECK(Tracker.GetStats(MemoryTag::ECS).FrameAllocations == 1);
+	TaggedMemory::Free(Held);
+	EU_CHECK(Tracker.GetStats(MemoryTag::ECS).LiveBytes == Before.LiveBytes);
+
+	// El asignador STL atribuye a su etiqueta sin importar el mbito activo.
+	const uint64_t MeshBefore = Tracker.GetStats(MemoryTag::Mesh).LiveBytes;
+	{
+		FScopedMemoryTag Scope(MemoryTag::Loader);
+		std::vector<float, TTaggedAllocator<float, MemoryTag::Mesh>> Positions(1024);
+		EU_CHECK(Tracker.GetStats(MemoryTag::Mesh).LiveBytes == MeshBefore + 1024 * sizeof(float));
+	}
+	EU_CHECK(Tracker.GetStats(MemoryTag::Mesh).LiveBytes == MeshBefore);
+}
+#else
+/**
+ * Sin seguimiento: TaggedMemory no pasa por operator new ni toca los contadores.
+ */
+static void TestUntracked()
+{
+	const uint64_t NewsBefore = GOperatorNews.load();
+	std::vector<void*> Blocks;
+	Blocks.reserve(100);
+	const uint64_t NewsAfterReserve = GOperatorNews.load();
+	for (int i = 0; i < 100; ++i) Blocks.push_back(TaggedMemory::Allocate(64, 16, MemoryTag::ECS));
+	EU_CHECK(GOperatorNews.load() == NewsAfterReserve);
+	for (void* Block : Blocks) TaggedMemory::Free(Block);
+	EU_CHECK(NewsAfterReserve - NewsBefore == 1);
+
+	MemoryTracker::Get().BeginFrame();
+	const FMemoryTagStats Stats = MemoryTracker::Get().GetStats(MemoryTag::ECS);
+	EU_CHECK(Stats.LiveBytes == 0 && Stats.PeakBytes == 0 && Stats.NumAllocations == 0);
+}
+#endif
+
+int main()
+{
+	TestAlignment();
+	TestReallocate();
+#if EU_MEMORY_TRACKING
+	TestCounters();
+#else
+	TestUntracked();
+#endif
+	return EU_TEST_RESULT();
+}
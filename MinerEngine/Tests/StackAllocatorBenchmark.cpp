@@ -0,0 +1,275 @@
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "EngineUtilities/Memory/StackAllocator.h"
+#include "EngineUtilities/Structures/TInlineArray.h"
+#include "EUBenchmark.h"
+
+/**
+ * Parseo de OBJ como ModelLoader::init con los temporales en std::allocator o en
+ * TStackStdAllocator, cargando el mismo modelo varias veces seguidas (como al abrir una escena).
+ *
+ * El texto se genera en memoria (una rejilla con v, vt, vn y caras de cuatro vrtices) para que el
+ * disco no entre en la medida. Se prueban las dos formas de llenar los arrays: con la pasada de
+ * conteo y reserve() que hace ModelLoader, y creciendo con push_back, que en la pila deja huecos.
+ * La re-indexacin final no se incluye: no reserva temporales nuevos.
+ *
+ * El parseo con std::stringstream domina el tiempo de carga; la segunda tabla llena los mismos
+ * arrays con los mismos tamaos sin parsear texto, para ver solo el coste de los temporales.
+ */
+namespace {
+	constexpr int GridSize = 256;
+	constexpr int Loads = 10;
+
+	struct FFloat3 { float x, y, z; };
+	struct FFloat2 { float x, y; };
+
+	struct FVertexData
+	{
+		unsigned int PosIndex;
+		unsigned int TexIndex;
+		unsigned int NormalIndex;
+	};
+
+	std::string MakeGridObj(int Size)
+	{
+		std::string Text;
+		char Line[128];
+		for (int y = 0; y <= Size; ++y)
+		{
+			for (int x = 0; x <= Size; ++x)
+			{
+				std::snprintf(Line, sizeof(Line), "v %.4f 0.0 %.4f\nvt %.4f %.4f\nvn 0.0 1.0 0.0\n",
+					x * 0.1f, y * 0.1f, float(x) / Size, float(y) / Size);
+				Text += Line;
+			}
+		}
+		for (int y = 0; y < Size; ++y)
+		{
+			for (int x = 0; x < Size; ++x)
+			{
+				const int A = y * (Size + 1) + x + 1;
+				const int B = A + 1;
+				const int C = A + Size + 2;
+				const int D = A + Size + 1;
+				std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
+					A, A, A, B, B, B, C, C, C, D, D, D);
+				Text += Line;
+			}
+		}
+		return Text;
+	}
+
+	/**
+	 * @brief Recorre el texto lnea a lnea como fgets sobre un bfer de 1024.
+	 */
+	template<typename F>
+	void ForEachLine(const std::string& Text, F&& Body)
+	{
+		size_t Start = 0;
+		while (Start < Text.size())
+		{
+			size_t End = Text.find('\n', Start);
+			End = End == std::string::npos ? Text.size() : End + 1;
+			Body(Text.c_str() + Start, End - Start);
+			Start = End;
+		}
+	}
+
+	struct FParseResult
+	{
+		size_t Corners = 0;
+		size_t StackBytes = 0;  ///< Cima de la pila temporal al terminar (incluye huecos).
+	};
+
+	template<template<typename> class TAllocator>
+	FParseResult Parse(const std::string& Text, bool bReserve)
+	{
+		EU::FScopedStackMarker Scratch;
+		std::vector<FFloat3, TAllocator<FFloat3>> Positions;
+		std::vector<FFloat2, TAllocator<FFloat2>> TexCoords;
+		std::vector<FFloat3, TAllocator<FFloat3>> Normals;
+		std::vector<FVertexData, TAllocator<FVertexData>> FaceData;
+		std::vector<FVertexData, TAllocator<FVertexData>> UniqueVertices;
+
+		if (bReserve)
+		{
+			size_t PositionCount = 0;
+			size_t TexcoordCount = 0;
+			size_t NormalCount = 0;
+			size_t FaceCornerCount = 0;
+			ForEachLine(Text, [&](const char* Line, size_t) {
+				if (Line[0] == 'v')
+				{
+					if (Line[1] == ' ' || Line[1] == '\t') ++PositionCount;
+					else if (Line[1] == 't') ++TexcoordCount;
+					else if (Line[1] == 'n') ++NormalCount;
+				}
+				else if (Line[0] == 'f' && (Line[1] == ' ' || Line[1] == '\t'))
+				{
+					size_t Corners = 0;
+					bool bInToken = false;
+					for (const char* c = Line + 1; *c != '\0' && *c != '\n'; ++c)
+					{
+						const bool bSpace = *c == ' ' || *c == '\t' || *c == '\r';
+						if (!bSpace && !bInToken) ++Corners;
+						bInToken = !bSpace;
+					}
+					if (Corners >= 3) FaceCornerCount += (Corners - 2) * 3;
+				}
+			});
+			Positions.reserve(PositionCount);
+			TexCoords.reserve(TexcoordCount);
+			Normals.reserve(NormalCount);
+			FaceData.reserve(FaceCornerCount);
+			UniqueVertices.reserve(FaceCornerCount);
+		}
+
+		ForEachLine(Text, [&](const char* Start, size_t Length) {
+			std::string Line(Start, Length);
+			if (Line.empty() || Line[0] == '#') return;
+
+			std::stringstream ss(Line);
+			std::string Prefix;
+			ss >> Prefix;
+			if (Prefix == "v")
+			{
+				FFloat3 Pos;
+				if (ss >> Pos.x >> Pos.y >> Pos.z) Positions.push_back(Pos);
+			}
+			else if (Prefix == "vt")
+			{
+				FFloat2 Tex;
+				if (ss >> Tex.x >> Tex.y) TexCoords.push_back(FFloat2{ Tex.x, 1.0f - Tex.y });
+			}
+			else if (Prefix == "vn")
+			{
+				FFloat3 Normal;
+				if (ss >> Normal.x >> Normal.y >> Normal.z) Normals.push_back(Normal);
+			}
+			else if (Prefix == "f")
+			{
+				EU::TInlineArray<FVertexData, 8> FaceIndices;
+				std::string Segment;
+				while (ss >> Segment)
+				{
+					FVertexData Vertex = { 0, 0, 0 };
+					const size_t TexStart = Segment.find('/');
+					const size_t NormStart = Segment.find('/', TexStart + 1);
+					Vertex.PosIndex = std::stoul(Segment.substr(0, TexStart)) - 1;
+					if (TexStart != std::string::npos && NormStart != TexStart + 1)
+					{
+						Vertex.TexIndex = std::stoul(Segment.substr(TexStart + 1, NormStart - TexStart - 1)) - 1;
+					}
+					if (NormStart != std::string::npos)
+					{
+						Vertex.NormalIndex = std::stoul(Segment.substr(NormStart + 1)) - 1;
+					}
+					FaceIndices.Add(Vertex);
+				}
+				for (size_t i = 1; i + 1 < FaceIndices.Num(); ++i)
+				{
+					FaceData.push_back(FaceIndices[0]);
+					FaceData.push_back(FaceIndices[i]);
+					FaceData.push_back(FaceIndices[i + 1]);
+				}
+			}
+		});
+
+		FParseResult Result;
+		Result.Corners = FaceData.size() + Positions.size() + TexCoords.size() + Normals.size();
+		Result.StackBytes = EU::StackAllocator::GetThreadLocal().GetUsed();
+		return Result;
+	}
+
+	/**
+	 * @brief Los temporales de Parse con los tamaos del modelo, sin leer texto.
+	 */
+	template<template<typename> class TAllocator>
+	FParseResult Fill(size_t VertexCount, size_t CornerCount, bool bReserve)
+	{
+		EU::FScopedStackMarker Scratch;
+		std::vector<FFloat3, TAllocator<FFloat3>> Positions;
+		std::vector<FFloat2, TAllocator<FFloat2>> TexCoords;
+		std::vector<FFloat3, TAllocator<FFloat3>> Normals;
+		std::vector<FVertexData, TAllocator<FVertexData>> FaceData;
+		std::vector<FVertexData, TAllocator<FVertexData>> UniqueVertices;
+		if (bReserve)
+		{
+			Positions.reserve(VertexCount);
+			TexCoords.reserve(VertexCount);
+			Normals.reserve(VertexCount);
+			FaceData.reserve(CornerCount);
+			UniqueVertices.reserve(CornerCount);
+		}
+		for (size_t i = 0; i < VertexCount; ++i)
+		{
+			const float f = static_cast<float>(i);
+			Positions.push_back(FFloat3{ f, 0.0f, f });
+			TexCoords.push_back(FFloat2{ f, f });
+			Normals.push_back(FFloat3{ 0.0f, 1.0f, 0.0f });
+		}
+		for (size_t i = 0; i < CornerCount; ++i)
+		{
+			const unsigned int Index = static_cast<unsigned int>(i % VertexCount);
+			FaceData.push_back(FVertexData{ Index, Index, Index });
+		}
+
+		FParseResult Result;
+		Result.Corners = FaceData.size() + Positions.size();
+		Result.StackBytes = EU::StackAllocator::GetThreadLocal().GetUsed();
+		return Result;
+	}
+
+	void Report(const char* Name, double Ms, const FParseResult& Result)
+	{
+		std::printf("%-32s %10.2f %12.2f\n", Name, Ms / Loads, Result.StackBytes / 1048576.0);
+	}
+
+	template<template<typename> class TAllocator>
+	void RunFill(const char* Name, bool bReserve)
+	{
+		const size_t VertexCount = size_t(GridSize + 1) * (GridSize + 1);
+		const size_t CornerCount = size_t(GridSize) * GridSize * 6;
+		FParseResult Result;
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Load = 0; Load < Loads; ++Load) Result = Fill<TAllocator>(VertexCount, CornerCount, bReserve);
+			EUBench::Consume(Result.Corners);
+		});
+		Report(Name, Ms, Result);
+	}
+
+	template<template<typename> class TAllocator>
+	void Run(const char* Name, const std::string& Text, bool bReserve)
+	{
+		FParseResult Result;
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Load = 0; Load < Loads; ++Load) Result = Parse<TAllocator>(Text, bReserve);
+			EUBench::Consume(Result.Corners);
+		});
+		Report(Name, Ms, Result);
+	}
+}
+
+int main()
+{
+	const std::string Text = MakeGridObj(GridSize);
+	std::printf("OBJ de %.1f MB (%d x %d quads), %d cargas seguidas\n", Text.size() / 1048576.0,
+		GridSize, GridSize, Loads);
+	std::printf("%-32s %10s %12s\n", "", "ms/carga", "pila MB");
+	Run<std::allocator>("std::allocator + reserve", Text, true);
+	Run<EU::TStackStdAllocator>("TStackStdAllocator + reserve", Text, true);
+	Run<std::allocator>("std::allocator, push_back", Text, false);
+	Run<EU::TStackStdAllocator>("TStackStdAllocator, push_back", Text, false);
+
+	std::printf("\nSolo los temporales (mismos tamaos, sin parsear)\n");
+	std::printf("%-32s %10s %12s\n", "", "ms/carga", "pila MB");
+	RunFill<std::allocator>("std::allocator + reserve", true);
+	RunFill<EU::TStackStdAllocator>("TStackStdAllocator + reserve", true);
+	RunFill<std::allocator>("std::allocator, push_back", false);
+	RunFill<EU::TStackStdAllocator>("TStackStdAllocator, push_back", false);
+	return 0;
+}
@@ -0,0 +1,146 @@
+#include <cstdint>
+#include <new>
+#include <vector>
+#include "EngineUtilities/Memory/StackAllocator.h"
+#include "EUTest.h"
+
+using namespace EU;
+
+/**
+ * Free() solo recupera la cima: liberar una reserva que no es la ltima deja un hueco que solo
+ * cierra FreeToMarker().
+ */
+static void TestFreeLeavesHoleUntilMarker()
+{
+	StackAllocator Stack(size_t(16) << 20);
+	const StackAllocator::FMarker Start = Stack.GetMarker();
+
+	void* A = Stack.Allocate(100);
+	void* B = Stack.Allocate(200);
+	const StackAllocator::FMarker AfterB = Stack.GetMarker();
+	void* C = Stack.Allocate(300);
+	const StackAllocator::FMarker AfterC = Stack.GetMarker();
+	EU_CHECK(A != nullptr && B != nullptr && C != nullptr);
+
+	// B no es la cima: nada cambia.
+	Stack.Free(B);
+	EU_CHECK(Stack.GetUsed() == AfterC);
+
+	// C s: la cima vuelve a donde estaba antes de C, pero B sigue ocupando su sitio.
+	Stack.Free(C);
+	EU_CHECK(Stack.GetUsed() == AfterB);
+
+	// Free solo recuerda la ltima reserva: ni liberar C otra vez ni liberar A mueven la cima.
+	Stack.Free(C);
+	Stack.Free(A);
+	EU_CHECK(Stack.GetUsed() == AfterB);
+
+	// La siguiente reserva va detrs del hueco de B, no dentro.
+	void* D = Stack.Allocate(50);
+	EU_CHECK(static_cast<uint8_t*>(D) >= static_cast<uint8_t*>(B) + 200);
+
+	Stack.FreeToMarker(Start);
+	EU_CHECK(Stack.GetUsed() == Start);
+	EU_CHECK(Stack.Allocate(100) == A);
+}
+
+/**
+ * Free de la cima tambin devuelve el relleno de alineacin que se aadi para ella.
+ */
+static void TestFreeRewindsPadding()
+{
+	StackAllocator Stack(size_t(16) << 20);
+	Stack.Allocate(3, 1);
+	const StackAllocator::FMarker Before = Stack.GetMarker();
+	void* Aligned = Stack.Allocate(64, 256);
+	EU_CHECK(reinterpret_cast<uintptr_t>(Aligned) % 256 == 0);
+	EU_CHECK(Stack.GetUsed() > Before + 64);
+	Stack.Free(Aligned);
+	EU_CHECK(Stack.GetUsed() == Before);
+}
+
+/**
+ * Marcadores anidados con FScopedStackMarker.
+ */
+static void TestScopedMarkers()
+{
+	StackAllocator Stack(size_t(16) << 20);
+	const StackAllocator::FMarker Start = Stack.GetMarker();
+	{
+		FScopedStackMarker Outer(Stack);
+		Stack.Allocate(1000);
+		const StackAllocator::FMarker Middle = Stack.GetMarker();
+		{
+			FScopedStackMarker Inner(Stack);
+			Stack.Allocate(5000);
+			Stack.Allocate(7000);
+		}
+		EU_CHECK(Stack.GetUsed() == Middle);
+	}
+	EU_CHECK(Stack.GetUsed() == Start);
+}
+
+/**
+ * Un std::vector que crece sobre la pila deja un hueco por cada reubicacin; con reserve() del
+ * tamao final ocupa exactamente lo suyo.
+ */
+static void TestVectorGrowthHoles()
+{
+	StackAllocator Stack(size_t(16) << 20);
+	using FStackVector = std::vector<uint32_t, TStackStdAllocator<uint32_t>>;
+	{
+		FScopedStackMarker Scratch(Stack);
+		FStackVector Growing{ TStackStdAllocator<uint32_t>(Stack) };
+		for (uint32_t i = 0; i < 10000; ++i) Growing.push_back(i);
+		EU_CHECK(Growing[9999] == 9999);
+		EU_CHECK(Stack.GetUsed() > Growing.capacity() * sizeof(uint32_t) + 1024);
+	}
+	EU_CHECK(Stack.GetUsed() == 0);
+	{
+		FScopedStackMarker Scratch(Stack);
+		FStackVector Reserved{ TStackStdAllocator<uint32_t>(Stack) };
+		Reserved.reserve(10000);
+		for (uint32_t i = 0; i < 10000; ++i) Reserved.push_back(i);
+		EU_CHECK(Stack.GetUsed() == 10000 * sizeof(uint32_t));
+	}
+	EU_CHECK(Stack.GetUsed() == 0);
+}
+
+/**
+ * Agotar el rango: Allocate devuelve nullptr y TStackStdAllocator lanza std::bad_alloc. Trim()
+ * devuelve las pginas por encima de la cima.
+ */
+static void TestExhaustionAndTrim()
+{
+	StackAllocator Stack(size_t(1) << 20);
+	EU_CHECK(Stack.Allocate(size_t(2) << 20) == nullptr);
+
+	bool bThrew = false;
+	try
+	{
+		std::vector<uint8_t, TStackStdAllocator<uint8_t>> Huge{ TStackStdAllocator<uint8_t>(Stack) };
+		Huge.resize(size_t(2) << 20);
+	}
+	catch (const std::bad_alloc&)
+	{
+		bThrew = true;
+	}
+	EU_CHECK(bThrew);
+
+	Stack.Allocate(size_t(512) << 10);
+	const size_t Committed = Stack.GetCommitted();
+	Stack.FreeToMarker(0);
+	EU_CHECK(Stack.GetCommitted() == Committed);
+	Stack.Trim();
+	EU_CHECK(Stack.GetCommitted() == 0);
+}
+
+int main()
+{
+	TestFreeLeavesHoleUntilMarker();
+	TestFreeRewindsPadding();
+	TestScopedMarkers();
+	TestVectorGrowthHoles();
+	TestExhaustionAndTrim();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "EngineUtilities/Structures/TArray.h"
+#include "Legacy/LegacyTArray.h"
+#include "EUBenchmark.h"
+
+/**
+ * Crecer un TArray sin Reserve frente a la TArray anterior (new T[] y copia en cada crecimiento)
+ * y std::vector, con tres tipos: int (se reubica con memcpy), std::string de 40 caracteres (en el
+ * montn) y un componente con nombre y 64 vrtices (como MeshComponent). Todos aaden con
+ * Add(const T&) desde el mismo array de origen, as que la copia de cada elemento nuevo cuesta lo
+ * mismo en los tres y la diferencia es lo que cuesta crecer.
+ *
+ * Adems del tiempo se cuentan las llamadas a operator new: la TArray anterior construye por
+ * defecto toda la capacidad nueva y copia a fondo cada elemento en cada crecimiento.
+ *
+ * La segunda tabla mide RemoveAt(0) repetido sobre 20K cadenas (desplazar copiando o moviendo),
+ * junto al tiempo de solo llenar el array.
+ */
+namespace {
+	uint64_t NewCalls = 0;
+
+	struct FMeshComponentData
+	{
+		std::string Name;
+		std::vector<float> Vertices;
+	};
+
+	struct FResult
+	{
+		double Ms = 0.0;
+		uint64_t News = 0;
+	};
+
+	template<typename F>
+	FResult Measure(F&& Body)
+	{
+		FResult Result;
+		uint64_t Before = 0;
+		Result.Ms = EUBench::MeasureMs([&]() {
+			Before = NewCalls;
+			Body();
+		});
+		Result.News = NewCalls - Before;
+		return Result;
+	}
+
+	template<typename T>
+	void RunGrowth(const char* TypeName, const std::vector<T>& Source)
+	{
+		const FResult Old = Measure([&]() {
+			EULegacy::TArray<T> Array;
+			for (const T& Element : Source) Array.Add(Element);
+			EUBench::Consume(Array.Num());
+		});
+		const FResult New = Measure([&]() {
+			EU::TArray<T> Array;
+			for (const T& Element : Source) Array.Add(Element);
+			EUBench::Consume(Array.Num());
+		});
+		const FResult Vector = Measure([&]() {
+			std::vector<T> Array;
+			for (const T& Element : Source) Array.push_back(Element);
+			EUBench::Consume(Array.size());
+		});
+		std::printf("%-22s %9zu %10.2f %10.2f %10.2f %12llu %12llu %12llu\n", TypeName, Source.size(),
+			Old.Ms, New.Ms, Vector.Ms, static_cast<unsigned long long>(Old.News),
+			static_cast<unsigned long long>(New.News), static_cast<unsigned long long>(Vector.News));
+	}
+
+	template<typename FArray>
+	double RemoveFront(const std::vector<std::string>& Source, size_t Removals)
+	{
+		return EUBench::MeasureMs([&]() {
+			FArray Array;
+			for (const std::string& Element : Source) Array.Add(Element);
+			for (size_t i = 0; i < Removals; ++i) Array.RemoveAt(0);
+			EUBench::Consume(Array.Num());
+		});
+	}
+}
+
+/**
+ * operator new contado (solo para este benchmark). Las formas alineadas no se cuentan: ninguno
+ * de los tipos medidos pide ms alineacin que la por defecto.
+ */
+void* operator new(size_t Size)
+{
+	++NewCalls;
+	if (void* Block = std::malloc(Size != 0 ? Size : 1)) return Block;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* Block) noexcept { std::free(Block); }
+void operator delete(void* Block, size_t) noexcept { std::free(Block); }
+
+int main()
+{
+	std::vector<int> Ints(10000000);
+	for (size_t i = 0; i < Ints.size(); ++i) Ints[i] = static_cast<int>(i);
+	std::vector<std::string> Strings(1000000);
+	for (size_t i = 0; i < Strings.size(); ++i) Strings[i] = std::string(40, char('a' + i % 26));
+	std::vector<FMeshComponentData> Meshes(100000);
+	for (size_t i = 0; i < Meshes.size(); ++i)
+	{
+		Meshes[i] = FMeshComponentData{ "Mesh_" + std::to_string(i) + "_LOD0_Material", std::vector<float>(64, 1.0f) };
+	}
+
+	std::printf("Crecer sin Reserve (ms y llamadas a operator new)\n");
+	std::printf("%-22s %9s %10s %10s %10s %12s %12s %12s\n", "", "elementos", "anterior", "TArray", "vector",
+		"new ant.", "new TArray", "new vector");
+	RunGrowth("int", Ints);
+	RunGrowth("std::string (40)", Strings);
+	RunGrowth("componente (64 vrt.)", Meshes);
+
+	const std::vector<std::string> Source(Strings.begin(), Strings.begin() + 20000);
+	std::printf("\nRemoveAt(0) x 2000 sobre 20K std::string (ms)\n");
+	std::printf("%-22s %10s %10s\n", "", "llenar", "+ RemoveAt");
+	std::printf("%-22s %10.2f %10.2f\n", "anterior", RemoveFront<EULegacy::TArray<std::string>>(Source, 0),
+		RemoveFront<EULegacy::TArray<std::string>>(Source, 2000));
+	std::printf("%-22s %10.2f %10.2f\n", "TArray", RemoveFront<EU::TArray<std::string>>(Source, 0),
+		RemoveFront<EU::TArray<std::string>>(Source, 2000));
+	return 0;
+}
@@ -0,0 +1,237 @@
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "EngineUtilities/Structures/TArray.h"
+#include "EUTest.h"
+
+using EU::TArray;
+
+namespace {
+	/**
+	 * @brief Cuenta construcciones por copia y por movimiento, y los objetos vivos.
+	 *
+	 * Con bNoexceptMove = false el constructor de movimiento puede lanzar, as que TArray debe
+	 * copiar al crecer. CopiesUntilThrow > 0 hace que la copia nmero N lance.
+	 */
+	template<bool bNoexceptMove>
+	struct TTracked
+	{
+		static int Alive;
+		static int Copies;
+		static int Moves;
+		static int CopiesUntilThrow;
+
+		int Value;
+
+		explicit TTracked(int InValue) : Value(InValue) { ++Alive; }
+		TTracked(const TTracked& Other) : Value(Other.Value)
+		{
+			if (CopiesUntilThrow > 0 && --CopiesUntilThrow == 0)
+			{
+				throw std::runtime_error("copia");
+			}
+			++Copies;
+			++Alive;
+		}
+		TTracked(TTracked&& Other) noexcept(bNoexceptMove) : Value(Other.Value)
+		{
+			Other.Value = -1;
+			++Moves;
+			++Alive;
+		}
+		TTracked& operator=(const TTracked&) = default;
+		TTracked& operator=(TTracked&&) = default;
+		~TTracked() { --Alive; }
+
+		static void ResetCounts()
+		{
+			Copies = 0;
+			Moves = 0;
+			CopiesUntilThrow = 0;
+		}
+	};
+	template<bool B> int TTracked<B>::Alive = 0;
+	template<bool B> int TTracked<B>::Copies = 0;
+	template<bool B> int TTracked<B>::Moves = 0;
+	template<bool B> int TTracked<B>::CopiesUntilThrow = 0;
+
+	using FThrowingMove = TTracked<false>;
+	using FNoexceptMove = TTracked<true>;
+
+	/**
+	 * @brief Tipo con constructores propios marcado como trivialmente reubicable.
+	 */
+	struct FRelocatable
+	{
+		static int Moves;
+		int Value;
+
+		explicit FRelocatable(int InValue) : Value(InValue) {}
+		FRelocatable(const FRelocatable& Other) : Value(Other.Value) {}
+		FRelocatable(FRelocatable&& Other) noexcept : Value(Other.Value) { ++Moves; }
+		~FRelocatable() {}
+	};
+	int FRelocatable::Moves = 0;
+
+	template<typename T>
+	bool ValuesAre(const TArray<T>& Array, int Count)
+	{
+		if (Array.Num() != static_cast<size_t>(Count)) return false;
+		for (int i = 0; i < Count; ++i)
+		{
+			if (Array[i].Value != i) return false;
+		}
+		return true;
+	}
+}
+
+namespace EU {
+	template<>
+	struct TIsTriviallyRelocatable<FRelocatable> : std::true_type {};
+}
+
+/**
+ * Un tipo cuyo movimiento puede lanzar se copia al crecer (std::move_if_noexcept); uno con
+ * movimiento noexcept se mueve, y uno trivialmente reubicable se copia con memcpy sin llamar a
+ * ningn constructor.
+ */
+static void TestRelocationPath()
+{
+	{
+		FThrowingMove::ResetCounts();
+		TArray<FThrowingMove> Array;
+		for (int i = 0; i < 1000; ++i) Array.Add(FThrowingMove(i));
+		// Cada Add mueve su temporal una vez; las 10 reubicaciones (1, 2, 4 ... 512) copian.
+		EU_CHECK(FThrowingMove::Moves == 1000);
+		EU_CHECK(FThrowingMove::Copies == 1023);
+		EU_CHECK(ValuesAre(Array, 1000));
+	}
+	EU_CHECK(FThrowingMove::Alive == 0);
+	{
+		FNoexceptMove::ResetCounts();
+		TArray<FNoexceptMove> Array;
+		for (int i = 0; i < 1000; ++i) Array.Add(FNoexceptMove(i));
+		EU_CHECK(FNoexceptMove::Copies == 0);
+		EU_CHECK(FNoexceptMove::Moves == 1000 + 1023);
+		EU_CHECK(ValuesAre(Array, 1000));
+	}
+	EU_CHECK(FNoexceptMove::Alive == 0);
+	{
+		TArray<FRelocatable> Array;
+		for (int i = 0; i < 1000; ++i) Array.Emplace(i);
+		EU_CHECK(FRelocatable::Moves == 0);
+		EU_CHECK(ValuesAre(Array, 1000));
+	}
+	{
+		// Solo movimiento: se mueve aunque no haya copia a la que recurrir.
+		TArray<std::unique_ptr<int>> Array;
+		for (int i = 0; i < 100; ++i) Array.Emplace(new int(i));
+		bool bOk = true;
+		for (int i = 0; i < 100; ++i) bOk = bOk && *Array[i] == i;
+		EU_CHECK(bOk);
+	}
+}
+
+/**
+ * Si una copia de la reubicacin lanza, el array conserva sus elementos, su capacidad y su
+ * memoria; las copias ya hechas se destruyen y el bloque nuevo se libera (LeakSanitizer lo vigila).
+ */
+static void TestThrowingCopyKeepsArray()
+{
+	{
+		FThrowingMove::ResetCounts();
+		TArray<FThrowingMove> Array;
+		Array.Reserve(16);
+		for (int i = 0; i < 16; ++i) Array.Emplace(i);
+		const FThrowingMove* Before = Array.GetData();
+
+		FThrowingMove::CopiesUntilThrow = 6;
+		bool bThrew = false;
+		try
+		{
+			Array.Emplace(16);
+		}
+		catch (const std::runtime_error&)
+		{
+			bThrew = true;
+		}
+		EU_CHECK(bThrew);
+		EU_CHECK(Array.GetData() == Before && Array.GetCapacity() == 16);
+		EU_CHECK(ValuesAre(Array, 16));
+		EU_CHECK(FThrowingMove::Alive == 16);
+
+		// Lo mismo por Reserve.
+		FThrowingMove::CopiesUntilThrow = 10;
+		bThrew = false;
+		try
+		{
+			Array.Reserve(64);
+		}
+		catch (const std::runtime_error&)
+		{
+			bThrew = true;
+		}
+		EU_CHECK(bThrew && Array.GetCapacity() == 16 && ValuesAre(Array, 16));
+		EU_CHECK(FThrowingMove::Alive == 16);
+
+		// Sin fallo, el array crece con normalidad.
+		FThrowingMove::CopiesUntilThrow = 0;
+		Array.Emplace(16);
+		EU_CHECK(ValuesAre(Array, 17) && FThrowingMove::Alive == 17);
+	}
+	EU_CHECK(FThrowingMove::Alive == 0);
+}
+
+/**
+ * Si el constructor del elemento nuevo lanza al crecer, no se reubica nada.
+ */
+static void TestThrowingElementKeepsArray()
+{
+	TArray<std::string> Array;
+	for (int i = 0; i < 8; ++i) Array.Add(std::string(40, char('a' + i)));
+	const std::string* Before = Array.GetData();
+	bool bThrew = false;
+	try
+	{
+		// std::string(Texto, Pos, Count) lanza std::out_of_range si Pos supera la longitud.
+		Array.Emplace("corta", size_t(10), size_t(1));
+	}
+	catch (const std::out_of_range&)
+	{
+		bThrew = true;
+	}
+	EU_CHECK(bThrew);
+	EU_CHECK(Array.Num() == 8 && Array.GetCapacity() == 8 && Array.GetData() == Before);
+	EU_CHECK(Array[7] == std::string(40, 'h'));
+}
+
+/**
+ * RemoveAt conserva el orden moviendo; RemoveAtSwap trae el ltimo. Ninguno deja objetos vivos
+ * de ms.
+ */
+static void TestRemove()
+{
+	{
+		FNoexceptMove::ResetCounts();
+		TArray<FNoexceptMove> Array;
+		for (int i = 0; i < 10; ++i) Array.Emplace(i);
+		Array.RemoveAt(3);
+		EU_CHECK(Array.Num() == 9 && Array[2].Value == 2 && Array[3].Value == 4 && Array[8].Value == 9);
+		EU_CHECK(FNoexceptMove::Alive == 9 && FNoexceptMove::Copies == 0);
+		Array.RemoveAtSwap(0);
+		EU_CHECK(Array.Num() == 8 && Array[0].Value == 9 && Array[7].Value == 8);
+		Array.RemoveAtSwap(7);
+		EU_CHECK(Array.Num() == 7 && Array[6].Value == 7 && FNoexceptMove::Alive == 7);
+	}
+	EU_CHECK(FNoexceptMove::Alive == 0);
+}
+
+int main()
+{
+	TestRelocationPath();
+	TestThrowingCopyKeepsArray();
+	TestThrowingElementKeepsArray();
+	TestRemove();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "EngineUtilities/Structures/TBitArray.h"
+#include "EUBenchmark.h"
+
+/**
+ * Recorrer mscaras de 1M bits con TBitArray frente a std::vector<bool>, a densidades dispersas
+ * (0,1 % y 1 %) y densas (50 % y 99 %), en s por pasada.
+ *
+ * - SetBits(): salta palabras vacas y quita el bit ms bajo de cada palabra.
+ * - FindFirstSet(i + 1) encadenado: lo que hara una lista de huecos libres.
+ * - IsSet bit a bit, y el mismo bucle sobre std::vector<bool>.
+ *
+ * La segunda tabla mide las operaciones de palabra completa sobre los mismos 1M bits: CountSet,
+ * And/Or/AndNot (SSE2) y Contains, frente a los mismos bucles bit a bit sobre std::vector<bool>.
+ * And/Or/AndNot empiezan cada pasada copiando A; a esas filas se les resta el tiempo de la copia.
+ */
+namespace {
+	constexpr size_t NumBits = 1024 * 1024;
+	constexpr int Passes = 20;
+
+	struct FMask
+	{
+		EU::TBitArray Bits;
+		std::vector<bool> Reference;
+	};
+
+	FMask MakeMask(uint64_t PerThousand, uint64_t Seed)
+	{
+		EUBench::FRandom Random(Seed);
+		FMask Mask{ EU::TBitArray(NumBits), std::vector<bool>(NumBits) };
+		for (size_t i = 0; i < NumBits; ++i)
+		{
+			if (Random.Next() % 1000 < PerThousand)
+			{
+				Mask.Bits.SetBit(i);
+				Mask.Reference[i] = true;
+			}
+		}
+		return Mask;
+	}
+
+	/**
+	 * @brief s por pasada del mejor de tres tandas de Passes pasadas.
+	 */
+	template<typename F>
+	double UsPerPass(F&& Body)
+	{
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Pass = 0; Pass < Passes; ++Pass) Body();
+		});
+		return Ms * 1000.0 / Passes;
+	}
+
+	void RunIteration(const char* Name, uint64_t PerThousand)
+	{
+		const FMask Mask = MakeMask(PerThousand, PerThousand + 1);
+		const EU::TBitArray& Bits = Mask.Bits;
+
+		const double SetBits = UsPerPass([&]() {
+			uint64_t Sum = 0;
+			for (size_t Index : Bits.SetBits()) Sum += Index;
+			EUBench::Consume(Sum);
+		});
+		const double FindFirst = UsPerPass([&]() {
+			uint64_t Sum = 0;
+			for (size_t Index = Bits.FindFirstSet(); Index != EU::TBitArray::InvalidIndex; Index = Bits.FindFirstSet(Index + 1))
+			{
+				Sum += Index;
+			}
+			EUBench::Consume(Sum);
+		});
+		const double IsSet = UsPerPass([&]() {
+			uint64_t Sum = 0;
+			for (size_t Index = 0; Index < NumBits; ++Index)
+			{
+				if (Bits.IsSet(Index)) Sum += Index;
+			}
+			EUBench::Consume(Sum);
+		});
+		const double VectorBool = UsPerPass([&]() {
+			uint64_t Sum = 0;
+			for (size_t Index = 0; Index < NumBits; ++Index)
+			{
+				if (Mask.Reference[Index]) Sum += Index;
+			}
+			EUBench::Consume(Sum);
+		});
+		std::printf("%-10s %9zu %10.1f %12.1f %10.1f %12.1f\n", Name, Bits.CountSet(), SetBits, FindFirst, IsSet, VectorBool);
+	}
+
+	void RunWordOps()
+	{
+		const FMask A = MakeMask(500, 101);
+		const FMask B = MakeMask(500, 102);
+		EU::TBitArray Bits;
+		std::vector<bool> Reference;
+
+		auto Row = [](const char* Name, double Mine, double Vector) {
+			std::printf("%-14s %10.2f %14.1f %8.0fx\n", Name, Mine, Vector, Vector / Mine);
+		};
+
+		Row("CountSet",
+			UsPerPass([&]() { EUBench::Consume(A.Bits.CountSet()); }),
+			UsPerPass([&]() {
+				size_t Count = 0;
+				for (size_t i = 0; i < NumBits; ++i) Count += A.Reference[i];
+				EUBench::Consume(Count);
+			}));
+
+		// Cada pasada parte de una copia de A; la copia (un memcpy de 128 KB) se mide aparte.
+		const double CopyMine = UsPerPass([&]() { Bits = A.Bits; EUBench::Consume(Bits.GetWords()[0]); });
+		const double CopyVector = UsPerPass([&]() { Reference = A.Reference; EUBench::Consume(Reference[0]); });
+		Row("copia", CopyMine, CopyVector);
+		Row("And", UsPerPass([&]() { Bits = A.Bits; Bits.And(B.Bits); EUBench::Consume(Bits.GetWords()[7]); }) - CopyMine,
+			UsPerPass([&]() {
+				Reference = A.Reference;
+				for (size_t i = 0; i < NumBits; ++i) Reference[i] = Reference[i] && B.Reference[i];
+				EUBench::Consume(Reference[7]);
+			}) - CopyVector);
+		Row("Or", UsPerPass([&]() { Bits = A.Bits; Bits.Or(B.Bits); EUBench::Consume(Bits.GetWords()[7]); }) - CopyMine,
+			UsPerPass([&]() {
+				Reference = A.Reference;
+				for (size_t i = 0; i < NumBits; ++i) Reference[i] = Reference[i] || B.Reference[i];
+				EUBench::Consume(Reference[7]);
+			}) - CopyVector);
+		Row("AndNot", UsPerPass([&]() { Bits = A.Bits; Bits.AndNot(B.Bits); EUBench::Consume(Bits.GetWords()[7]); }) - CopyMine,
+			UsPerPass([&]() {
+				Reference = A.Reference;
+				for (size_t i = 0; i < NumBits; ++i) Reference[i] = Reference[i] && !B.Reference[i];
+				EUBench::Consume(Reference[7]);
+			}) - CopyVector);
+
+		// Contains recorre todo el array cuando la respuesta es s: A contiene A AND B.
+		EU::TBitArray Query = A.Bits;
+		Query.And(B.Bits);
+		std::vector<bool> QueryReference(NumBits);
+		for (size_t i = 0; i < NumBits; ++i) QueryReference[i] = A.Reference[i] && B.Reference[i];
+		Row("Contains", UsPerPass([&]() { EUBench::Consume(A.Bits.Contains(Query)); }),
+			UsPerPass([&]() {
+				bool bContains = true;
+				for (size_t i = 0; i < NumBits; ++i) bContains = bContains && (!QueryReference[i] || A.Reference[i]);
+				EUBench::Consume(bContains);
+			}));
+	}
+}
+
+int main()
+{
+	std::printf("Recorrer los bits a 1 de 1M bits (us por pasada)\n");
+	std::printf("%-10s %9s %10s %12s %10s %12s\n", "densidad", "bits a 1", "SetBits", "FindFirstSet", "IsSet",
+		"vector<bool>");
+	RunIteration("0,1 %", 1);
+	RunIteration("1 %", 10);
+	RunIteration("50 %", 500);
+	RunIteration("99 %", 990);
+
+	std::printf("\nOperaciones de palabra sobre 1M bits al 50 %% (us por pasada)\n");
+	std::printf("%-14s %10s %14s %9s\n", "", "TBitArray", "vector<bool>", "");
+	RunWordOps();
+	return 0;
+}
@@ -0,0 +1,266 @@
+#include <cstdint>
+#include <vector>
+#include "EngineUtilities/Structures/TBitArray.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using EU::TBitArray;
+
+namespace {
+	using FReference = std::vector<bool>;
+
+	/**
+	 * @brief Tamaos alrededor de los lmites de palabra (y de par de palabras, por SSE2).
+	 */
+	const size_t Sizes[] = { 0, 1, 2, 63, 64, 65, 127, 128, 129, 191, 192, 193, 255, 256, 257, 1000 };
+
+	/**
+	 * @brief Los bits de la ltima palabra por encima de Num() estn a cero.
+	 */
+	bool TailIsClear(const TBitArray& Bits)
+	{
+		if (Bits.GetNumWords() != (Bits.Num() + 63) / 64) return false;
+		const size_t Used = Bits.Num() % 64;
+		if (Used == 0) return true;
+		return (Bits.GetWords()[Bits.GetNumWords() - 1] >> Used) == 0;
+	}
+
+	bool Matches(const TBitArray& Bits, const FReference& Reference)
+	{
+		if (Bits.Num() != Reference.size() || !TailIsClear(Bits)) return false;
+		size_t Count = 0;
+		for (size_t i = 0; i < Reference.size(); ++i)
+		{
+			if (Bits[i] != Reference[i]) return false;
+			Count += Reference[i];
+		}
+		return Bits.CountSet() == Count && Bits.Any() == (Count != 0);
+	}
+
+	FReference RandomBits(size_t Count, EUBench::FRandom& Generator, uint64_t OneIn)
+	{
+		FReference Reference(Count);
+		for (size_t i = 0; i < Count; ++i) Reference[i] = Generator.Next() % OneIn == 0;
+		return Reference;
+	}
+
+	TBitArray FromReference(const FReference& Reference)
+	{
+		TBitArray Bits(Reference.size());
+		for (size_t i = 0; i < Reference.size(); ++i) Bits.SetBit(i, Reference[i]);
+		return Bits;
+	}
+
+	size_t ReferenceFind(const FReference& Reference, size_t From, bool Value)
+	{
+		for (size_t i = From; i < Reference.size(); ++i)
+		{
+			if (Reference[i] == Value) return i;
+		}
+		return TBitArray::InvalidIndex;
+	}
+}
+
+/**
+ * Construir, Resize (crecer y encoger, a 0 y a 1), SetAll y Add en cada lmite de palabra: los
+ * bits nuevos toman su valor y la cola de la ltima palabra queda a cero.
+ */
+static void TestResizeAndTail()
+{
+	for (size_t Size : Sizes)
+	{
+		EU_CHECK(Matches(TBitArray(Size), FReference(Size, false)));
+		EU_CHECK(Matches(TBitArray(Size, true), FReference(Size, true)));
+
+		for (size_t Next : Sizes)
+		{
+			for (int Fill = 0; Fill < 2; ++Fill)
+			{
+				TBitArray Bits(Size, Fill == 1);
+				FReference Reference(Size, Fill == 1);
+				if (Size > 0)
+				{
+					Bits.ClearBit(Size / 2);
+					Reference[Size / 2] = false;
+				}
+				Bits.Resize(Next, Fill == 0);
+				Reference.resize(Next, Fill == 0);
+				EU_CHECK(Matches(Bits, Reference));
+
+				// Encoger y volver a crecer no resucita los bits que quedaron fuera.
+				Bits.Resize(Next / 3);
+				Bits.Resize(Next, false);
+				Reference.resize(Next / 3);
+				Reference.resize(Next, false);
+				EU_CHECK(Matches(Bits, Reference));
+
+				Bits.SetAll(true);
+				EU_CHECK(Matches(Bits, FReference(Next, true)));
+				Bits.SetAll(false);
+				EU_CHECK(Matches(Bits, FReference(Next, false)));
+			}
+		}
+	}
+
+	TBitArray Bits;
+	FReference Reference;
+	EUBench::FRandom Generator(7);
+	for (int i = 0; i < 300; ++i)
+	{
+		const bool Value = Generator.Next() % 3 == 0;
+		Bits.Add(Value);
+		Reference.push_back(Value);
+		EU_CHECK(Matches(Bits, Reference));
+	}
+}
+
+/**
+ * FindFirstSet y FindFirstClear desde cada posicin: el ltimo bit de una palabra, el primero de
+ * la siguiente y la cola de la ltima palabra (a cero, pero fuera de Num(): FindFirstClear no
+ * debe devolverla).
+ */
+static void TestFind()
+{
+	EUBench::FRandom Generator(11);
+	for (size_t Size : Sizes)
+	{
+		for (uint64_t OneIn : { uint64_t(1), uint64_t(2), uint64_t(50) })
+		{
+			const FReference Reference = RandomBits(Size, Generator, OneIn);
+			const TBitArray Bits = FromReference(Reference);
+			bool bOk = true;
+			for (size_t From = 0; From <= Size + 1; ++From)
+			{
+				bOk = bOk && Bits.FindFirstSet(From) == ReferenceFind(Reference, From, true);
+				bOk = bOk && Bits.FindFirstClear(From) == ReferenceFind(Reference, From, false);
+			}
+			EU_CHECK(bOk);
+		}
+	}
+
+	// Un solo bit a cada lado del lmite de palabra.
+	for (size_t Index : { size_t(63), size_t(64), size_t(127), size_t(128) })
+	{
+		TBitArray Bits(200);
+		Bits.SetBit(Index);
+		EU_CHECK(Bits.FindFirstSet() == Index && Bits.FindFirstSet(Index + 1) == TBitArray::InvalidIndex);
+		Bits.SetAll(true);
+		Bits.ClearBit(Index);
+		EU_CHECK(Bits.FindFirstClear() == Index && Bits.FindFirstClear(Index + 1) == TBitArray::InvalidIndex);
+	}
+}
+
+/**
+ * SetBits() visita exactamente los bits a 1, en orden, con palabras vacas entre medias.
+ */
+static void TestSetBits()
+{
+	EUBench::FRandom Generator(13);
+	for (size_t Size : Sizes)
+	{
+		for (uint64_t OneIn : { uint64_t(1), uint64_t(3), uint64_t(100) })
+		{
+			const FReference Reference = RandomBits(Size, Generator, OneIn);
+			std::vector<size_t> Expected;
+			for (size_t i = 0; i < Size; ++i)
+			{
+				if (Reference[i]) Expected.push_back(i);
+			}
+			const TBitArray Bits = FromReference(Reference);
+			std::vector<size_t> Visited;
+			for (size_t Index : Bits.SetBits()) Visited.push_back(Index);
+			EU_CHECK(Visited == Expected);
+		}
+	}
+
+	TBitArray Sparse(1000);
+	Sparse.SetBit(0);
+	Sparse.SetBit(63);
+	Sparse.SetBit(64);
+	Sparse.SetBit(999);
+	std::vector<size_t> Visited;
+	for (size_t Index : Sparse.SetBits()) Visited.push_back(Index);
+	EU_CHECK((Visited == std::vector<size_t>{ 0, 63, 64, 999 }));
+}
+
+/**
+ * And, Or, AndNot y Contains entre arrays de longitudes distintas, con nmero par e impar de
+ * palabras (pares de palabras con SSE2 y una palabra suelta al final). Or desde un array ms
+ * largo no puede dejar bits en la cola.
+ */
+static void TestCombine()
+{
+	EUBench::FRandom Generator(17);
+	for (size_t SizeA : Sizes)
+	{
+		for (size_t SizeB : Sizes)
+		{
+			const FReference A = RandomBits(SizeA, Generator, 2);
+			const FReference B = RandomBits(SizeB, Generator, 2);
+			auto InB = [&](size_t i) { return i < SizeB && B[i]; };
+
+			FReference And = A, Or = A, AndNot = A;
+			bool bContains = true;
+			for (size_t i = 0; i < SizeA; ++i)
+			{
+				And[i] = A[i] && InB(i);
+				Or[i] = A[i] || InB(i);
+				AndNot[i] = A[i] && !InB(i);
+			}
+			for (size_t i = 0; i < SizeB; ++i)
+			{
+				bContains = bContains && (!B[i] || (i < SizeA && A[i]));
+			}
+
+			const TBitArray BitsB = FromReference(B);
+			TBitArray Bits = FromReference(A);
+			Bits.And(BitsB);
+			EU_CHECK(Matches(Bits, And));
+			Bits = FromReference(A);
+			Bits.Or(BitsB);
+			EU_CHECK(Matches(Bits, Or));
+			Bits = FromReference(A);
+			Bits.AndNot(BitsB);
+			EU_CHECK(Matches(Bits, AndNot));
+			EU_CHECK(FromReference(A).Contains(BitsB) == bContains);
+		}
+	}
+
+	// Firma: la entidad con ms componentes contiene la consulta, no al revs.
+	TBitArray Signature(130);
+	Signature.SetBit(2);
+	Signature.SetBit(64);
+	Signature.SetBit(129);
+	TBitArray Query(65);
+	Query.SetBit(64);
+	EU_CHECK(Signature.Contains(Query) && !Query.Contains(Signature));
+}
+
+/**
+ * Copia y movimiento conservan los bits y la cola.
+ */
+static void TestCopyMove()
+{
+	EUBench::FRandom Generator(19);
+	const FReference Reference = RandomBits(193, Generator, 2);
+	TBitArray Source = FromReference(Reference);
+	TBitArray Copy(Source);
+	EU_CHECK(Matches(Copy, Reference));
+	TBitArray Assigned(5, true);
+	Assigned = Source;
+	EU_CHECK(Matches(Assigned, Reference));
+	TBitArray Moved(std::move(Source));
+	EU_CHECK(Matches(Moved, Reference) && Source.Num() == 0 && Source.FindFirstSet() == TBitArray::InvalidIndex);
+	Assigned = TBitArray(3, true);
+	EU_CHECK(Matches(Assigned, FReference(3, true)));
+}
+
+int main()
+{
+	TestResizeAndTail();
+	TestFind();
+	TestSetBits();
+	TestCombine();
+	TestCopyMove();
+	return EU_TEST_RESULT();
+}
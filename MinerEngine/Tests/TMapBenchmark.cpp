@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+#include "EngineUtilities/Structures/TMap.h"
+#include "Legacy/LegacyTMap.h"
+#include "EUBenchmark.h"
+
+/**
+ * TMap (Robin Hood) contra la TMap anterior de bsqueda lineal y std::unordered_map, con claves
+ * aleatorias de 64 bits a 1K, 100K y 1M claves: insercin, bsquedas con acierto y fallos.
+ * La TMap anterior es O(n) por operacin: a 1M claves tardara horas, as que se omite, y a
+ * 100K sus bsquedas usan una muestra de 10K claves.
+ */
+namespace {
+	struct FKeys
+	{
+		std::vector<uint64_t> Present;
+		std::vector<uint64_t> Missing;
+	};
+
+	FKeys MakeKeys(size_t Count)
+	{
+		EUBench::FRandom Random(Count);
+		FKeys Keys;
+		Keys.Present.resize(Count);
+		Keys.Missing.resize(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			Keys.Present[i] = Random.Next() | 1;   ///< Impares: presentes.
+			Keys.Missing[i] = Random.Next() & ~1ull; ///< Pares: nunca insertadas.
+		}
+		return Keys;
+	}
+
+	void Report(const char* Name, size_t Count, double InsertMs, double HitMs, double MissMs, size_t Lookups)
+	{
+		std::printf("%-20s %8zu  insert %9.2f ns/op  hit %8.2f ns/op", Name, Count,
+			InsertMs * 1e6 / Count, HitMs * 1e6 / Lookups);
+		if (MissMs >= 0.0)
+		{
+			std::printf("  miss %8.2f ns/op", MissMs * 1e6 / Lookups);
+		}
+		std::printf("\n");
+	}
+
+	void RunTMap(const FKeys& Keys)
+	{
+		const size_t Count = Keys.Present.size();
+		EU::TMap<uint64_t, uint64_t> Map;
+		const double InsertMs = EUBench::MeasureMs([&]() {
+			EU::TMap<uint64_t, uint64_t> Fresh;
+			for (uint64_t Key : Keys.Present) Fresh.Add(Key, Key);
+			Map = std::move(Fresh);
+		});
+		const double HitMs = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (uint64_t Key : Keys.Present) Sum += *Map.Find(Key);
+			EUBench::Consume(Sum);
+		});
+		const double MissMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Missing) Found += Map.Contains(Key);
+			EUBench::Consume(Found);
+		});
+		Report("EU::TMap", Count, InsertMs, HitMs, MissMs, Count);
+	}
+
+	void RunUnorderedMap(const FKeys& Keys)
+	{
+		const size_t Count = Keys.Present.size();
+		std::unordered_map<uint64_t, uint64_t> Map;
+		const double InsertMs = EUBench::MeasureMs([&]() {
+			std::unordered_map<uint64_t, uint64_t> Fresh;
+			for (uint64_t Key : Keys.Present) Fresh.emplace(Key, Key);
+			Map = std::move(Fresh);
+		});
+		const double HitMs = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (uint64_t Key : Keys.Present) Sum += Map.find(Key)->second;
+			EUBench::Consume(Sum);
+		});
+		const double MissMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Missing) Found += Map.count(Key);
+			EUBench::Consume(Found);
+		});
+		Report("std::unordered_map", Count, InsertMs, HitMs, MissMs, Count);
+	}
+
+	void RunLegacyTMap(const FKeys& Keys)
+	{
+		const size_t Count = Keys.Present.size();
+		const size_t Lookups = Count < 10000 ? Count : 10000;
+		EULegacy::TMap<uint64_t, uint64_t> Map;
+		const double InsertMs = EUBench::MeasureMs([&]() {
+			for (uint64_t Key : Keys.Present) Map.Add(Key, Key);  ///< Repetir solo actualiza valores.
+		}, 1);
+		const double HitMs = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			const size_t Stride = Count / Lookups;  ///< Muestra repartida por todo el array.
+			for (size_t i = 0; i < Lookups; ++i) Sum += Map[Keys.Present[i * Stride]];
+			EUBench::Consume(Sum);
+		}, 1);
+		Report("TMap anterior", Count, InsertMs, HitMs, -1.0, Lookups);
+	}
+}
+
+int main()
+{
+	for (size_t Count : { size_t(1000), size_t(100000), size_t(1000000) })
+	{
+		const FKeys Keys = MakeKeys(Count);
+		RunTMap(Keys);
+		RunUnorderedMap(Keys);
+		if (Count <= 100000)
+		{
+			RunLegacyTMap(Keys);  ///< Sin fallos: su operator[] termina el proceso si la clave no existe.
+		}
+		std::printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,216 @@
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "EngineUtilities/Structures/TMap.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using EU::TMap;
+
+namespace {
+	/**
+	 * Hash con solo cuatro ranuras de origen: fuerza cadenas largas de sondeo, desplazamientos
+	 * Robin Hood y borrados con backward shift a lo largo de muchas ranuras.
+	 */
+	struct FCollidingHash
+	{
+		size_t operator()(uint32_t Key) const { return Key % 4; }
+	};
+
+	template<typename FMap>
+	bool MatchesModel(const FMap& Map, const std::unordered_map<uint32_t, uint32_t>& Model)
+	{
+		if (Map.Num() != Model.size()) return false;
+		for (const auto& Entry : Model)
+		{
+			const uint32_t* Value = Map.Find(Entry.first);
+			if (Value == nullptr || *Value != Entry.second) return false;
+		}
+		return true;
+	}
+}
+
+static void TestAddFindUpdate()
+{
+	TMap<int, std::string> Map;
+	Map.Add(1, "One");
+	Map.Add(2, "Two");
+	EU_CHECK(Map.Num() == 2);
+	EU_CHECK(Map.Find(1) && *Map.Find(1) == "One");
+	EU_CHECK(Map.Find(3) == nullptr);
+
+	Map.Add(1, "Uno");
+	EU_CHECK(Map.Num() == 2);
+	EU_CHECK(*Map.Find(1) == "Uno");
+
+	Map.FindOrAdd(3) = "Three";
+	EU_CHECK(Map.Contains(3));
+
+	std::string Out;
+	EU_CHECK(Map.TryGet(2, Out) && Out == "Two");
+	EU_CHECK(!Map.TryGet(4, Out));
+}
+
+static void TestBackwardShiftRemoval()
+{
+	// Con cuatro ranuras de origen cada borrado obliga a recolocar a los sucesores del cmulo
+	TMap<uint32_t, uint32_t, FCollidingHash> Map;
+	std::unordered_map<uint32_t, uint32_t> Model;
+	for (uint32_t i = 0; i < 200; ++i)
+	{
+		Map.Add(i, i * 7);
+		Model[i] = i * 7;
+	}
+	EU_CHECK(MatchesModel(Map, Model));
+
+	for (uint32_t i = 0; i < 200; i += 3)
+	{
+		EU_CHECK(Map.Remove(i));
+		Model.erase(i);
+		EU_CHECK(!Map.Contains(i));
+	}
+	EU_CHECK(!Map.Remove(0));
+	EU_CHECK(MatchesModel(Map, Model));
+
+	// Reinsertar en los huecos que dej el desplazamiento
+	for (uint32_t i = 0; i < 200; i += 3)
+	{
+		Map.Add(i, i + 1);
+		Model[i] = i + 1;
+	}
+	EU_CHECK(MatchesModel(Map, Model));
+}
+
+static void TestRandomDifferential()
+{
+	// Operaciones aleatorias contra std::unordered_map, con crecimiento incluido
+	TMap<uint32_t, uint32_t> Map;
+	std::unordered_map<uint32_t, uint32_t> Model;
+	EUBench::FRandom Random(42);
+	for (int Step = 0; Step < 200000; ++Step)
+	{
+		const uint32_t Key = static_cast<uint32_t>(Random.Next() % 5000);
+		switch (Random.Next() % 3)
+		{
+		case 0:
+			Map.Add(Key, static_cast<uint32_t>(Step));
+			Model[Key] = static_cast<uint32_t>(Step);
+			break;
+		case 1:
+			EU_CHECK(Map.Remove(Key) == (Model.erase(Key) == 1));
+			break;
+		default:
+		{
+			const uint32_t* Value = Map.Find(Key);
+			const auto It = Model.find(Key);
+			EU_CHECK((Value == nullptr) == (It == Model.end()));
+			if (Value && It != Model.end()) EU_CHECK(*Value == It->second);
+			break;
+		}
+		}
+	}
+	EU_CHECK(MatchesModel(Map, Model));
+}
+
+static void TestRehashAndReserve()
+{
+	TMap<uint32_t, uint32_t> Map;
+	size_t LastCapacity = Map.GetCapacity();
+	int Growths = 0;
+	for (uint32_t i = 0; i < 10000; ++i)
+	{
+		Map.Add(i, ~i);
+		if (Map.GetCapacity() != LastCapacity)
+		{
+			++Growths;
+			LastCapacity = Map.GetCapacity();
+			EU_CHECK((LastCapacity & (LastCapacity - 1)) == 0);  ///< Potencia de dos.
+		}
+		EU_CHECK(Map.Num() * 5 <= Map.GetCapacity() * 4);      ///< Factor de carga mximo 0.8.
+	}
+	EU_CHECK(Growths > 5);
+	bool AllFound = true;
+	for (uint32_t i = 0; i < 10000; ++i)
+	{
+		const uint32_t* Value = Map.Find(i);
+		AllFound = AllFound && Value && *Value == ~i;
+	}
+	EU_CHECK(AllFound);
+
+	// Reserve deja sitio suficiente: insertar hasta Count no vuelve a crecer
+	TMap<uint32_t, uint32_t> Reserved;
+	Reserved.Reserve(1000);
+	const size_t Capacity = Reserved.GetCapacity();
+	for (uint32_t i = 0; i < 1000; ++i) Reserved.Add(i, i);
+	EU_CHECK(Reserved.GetCapacity() == Capacity);
+}
+
+static void TestIteration()
+{
+	TMap<uint32_t, uint32_t, FCollidingHash> Map;
+	for (uint32_t i = 0; i < 100; ++i) Map.Add(i, i);
+	for (uint32_t i = 0; i < 100; i += 2) Map.Remove(i);
+
+	// Cada par vivo aparece exactamente una vez
+	int Seen[100] = {};
+	size_t Count = 0;
+	for (const auto& Entry : Map)
+	{
+		EU_CHECK(Entry.Key < 100 && Entry.Key == Entry.Value);
+		++Seen[Entry.Key];
+		++Count;
+	}
+	EU_CHECK(Count == Map.Num());
+	for (uint32_t i = 0; i < 100; ++i) EU_CHECK(Seen[i] == (i % 2 ? 1 : 0));
+
+	// Los valores se pueden modificar a travs del iterador
+	for (auto& Entry : Map) Entry.Value += 1000;
+	EU_CHECK(*Map.Find(1) == 1001);
+
+	TMap<uint32_t, uint32_t> Empty;
+	EU_CHECK(!(Empty.begin() != Empty.end()));
+}
+
+static void TestAliasedValueAtGrowth()
+{
+	// Add copia un valor que vive en el propio mapa justo cuando la insercin lo hace crecer.
+	// El par debe construirse antes del rehash, que libera las ranuras viejas.
+	const std::string Long(64, 'v');  ///< Ms all del SSO: una copia de memoria liberada se nota.
+	TMap<uint32_t, std::string> Map;
+	Map.Add(0, Long);
+	for (uint32_t i = 1; i < 300; ++i)
+	{
+		const size_t CapacityBefore = Map.GetCapacity();
+		Map.Add(i, *Map.Find(i - 1));
+		if (Map.GetCapacity() != CapacityBefore)
+		{
+			EU_CHECK(*Map.Find(i) == Long);
+		}
+	}
+	bool AllIntact = true;
+	for (uint32_t i = 0; i < 300; ++i) AllIntact = AllIntact && *Map.Find(i) == Long;
+	EU_CHECK(AllIntact);
+
+	// Lo mismo con la clave: FindOrAdd con una clave copiada del propio mapa
+	TMap<std::string, int> ByName;
+	ByName.Add(std::string(40, 'a'), 0);
+	for (int i = 1; i < 100; ++i)
+	{
+		std::string Key = ByName.begin()->Key;
+		Key.back() = static_cast<char>('a' + i % 26);
+		Key += std::to_string(i);
+		ByName.FindOrAdd(Key) = i;
+	}
+	EU_CHECK(ByName.Num() == 100);
+}
+
+int main()
+{
+	TestAddFindUpdate();
+	TestBackwardShiftRemoval();
+	TestRandomDifferential();
+	TestRehashAndReserve();
+	TestIteration();
+	TestAliasedValueAtGrowth();
+	return EU_TEST_RESULT();
+}
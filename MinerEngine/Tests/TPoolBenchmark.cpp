@@ -0,0 +1,115 @@
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "EngineUtilities/Memory/TPool.h"
+#include "EngineUtilities/Memory/TRefCounted.h"
+#include "EngineUtilities/Memory/TRefPtr.h"
+#include "EUBenchmark.h"
+
+/**
+ * 1M componentes creados y destruidos con TPoolAllocated (como Transform y MeshComponent) frente
+ * al mismo tipo con el new/delete global.
+ *
+ * - Oleada: crear 1M, destruirlos en orden aleatorio y volver a crearlos (los bloques ya existen).
+ * - Churn: 10K vivos, 1M veces se destruye uno al azar y se crea otro en su lugar.
+ * - Recorrido: sumar un campo de los 1M vivos, en el orden de creacin.
+ */
+namespace {
+	constexpr size_t SpawnCount = 1000000;
+	constexpr size_t LiveCount = 10000;
+
+	/// Transform: posicin, rotacin, escala y matriz (como ECS/Transform.h).
+	struct FTransformData
+	{
+		float Position[3] = { 0.0f, 0.0f, 0.0f };
+		float Rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		float Scale[3] = { 1.0f, 1.0f, 1.0f };
+		float Matrix[16] = {};
+	};
+
+	struct FPooledTransform : EU::TRefCounted<>, EU::TPoolAllocated<FPooledTransform>, FTransformData
+	{
+	};
+
+	struct FHeapTransform : EU::TRefCounted<>, FTransformData
+	{
+	};
+
+	struct FTimes
+	{
+		double SpawnMs = 0.0;
+		double DestroyMs = 0.0;
+		double RespawnMs = 0.0;
+		double ChurnMs = 0.0;
+		double WalkMs = 0.0;
+	};
+
+	template<typename T>
+	FTimes Run(const std::vector<uint32_t>& DestroyOrder, const std::vector<uint32_t>& ChurnSlots)
+	{
+		FTimes Times;
+		std::vector<EU::TRefPtr<T>> Objects(SpawnCount);
+		auto Spawn = [&]() {
+			for (size_t i = 0; i < SpawnCount; ++i) Objects[i] = EU::MakeRef<T>();
+		};
+		auto Destroy = [&]() {
+			for (uint32_t i : DestroyOrder) Objects[i].reset();
+		};
+
+		// Crear y destruir no se repiten sobre el mismo estado: se repite el ciclo entero y se
+		// queda el mejor tiempo de cada fase.
+		for (int Repeat = 0; Repeat < 3; ++Repeat)
+		{
+			const double SpawnMs = EUBench::MeasureMs(Spawn, 1);
+			const double WalkMs = EUBench::MeasureMs([&]() {
+				float Sum = 0.0f;
+				for (const EU::TRefPtr<T>& Object : Objects) Sum += Object->Scale[1];
+				EUBench::Consume(static_cast<uint64_t>(Sum));
+			});
+			const double DestroyMs = EUBench::MeasureMs(Destroy, 1);
+			const double RespawnMs = EUBench::MeasureMs(Spawn, 1);
+			Destroy();
+
+			Times.SpawnMs = Repeat == 0 || SpawnMs < Times.SpawnMs ? SpawnMs : Times.SpawnMs;
+			Times.WalkMs = Repeat == 0 || WalkMs < Times.WalkMs ? WalkMs : Times.WalkMs;
+			Times.DestroyMs = Repeat == 0 || DestroyMs < Times.DestroyMs ? DestroyMs : Times.DestroyMs;
+			Times.RespawnMs = Repeat == 0 || RespawnMs < Times.RespawnMs ? RespawnMs : Times.RespawnMs;
+		}
+
+		std::vector<EU::TRefPtr<T>> Live(LiveCount);
+		for (EU::TRefPtr<T>& Object : Live) Object = EU::MakeRef<T>();
+		Times.ChurnMs = EUBench::MeasureMs([&]() {
+			for (uint32_t Slot : ChurnSlots)
+			{
+				Live[Slot].reset();
+				Live[Slot] = EU::MakeRef<T>();
+			}
+		});
+		return Times;
+	}
+
+	void Report(const char* Name, const FTimes& Times)
+	{
+		std::printf("%-16s %9.2f %9.2f %9.2f %9.2f %9.2f\n", Name, Times.SpawnMs, Times.DestroyMs,
+			Times.RespawnMs, Times.ChurnMs, Times.WalkMs);
+	}
+}
+
+int main()
+{
+	std::vector<uint32_t> DestroyOrder(SpawnCount);
+	for (uint32_t i = 0; i < SpawnCount; ++i) DestroyOrder[i] = i;
+	EUBench::FRandom Random(7);
+	for (size_t i = SpawnCount - 1; i > 0; --i) std::swap(DestroyOrder[i], DestroyOrder[Random.Next() % (i + 1)]);
+	std::vector<uint32_t> ChurnSlots(SpawnCount);
+	for (uint32_t& Slot : ChurnSlots) Slot = static_cast<uint32_t>(Random.Next() % LiveCount);
+
+	std::printf("%zu componentes de %zu bytes, ms\n", SpawnCount, sizeof(FPooledTransform));
+	std::printf("%-16s %9s %9s %9s %9s %9s\n", "", "crear", "destruir", "recrear", "churn", "recorrer");
+	Report("TPool", Run<FPooledTransform>(DestroyOrder, ChurnSlots));
+	Report("new/delete", Run<FHeapTransform>(DestroyOrder, ChurnSlots));
+	std::printf("\nSlabs de TPool: %zu de %zu bytes\n", EU::TPool<FPooledTransform>::Get().GetNumSlabs(),
+		EU::TPool<FPooledTransform>::SlabSize);
+	return 0;
+}
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Memory/TPool.h"
+#include "EngineUtilities/Memory/TRefCounted.h"
+#include "EngineUtilities/Memory/TRefPtr.h"
+#include "EUTest.h"
+
+using namespace EU;
+
+namespace {
+	/**
+	 * @brief Objeto que detecta si su bloque se entreg a dos dueos a la vez.
+	 *
+	 * Quien lo crea escribe Id y ~Id; si otro hilo recibiera el mismo bloque mientras vive, al
+	 * destruirlo la pareja ya no cuadrara.
+	 */
+	struct alignas(32) FStamped
+	{
+		uint64_t Id;
+		uint64_t Check;
+		uint8_t Padding[48];
+
+		explicit FStamped(uint64_t InId) : Id(InId), Check(~InId) {}
+		bool IsIntact() const { return Check == ~Id; }
+	};
+
+	/// Componente como Transform: recuento intrusivo y memoria de TPool.
+	struct FPooledComponent : TRefCounted<>, TPoolAllocated<FPooledComponent>
+	{
+		uint64_t Id = 0;
+	};
+
+	/**
+	 * @brief Cola con mutex para pasar objetos de los hilos que crean a los que destruyen.
+	 */
+	template<typename T>
+	struct THandoff
+	{
+		std::mutex Mutex;
+		std::vector<T> Items;
+		std::atomic<int> Producers{ 0 };
+
+		void Push(T Item)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Items.push_back(std::move(Item));
+		}
+
+		bool Pop(T& Out)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (Items.empty()) return false;
+			Out = std::move(Items.back());
+			Items.pop_back();
+			return true;
+		}
+	};
+}
+
+/**
+ * Todos los bloques vivos a la vez son distintos, estn alineados y caen dentro de un slab.
+ */
+static void TestBlocksAreDistinct()
+{
+	TPool<FStamped>& Pool = TPool<FStamped>::Get();
+	std::vector<FStamped*> Objects;
+	for (uint64_t i = 0; i < 10000; ++i) Objects.push_back(Pool.New(i));
+
+	std::vector<FStamped*> Sorted = Objects;
+	std::sort(Sorted.begin(), Sorted.end());
+	EU_CHECK(std::adjacent_find(Sorted.begin(), Sorted.end()) == Sorted.end());
+	bool bAligned = true;
+	bool bIntact = true;
+	for (FStamped* Object : Objects)
+	{
+		bAligned = bAligned && reinterpret_cast<uintptr_t>(Object) % alignof(FStamped) == 0;
+		bIntact = bIntact && Object->IsIntact();
+	}
+	EU_CHECK(bAligned && bIntact);
+	EU_CHECK(Pool.GetNumSlabs() == (10000 + TPool<FStamped>::BlocksPerSlab - 1) / TPool<FStamped>::BlocksPerSlab);
+
+	for (FStamped* Object : Objects) Pool.Delete(Object);
+}
+
+/**
+ * Varios hilos crean objetos que otros hilos destruyen a la vez: cada objeto llega intacto y se
+ * destruye una sola vez.
+ */
+static void TestCrossThreadFree()
+{
+	constexpr int Producers = 3;
+	constexpr int Consumers = 3;
+	constexpr uint64_t PerProducer = 20000;
+	constexpr int Rounds = 8;
+
+	TPool<FStamped>& Pool = TPool<FStamped>::Get();
+	std::atomic<int> Broken(0);
+	std::atomic<uint64_t> Destroyed(0);
+	for (int Round = 0; Round < Rounds; ++Round)
+	{
+		THandoff<FStamped*> Queue;
+		Queue.Producers = Producers;
+		std::vector<std::thread> Threads;
+		for (int p = 0; p < Producers; ++p)
+		{
+			Threads.emplace_back([&, p]() {
+				for (uint64_t i = 0; i < PerProducer; ++i) Queue.Push(Pool.New(uint64_t(p) << 32 | i));
+				--Queue.Producers;
+			});
+		}
+		for (int c = 0; c < Consumers; ++c)
+		{
+			Threads.emplace_back([&]() {
+				FStamped* Object = nullptr;
+				while (true)
+				{
+					const bool bDone = Queue.Producers.load() == 0;
+					if (!Queue.Pop(Object))
+					{
+						if (bDone) break;
+						std::this_thread::yield();
+						continue;
+					}
+					if (!Object->IsIntact()) ++Broken;
+					Object->Check = Object->Id;  // Estropea la marca antes de devolver el bloque.
+					Pool.Delete(Object);
+					++Destroyed;
+				}
+			});
+		}
+		for (std::thread& Thread : Threads) Thread.join();
+	}
+	EU_CHECK(Broken == 0);
+	EU_CHECK(Destroyed == uint64_t(Producers) * PerProducer * Rounds);
+}
+
+/**
+ * Cada hilo se queda un lote en su cach al reservar; al terminar lo devuelve a la lista global.
+ * Si no lo hiciera, mil hilos de corta vida agotaran varios slabs.
+ */
+static void TestThreadExitReturnsCache()
+{
+	// Tipo propio para empezar con el pool vaco: sin bloques libres de otras pruebas que tapen la fuga.
+	struct FProbe
+	{
+		uint64_t Value[8];
+	};
+	TPool<FProbe>& Pool = TPool<FProbe>::Get();
+	for (int i = 0; i < 1000; ++i)
+	{
+		std::thread([&Pool]() { Pool.Delete(Pool.New()); }).join();
+	}
+	EU_CHECK(Pool.GetNumSlabs() == 1);
+}
+
+/**
+ * Componentes con recuento intrusivo compartidos entre hilos: la ltima referencia se suelta en un
+ * hilo distinto del que cre el objeto y su "delete this" devuelve el bloque a TPool.
+ */
+static void TestRefCountedAcrossThreads()
+{
+	constexpr int Count = 20000;
+	std::vector<TRefPtr<FPooledComponent>> Components;
+	for (int i = 0; i < Count; ++i)
+	{
+		Components.push_back(MakeRef<FPooledComponent>());
+		Components.back()->Id = uint64_t(i);
+	}
+
+	std::vector<std::thread> Threads;
+	std::atomic<int> Wrong(0);
+	for (int t = 0; t < 4; ++t)
+	{
+		Threads.emplace_back([&, t]() {
+			for (int i = t; i < Count; i += 4)
+			{
+				TRefPtr<FPooledComponent> Copy = Components[i];
+				if (Copy->Id != uint64_t(i)) ++Wrong;
+			}
+		});
+	}
+	for (std::thread& Thread : Threads) Thread.join();
+	EU_CHECK(Wrong == 0);
+
+	THandoff<TRefPtr<FPooledComponent>> Queue;
+	for (TRefPtr<FPooledComponent>& Component : Components) Queue.Push(std::move(Component));
+	Components.clear();
+	Threads.clear();
+	for (int t = 0; t < 4; ++t)
+	{
+		Threads.emplace_back([&]() {
+			TRefPtr<FPooledComponent> Component;
+			while (Queue.Pop(Component)) Component.reset();
+		});
+	}
+	for (std::thread& Thread : Threads) Thread.join();
+
+	// Todo volvi al pool: volver a crear la misma cantidad no pide slabs.
+	const size_t Slabs = TPool<FPooledComponent>::Get().GetNumSlabs();
+	for (int i = 0; i < Count; ++i) Components.push_back(MakeRef<FPooledComponent>());
+	EU_CHECK(TPool<FPooledComponent>::Get().GetNumSlabs() == Slabs);
+}
+
+int main()
+{
+	TestBlocksAreDistinct();
+	TestCrossThreadFree();
+	TestThreadExitReturnsCache();
+	TestRefCountedAcrossThreads();
+	return EU_TEST_RESULT();
+}
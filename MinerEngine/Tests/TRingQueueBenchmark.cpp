@@ -0,0 +1,82 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Structures/TRingQueue.h"
+
+/**
+ * Rendimiento de TRingQueue con 1 a 16 productores y otros tantos consumidores. Cada productor
+ * empuja ItemsPerProducer enteros en una cola de 1024 posiciones; se mide el tiempo hasta que
+ * los consumidores los han sacado todos. La fila SPSC usa la especializacin de un solo hilo
+ * por lado.
+ */
+namespace {
+	constexpr uint32_t ItemsPerProducer = 2000000;
+	constexpr size_t QueueCapacity = 1024;
+
+	template<typename FQueue>
+	double RunThroughput(size_t Threads)
+	{
+		FQueue Queue(QueueCapacity);
+		const size_t Total = Threads * ItemsPerProducer;
+		std::atomic<size_t> Received(0);
+		std::atomic<bool> Go(false);
+		std::vector<std::thread> Workers;
+
+		for (size_t p = 0; p < Threads; ++p)
+		{
+			Workers.emplace_back([&]() {
+				while (!Go.load(std::memory_order_acquire)) std::this_thread::yield();
+				for (uint32_t i = 0; i < ItemsPerProducer; ++i)
+				{
+					while (!Queue.TryPush(i)) std::this_thread::yield();
+				}
+			});
+		}
+		for (size_t c = 0; c < Threads; ++c)
+		{
+			Workers.emplace_back([&]() {
+				while (!Go.load(std::memory_order_acquire)) std::this_thread::yield();
+				uint32_t Item = 0;
+				size_t Local = 0;
+				while (Received.load(std::memory_order_relaxed) < Total)
+				{
+					if (Queue.TryPop(Item))
+					{
+						if (++Local == 256)
+						{
+							Received.fetch_add(Local, std::memory_order_relaxed);
+							Local = 0;
+						}
+					}
+					else
+					{
+						Received.fetch_add(Local, std::memory_order_relaxed);
+						Local = 0;
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		const auto Start = std::chrono::steady_clock::now();
+		Go.store(true, std::memory_order_release);
+		for (std::thread& Worker : Workers) Worker.join();
+		const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+		return Total / Seconds / 1e6;
+	}
+}
+
+int main()
+{
+	std::printf("hilos de hardware: %u\n", std::thread::hardware_concurrency());
+	std::printf("SPSC       1P/1C  %8.2f Mops/s\n", RunThroughput<EU::TSpscRingQueue<uint32_t>>(1));
+	for (size_t Threads : { 1, 2, 4, 8, 16 })
+	{
+		std::printf("MPMC %5zuP/%zuC  %8.2f Mops/s\n", Threads, Threads,
+			RunThroughput<EU::TRingQueue<uint32_t>>(Threads));
+	}
+	return 0;
+}
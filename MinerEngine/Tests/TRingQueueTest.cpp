@@ -0,0 +1,125 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Structures/TRingQueue.h"
+#include "EUTest.h"
+
+using EU::TRingQueue;
+using EU::TSpscRingQueue;
+
+static void TestSingleThread()
+{
+	TRingQueue<int> Queue(3);
+	EU_CHECK(Queue.GetCapacity() == 4);
+
+	int Value = 0;
+	EU_CHECK(!Queue.TryPop(Value));
+	for (int i = 0; i < 4; ++i) EU_CHECK(Queue.TryPush(i));
+	EU_CHECK(!Queue.TryPush(4));
+	EU_CHECK(Queue.ApproxNum() == 4);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		EU_CHECK(Queue.TryPop(Value) && Value == i);
+	}
+	EU_CHECK(!Queue.TryPop(Value));
+}
+
+static void TestPendingDestroyed()
+{
+	// Los elementos que quedan en la cola se destruyen con ella
+	std::shared_ptr<int> Tracked = std::make_shared<int>(7);
+	{
+		TRingQueue<std::shared_ptr<int>> Queue(8);
+		TSpscRingQueue<std::shared_ptr<int>> Spsc(8);
+		for (int i = 0; i < 5; ++i)
+		{
+			std::shared_ptr<int> Copy = Tracked;
+			EU_CHECK(Queue.TryPush(std::move(Copy)));
+			EU_CHECK(Spsc.TryPush(Tracked));
+		}
+		EU_CHECK(Tracked.use_count() == 11);
+	}
+	EU_CHECK(Tracked.use_count() == 1);
+}
+
+/**
+ * Cada productor empuja (Productor << 32 | Secuencia). Cada consumidor marca el elemento recibido
+ * y comprueba que, por productor, las secuencias le llegan en orden creciente.
+ */
+template<typename FQueue>
+static void RunStress(size_t Producers, size_t Consumers, size_t Capacity, uint32_t ItemsPerProducer)
+{
+	FQueue Queue(Capacity);
+	const size_t Total = Producers * ItemsPerProducer;
+	std::unique_ptr<std::atomic<uint32_t>[]> Seen(new std::atomic<uint32_t>[Total]);
+	for (size_t i = 0; i < Total; ++i) Seen[i].store(0, std::memory_order_relaxed);
+
+	std::atomic<size_t> Received(0);
+	std::atomic<size_t> OrderErrors(0);
+	std::vector<std::thread> Threads;
+
+	for (size_t p = 0; p < Producers; ++p)
+	{
+		Threads.emplace_back([&Queue, p, ItemsPerProducer]() {
+			for (uint32_t i = 0; i < ItemsPerProducer; ++i)
+			{
+				while (!Queue.TryPush((uint64_t(p) << 32) | i)) std::this_thread::yield();
+			}
+		});
+	}
+	for (size_t c = 0; c < Consumers; ++c)
+	{
+		Threads.emplace_back([&, Producers, ItemsPerProducer]() {
+			std::vector<int64_t> LastSequence(Producers, -1);
+			uint64_t Item = 0;
+			while (Received.load(std::memory_order_relaxed) < Total)
+			{
+				if (!Queue.TryPop(Item))
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				const size_t Producer = static_cast<size_t>(Item >> 32);
+				const uint32_t Sequence = static_cast<uint32_t>(Item);
+				if (int64_t(Sequence) <= LastSequence[Producer]) ++OrderErrors;
+				LastSequence[Producer] = Sequence;
+				Seen[Producer * ItemsPerProducer + Sequence].fetch_add(1, std::memory_order_relaxed);
+				Received.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+	}
+	for (std::thread& Thread : Threads) Thread.join();
+
+	size_t Missing = 0;
+	size_t Duplicated = 0;
+	for (size_t i = 0; i < Total; ++i)
+	{
+		const uint32_t Count = Seen[i].load(std::memory_order_relaxed);
+		if (Count == 0) ++Missing;
+		if (Count > 1) ++Duplicated;
+	}
+	EU_CHECK(Received.load() == Total);
+	EU_CHECK(Missing == 0);
+	EU_CHECK(Duplicated == 0);
+	EU_CHECK(OrderErrors.load() == 0);
+	EU_CHECK(Queue.ApproxNum() == 0);
+}
+
+int main()
+{
+	TestSingleThread();
+	TestPendingDestroyed();
+
+	// Capacidad pequea para que la cola pase a menudo por llena y vaca
+	RunStress<TSpscRingQueue<uint64_t>>(1, 1, 64, 1000000);
+	RunStress<TRingQueue<uint64_t>>(1, 1, 64, 1000000);
+	RunStress<TRingQueue<uint64_t>>(4, 1, 64, 200000);
+	RunStress<TRingQueue<uint64_t>>(1, 4, 64, 800000);
+	RunStress<TRingQueue<uint64_t>>(4, 4, 64, 200000);
+	RunStress<TRingQueue<uint64_t>>(8, 8, 16, 50000);
+	return EU_TEST_RESULT();
+}
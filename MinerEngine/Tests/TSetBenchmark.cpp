@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <cstdio>
+#include <unordered_set>
+#include <vector>
+#include "EngineUtilities/Structures/TSet.h"
+#include "EUBenchmark.h"
+
+/**
+ * TSet (grupos de 16 con SSE2) contra std::unordered_set, con claves aleatorias de 64 bits a 1K,
+ * 100K y 1M claves: insercin sin reservar, bsquedas con acierto y fallos. Cada bsqueda cae en
+ * una ranura al azar, as que a 1M el tiempo lo marcan los fallos de cach.
+ */
+namespace {
+	struct FKeys
+	{
+		std::vector<uint64_t> Present;
+		std::vector<uint64_t> Missing;
+	};
+
+	FKeys MakeKeys(size_t Count)
+	{
+		EUBench::FRandom Random(Count);
+		FKeys Keys;
+		Keys.Present.resize(Count);
+		Keys.Missing.resize(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			Keys.Present[i] = Random.Next() | 1;   ///< Impares: presentes.
+			Keys.Missing[i] = Random.Next() & ~1ull; ///< Pares: nunca insertadas.
+		}
+		return Keys;
+	}
+
+	void Report(const char* Name, size_t Count, double InsertMs, double HitMs, double MissMs)
+	{
+		std::printf("%-20s %8zu  insert %8.2f ns/op  hit %7.2f ns/op  miss %7.2f ns/op\n", Name, Count,
+			InsertMs * 1e6 / Count, HitMs * 1e6 / Count, MissMs * 1e6 / Count);
+	}
+
+	void RunTSet(const FKeys& Keys)
+	{
+		const size_t Count = Keys.Present.size();
+		EU::TSet<uint64_t> Set;
+		const double InsertMs = EUBench::MeasureMs([&]() {
+			EU::TSet<uint64_t> Fresh;
+			for (uint64_t Key : Keys.Present) Fresh.Add(Key);
+			Set = std::move(Fresh);
+		});
+		const double HitMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Present) Found += Set.Contains(Key);
+			EUBench::Consume(Found);
+		});
+		const double MissMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Missing) Found += Set.Contains(Key);
+			EUBench::Consume(Found);
+		});
+		Report("EU::TSet", Count, InsertMs, HitMs, MissMs);
+	}
+
+	void RunUnorderedSet(const FKeys& Keys)
+	{
+		const size_t Count = Keys.Present.size();
+		std::unordered_set<uint64_t> Set;
+		const double InsertMs = EUBench::MeasureMs([&]() {
+			std::unordered_set<uint64_t> Fresh;
+			for (uint64_t Key : Keys.Present) Fresh.insert(Key);
+			Set = std::move(Fresh);
+		});
+		const double HitMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Present) Found += Set.count(Key);
+			EUBench::Consume(Found);
+		});
+		const double MissMs = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint64_t Key : Keys.Missing) Found += Set.count(Key);
+			EUBench::Consume(Found);
+		});
+		Report("std::unordered_set", Count, InsertMs, HitMs, MissMs);
+	}
+}
+
+int main()
+{
+	for (size_t Count : { size_t(1000), size_t(100000), size_t(1000000) })
+	{
+		const FKeys Keys = MakeKeys(Count);
+		RunTSet(Keys);
+		RunUnorderedSet(Keys);
+		std::printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,286 @@
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "EngineUtilities/Structures/TSet.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using EU::TSet;
+
+/**
+ * Las pruebas de sondeo usan una tabla de 64 ranuras (4 grupos de 16) y un hash que elige el
+ * grupo de origen de cada clave. Como begin() recorre las ranuras en orden, la posicin de una
+ * clave en la iteracin dice en qu grupo cay.
+ */
+namespace {
+	constexpr size_t TableCapacity = 64;
+	constexpr size_t GroupWidth = 16;
+	constexpr size_t GroupCount = TableCapacity / GroupWidth;
+
+	struct FKey
+	{
+		static int Alive;
+		uint32_t Group;  ///< Grupo de origen en una tabla de GroupCount grupos.
+		uint32_t Id;
+
+		FKey(uint32_t InGroup, uint32_t InId) : Group(InGroup), Id(InId) { ++Alive; }
+		FKey(const FKey& Other) : Group(Other.Group), Id(Other.Id) { ++Alive; }
+		FKey(FKey&& Other) noexcept : Group(Other.Group), Id(Other.Id) { ++Alive; }
+		FKey& operator=(const FKey&) = default;
+		~FKey() { --Alive; }
+
+		bool operator==(const FKey& Other) const { return Group == Other.Group && Id == Other.Id; }
+	};
+	int FKey::Alive = 0;
+
+	/**
+	 * @brief Un valor de hash que, tras MixHash, empieza a sondear en el grupo Group.
+	 */
+	uint64_t HashForGroup(size_t Group)
+	{
+		for (uint64_t Raw = 0;; ++Raw)
+		{
+			if (((EU::MixHash(Raw) >> 7) & (GroupCount - 1)) == Group) return Raw;
+		}
+	}
+
+	/**
+	 * Todas las claves de un grupo comparten hash completo (tambin los 7 bits de control), as
+	 * que cada coincidencia de byte obliga a comparar la clave.
+	 */
+	struct FGroupHash
+	{
+		size_t operator()(const FKey& Key) const
+		{
+			static const uint64_t Hashes[GroupCount] = { HashForGroup(0), HashForGroup(1), HashForGroup(2), HashForGroup(3) };
+			return static_cast<size_t>(Hashes[Key.Group]);
+		}
+	};
+
+	using FGroupSet = TSet<FKey, FGroupHash>;
+
+	FGroupSet MakeTable()
+	{
+		FGroupSet Set;
+		Set.Reserve(TableCapacity - TableCapacity / 8);
+		return Set;
+	}
+
+	/**
+	 * @brief Las claves en orden de ranura.
+	 */
+	std::vector<FKey> SlotOrder(const FGroupSet& Set)
+	{
+		std::vector<FKey> Keys;
+		for (const FKey& Key : Set) Keys.push_back(Key);
+		return Keys;
+	}
+
+	struct FCollidingHash
+	{
+		size_t operator()(uint32_t Key) const { return Key % 8; }
+	};
+}
+
+/**
+ * Las claves que no caben en el ltimo grupo siguen el sondeo y vuelven al grupo 0. Borrar en el
+ * grupo lleno deja lpidas que no cortan la bsqueda de las claves que siguieron de largo.
+ */
+static void TestGroupWrapAround()
+{
+	{
+		FGroupSet Set = MakeTable();
+		EU_CHECK(Set.GetCapacity() == TableCapacity);
+		const uint32_t Last = GroupCount - 1;
+		for (uint32_t Id = 0; Id < 24; ++Id) EU_CHECK(Set.Add(FKey(Last, Id)));
+		EU_CHECK(Set.Num() == 24 && Set.GetCapacity() == TableCapacity);
+
+		// Las 16 primeras llenan el grupo 3; las 8 siguientes dan la vuelta al grupo 0, que va
+		// primero al iterar.
+		const std::vector<FKey> Order = SlotOrder(Set);
+		bool bWrapped = true;
+		for (uint32_t i = 0; i < 8; ++i) bWrapped = bWrapped && Order[i].Id == 16 + i;
+		for (uint32_t i = 8; i < 24; ++i) bWrapped = bWrapped && Order[i].Id == i - 8;
+		EU_CHECK(bWrapped);
+
+		for (uint32_t Id = 0; Id < 16; Id += 2) EU_CHECK(Set.Remove(FKey(Last, Id)));
+		bool bFound = true;
+		for (uint32_t Id = 0; Id < 24; ++Id) bFound = bFound && Set.Contains(FKey(Last, Id)) == (Id >= 16 || Id % 2 == 1);
+		EU_CHECK(bFound);
+		EU_CHECK(!Set.Contains(FKey(Last, 999)));
+		EU_CHECK(Set.Find(FKey(Last, 23)) != nullptr && Set.Find(FKey(Last, 23))->Id == 23);
+	}
+	EU_CHECK(FKey::Alive == 0);
+}
+
+/**
+ * Un alta en un grupo lleno con lpidas reutiliza la lpida (la primera ranura libre del primer
+ * grupo del sondeo) en lugar de gastar una ranura vaca ms adelante.
+ */
+static void TestTombstoneReuse()
+{
+	{
+		FGroupSet Set = MakeTable();
+		for (uint32_t Id = 0; Id < 16; ++Id) Set.Add(FKey(0, Id));
+		for (uint32_t Id = 0; Id < 4; ++Id) Set.Add(FKey(1, Id));
+
+		// El grupo 0 est lleno: borrar la ranura 5 deja una lpida y la clave nueva ocupa su sitio,
+		// aunque el grupo 1, siguiente en el sondeo, tenga ranuras vacas.
+		EU_CHECK(Set.Remove(FKey(0, 5)));
+		EU_CHECK(Set.Add(FKey(0, 100)));
+		EU_CHECK(SlotOrder(Set)[5] == FKey(0, 100));
+
+		// Miles de ciclos: las claves del grupo 0 nunca se desbordan al grupo 1, que sigue con
+		// sus 4 claves en sus 4 primeras ranuras.
+		uint32_t Next = 1000;
+		for (int Cycle = 0; Cycle < 10000; ++Cycle)
+		{
+			const FKey Victim = SlotOrder(Set)[static_cast<size_t>(Cycle) % 16];
+			EU_CHECK(Set.Remove(Victim));
+			EU_CHECK(Set.Add(FKey(0, Next++)));
+		}
+		EU_CHECK(Set.Num() == 20 && Set.GetCapacity() == TableCapacity);
+		EU_CHECK(FKey::Alive == 20);
+		const std::vector<FKey> Order = SlotOrder(Set);
+		bool bInPlace = true;
+		for (uint32_t i = 0; i < 16; ++i) bInPlace = bInPlace && Order[i].Group == 0;
+		for (uint32_t i = 0; i < 4; ++i) bInPlace = bInPlace && Order[16 + i] == FKey(1, i);
+		EU_CHECK(bInPlace);
+	}
+	EU_CHECK(FKey::Alive == 0);
+}
+
+/**
+ * Con la carga agotada y la mitad en lpidas, el siguiente alta rehace la tabla sin crecer. Con
+ * la tabla llena de verdad, crece.
+ */
+static void TestRehash()
+{
+	{
+		FGroupSet Set = MakeTable();
+		// 56 claves (carga mxima 7/8): tres grupos llenos y 8 en el ltimo.
+		for (uint32_t Group = 0; Group < 3; ++Group)
+			for (uint32_t Id = 0; Id < 16; ++Id) Set.Add(FKey(Group, Id));
+		for (uint32_t Id = 0; Id < 8; ++Id) Set.Add(FKey(3, Id));
+		EU_CHECK(Set.Num() == 56 && Set.GetCapacity() == TableCapacity);
+
+		// Borrar en grupos llenos solo deja lpidas.
+		for (uint32_t Group = 0; Group < 3; ++Group)
+			for (uint32_t Id = 0; Id < 14; ++Id) EU_CHECK(Set.Remove(FKey(Group, Id)));
+		EU_CHECK(Set.Num() == 14);
+
+		// Quedan 8 vacas en el grupo 3, pero ninguna se puede gastar: se rehace a 64.
+		EU_CHECK(Set.Add(FKey(3, 100)));
+		EU_CHECK(Set.GetCapacity() == TableCapacity && Set.Num() == 15 && FKey::Alive == 15);
+		bool bFound = Set.Contains(FKey(3, 100));
+		for (uint32_t Group = 0; Group < 3; ++Group)
+			for (uint32_t Id = 14; Id < 16; ++Id) bFound = bFound && Set.Contains(FKey(Group, Id));
+		for (uint32_t Id = 0; Id < 8; ++Id) bFound = bFound && Set.Contains(FKey(3, Id));
+		EU_CHECK(bFound);
+
+		// Sin lpidas, la tabla crece al pasar de 56 elementos.
+		for (uint32_t Id = 200; Set.Num() < 56; ++Id) Set.Add(FKey(Id % GroupCount, Id));
+		EU_CHECK(Set.GetCapacity() == TableCapacity);
+		Set.Add(FKey(0, 9999));
+		EU_CHECK(Set.GetCapacity() == 2 * TableCapacity && Set.Num() == 57 && FKey::Alive == 57);
+	}
+	EU_CHECK(FKey::Alive == 0);
+
+	// Crecimiento normal: potencias de dos, carga mxima 7/8 y nada perdido por el camino.
+	TSet<uint32_t> Set;
+	size_t Growths = 0;
+	size_t LastCapacity = 0;
+	for (uint32_t i = 0; i < 100000; ++i)
+	{
+		Set.Add(i * 2654435761u);
+		if (Set.GetCapacity() != LastCapacity)
+		{
+			++Growths;
+			LastCapacity = Set.GetCapacity();
+			EU_CHECK((LastCapacity & (LastCapacity - 1)) == 0);
+		}
+		EU_CHECK(Set.Num() * 8 <= Set.GetCapacity() * 7);
+	}
+	EU_CHECK(Growths > 10);
+	bool bAll = true;
+	for (uint32_t i = 0; i < 100000; ++i) bAll = bAll && Set.Contains(i * 2654435761u);
+	EU_CHECK(bAll);
+}
+
+/**
+ * Elementos de solo movimiento: rehacer la tabla los mueve y no se pierde ni se duplica ninguno.
+ */
+static void TestMoveOnly()
+{
+	struct FPtrHash
+	{
+		size_t operator()(const std::unique_ptr<int>& Ptr) const { return reinterpret_cast<uintptr_t>(Ptr.get()); }
+	};
+	TSet<std::unique_ptr<int>, FPtrHash> Set;
+	for (int i = 0; i < 1000; ++i)
+	{
+		std::unique_ptr<int> Ptr(new int(i));
+		EU_CHECK(Set.Add(std::move(Ptr)));
+	}
+	int Sum = 0;
+	for (const std::unique_ptr<int>& Ptr : Set) Sum += *Ptr;
+	EU_CHECK(Set.Num() == 1000 && Sum == 999 * 1000 / 2);
+
+	std::vector<std::unique_ptr<int>> More;
+	for (int i = 0; i < 100; ++i) More.emplace_back(new int(1));
+	EU_CHECK(Set.InsertRange(std::make_move_iterator(More.begin()), std::make_move_iterator(More.end())) == 100);
+	EU_CHECK(Set.Num() == 1100);
+}
+
+/**
+ * Operaciones aleatorias contra std::unordered_set con un hash de 8 valores: cadenas de sondeo
+ * largas, lpidas y rehechos a la misma capacidad en todo momento.
+ */
+static void TestRandomDifferential()
+{
+	TSet<uint32_t, FCollidingHash> Set;
+	std::unordered_set<uint32_t> Model;
+	EUBench::FRandom Random(42);
+	for (int Step = 0; Step < 200000; ++Step)
+	{
+		const uint32_t Key = static_cast<uint32_t>(Random.Next() % 300);
+		const uint64_t Op = Random.Next() % 100;
+		if (Op < 45)
+		{
+			EU_CHECK(Set.Add(Key) == Model.insert(Key).second);
+		}
+		else if (Op < 90)
+		{
+			EU_CHECK(Set.Remove(Key) == (Model.erase(Key) == 1));
+		}
+		else if (Op < 99)
+		{
+			EU_CHECK(Set.Contains(Key) == (Model.count(Key) == 1));
+		}
+		else if (Random.Next() % 50 == 0)
+		{
+			Set.Clear();
+			Model.clear();
+		}
+	}
+	EU_CHECK(Set.Num() == Model.size());
+	size_t Iterated = 0;
+	bool bAllInModel = true;
+	for (uint32_t Key : Set)
+	{
+		++Iterated;
+		bAllInModel = bAllInModel && Model.count(Key) == 1;
+	}
+	EU_CHECK(Iterated == Model.size() && bAllInModel);
+}
+
+int main()
+{
+	TestGroupWrapAround();
+	TestTombstoneReuse();
+	TestRehash();
+	TestMoveOnly();
+	TestRandomDifferential();
+	return EU_TEST_RESULT();
+}
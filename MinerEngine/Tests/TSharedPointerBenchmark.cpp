@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Memory/TSharedPointer.h"
+#include "EUBenchmark.h"
+
+/**
+ * Copiar y soltar TSharedPointer (atmico), TLocalSharedPointer (no atmico) y std::shared_ptr,
+ * en ns por operacin.
+ *
+ * - copiar y soltar: mover una copia nueva a una de 64 ranuras, que suelta la referencia anterior.
+ *   Es un incremento y un decremento sobre el mismo bloque. Se mueve una copia en lugar de asignar
+ *   por copia porque std::shared_ptr no toca el contador si ambos comparten bloque; las ranuras
+ *   evitan que el compilador empareje y elimine las dos operaciones de la versin no atmica.
+ * - copiar un array: copiar y destruir un array de 1M punteros, cada uno a su propio objeto
+ *   (bloques repartidos por la memoria, como los componentes de una escena).
+ * - crear y destruir: MakeShared<FComponent> frente a std::make_shared, ambos en una reserva. Con
+ *   EU_MEMORY_TRACKING=1 (como se compilan las pruebas) incluye el registro en MemoryTracker.
+ * - varios hilos: cada hilo copia y suelta el mismo puntero (la lnea de cach del contador va de
+ *   un ncleo a otro). Solo tiene sentido con varios ncleos; se indica cuntos hay.
+ *
+ * libstdc++ usa contadores no atmicos en std::shared_ptr mientras el proceso tiene un solo hilo;
+ * se lanza un hilo antes de medir para compararlo en las mismas condiciones que TSharedPointer.
+ */
+namespace {
+	struct FComponent
+	{
+		float Position[3] = {};
+		float Rotation[4] = {};
+		uint32_t Flags = 0;
+	};
+
+	constexpr size_t Ring = 64;
+
+	template<typename FPointer>
+	double CopyRelease(const FPointer& Source, size_t Count)
+	{
+		std::vector<FPointer> Slots(Ring);
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Slots[i % Ring] = FPointer(Source);
+			}
+			EUBench::Consume(reinterpret_cast<uintptr_t>(Slots[Count % Ring].get()));
+		});
+		return Ms * 1e6 / Count;
+	}
+
+	template<typename FPointer>
+	double CopyArray(const std::vector<FPointer>& Source)
+	{
+		const double Ms = EUBench::MeasureMs([&]() {
+			std::vector<FPointer> Copy(Source);
+			EUBench::Consume(reinterpret_cast<uintptr_t>(Copy[Copy.size() / 2].get()));
+		});
+		return Ms * 1e6 / Source.size();
+	}
+
+	template<typename FMake>
+	double CreateDestroy(size_t Count, FMake&& Make)
+	{
+		const double Ms = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (size_t i = 0; i < Count; ++i)
+			{
+				auto Pointer = Make();
+				Pointer->Flags = static_cast<uint32_t>(i);
+				Sum += Pointer->Flags;
+			}
+			EUBench::Consume(Sum);
+		});
+		return Ms * 1e6 / Count;
+	}
+
+	template<typename FPointer>
+	double Contended(const FPointer& Source, size_t CountPerThread, unsigned NumThreads)
+	{
+		const double Ms = EUBench::MeasureMs([&]() {
+			std::vector<std::thread> Workers;
+			for (unsigned t = 0; t < NumThreads; ++t)
+			{
+				Workers.emplace_back([&]() {
+					std::vector<FPointer> Slots(Ring);
+					for (size_t i = 0; i < CountPerThread; ++i) Slots[i % Ring] = FPointer(Source);
+				});
+			}
+			for (std::thread& Worker : Workers) Worker.join();
+		});
+		return Ms * 1e6 / (CountPerThread * NumThreads);
+	}
+
+	template<typename FPointer, typename FMake>
+	std::vector<FPointer> MakeArray(size_t Count, FMake&& Make)
+	{
+		std::vector<FPointer> Array;
+		Array.reserve(Count);
+		for (size_t i = 0; i < Count; ++i) Array.push_back(Make());
+		EUBench::FRandom Random(Count);
+		for (size_t i = Count; i > 1; --i) std::swap(Array[i - 1], Array[Random.Next() % i]);  ///< Orden sin relacin con la memoria.
+		return Array;
+	}
+}
+
+int main()
+{
+	std::thread([]() {}).join();
+
+	using FShared = EU::TSharedPointer<FComponent>;
+	using FLocal = EU::TLocalSharedPointer<FComponent>;
+	using FStd = std::shared_ptr<FComponent>;
+	auto MakeEU = []() { return EU::MakeShared<FComponent>(); };
+	auto MakeLocal = []() { return EU::MakeShared<FComponent, EU::RefCountMode::NotThreadSafe>(); };
+	auto MakeStd = []() { return std::make_shared<FComponent>(); };
+
+	constexpr size_t Copies = 20000000;
+	constexpr size_t Creations = 2000000;
+	constexpr size_t ArraySize = 1000000;
+
+	const FShared Shared = MakeEU();
+	const FLocal Local = MakeLocal();
+	const FStd Std = MakeStd();
+
+	const double CopyShared = CopyRelease(Shared, Copies);
+	const double CopyLocal = CopyRelease(Local, Copies);
+	const double CopyStd = CopyRelease(Std, Copies);
+
+	const double ArrayShared = CopyArray(MakeArray<FShared>(ArraySize, MakeEU));
+	const double ArrayLocal = CopyArray(MakeArray<FLocal>(ArraySize, MakeLocal));
+	const double ArrayStd = CopyArray(MakeArray<FStd>(ArraySize, MakeStd));
+
+	const double CreateShared = CreateDestroy(Creations, MakeEU);
+	const double CreateLocal = CreateDestroy(Creations, MakeLocal);
+	const double CreateStd = CreateDestroy(Creations, MakeStd);
+
+	const unsigned NumThreads = 4;
+	const double ContendedShared = Contended(Shared, Copies / NumThreads, NumThreads);
+	const double ContendedStd = Contended(Std, Copies / NumThreads, NumThreads);
+
+	std::printf("ns por operacin (%u ncleos)\n", std::thread::hardware_concurrency());
+	std::printf("%-30s %14s %14s %16s\n", "", "TSharedPointer", "TLocalShared", "std::shared_ptr");
+	std::printf("%-30s %14.2f %14.2f %16.2f\n", "copiar y soltar", CopyShared, CopyLocal, CopyStd);
+	std::printf("%-30s %14.2f %14.2f %16.2f\n", "copiar un array de 1M", ArrayShared, ArrayLocal, ArrayStd);
+	std::printf("%-30s %14.2f %14.2f %16.2f\n", "crear y destruir", CreateShared, CreateLocal, CreateStd);
+	std::printf("%-30s %14.2f %14s %16.2f\n", "copiar y soltar, 4 hilos", ContendedShared, "-", ContendedStd);
+	return 0;
+}
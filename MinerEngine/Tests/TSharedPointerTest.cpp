@@ -0,0 +1,214 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Memory/TSharedPointer.h"
+#include "EUTest.h"
+
+using EU::MakeShared;
+using EU::TLocalSharedPointer;
+using EU::TSharedPointer;
+
+namespace {
+	constexpr int Threads = 4;
+
+	std::atomic<int> GDestroyed(0);
+
+	/**
+	 * @brief Objeto compartido entre hilos. Cada hilo escribe (sin atmicos) en su propia ranura
+	 * antes de soltar su ltima referencia; el destructor, que corre en el hilo que suelta la
+	 * ltima, debe ver todas esas escrituras. Eso es lo que garantiza el decremento acq_rel.
+	 */
+	struct FShared
+	{
+		static constexpr uint32_t AliveMagic = 0xC0FFEEu;
+		std::atomic<uint32_t> Magic{ AliveMagic };
+		int Slots[Threads] = {};
+		static std::atomic<int> MissingWrites;
+
+		~FShared()
+		{
+			for (int Slot : Slots)
+			{
+				MissingWrites += Slot != 1;
+			}
+			Magic.store(0, std::memory_order_relaxed);
+			++GDestroyed;
+		}
+	};
+	std::atomic<int> FShared::MissingWrites(0);
+
+	/**
+	 * @brief Sin destructor virtual: destruirlo a travs de un puntero a FBase sera un error.
+	 */
+	struct FBase
+	{
+		int BaseValue = 1;
+		virtual void Touch() {}
+	};
+
+	struct FDerived final : FBase
+	{
+		static int Destroyed;
+		~FDerived() { ++Destroyed; }
+	};
+	int FDerived::Destroyed = 0;
+
+	/**
+	 * @brief Guarda la direccin de lo que recibe: MakeShared debe pasar las referencias tal cual.
+	 */
+	struct FBinds
+	{
+		const int* Seen;
+		std::unique_ptr<int> Owned;
+
+		FBinds(const int& Value, std::unique_ptr<int> InOwned) : Seen(&Value), Owned(std::move(InOwned)) {}
+	};
+
+	uint64_t Allocations()
+	{
+		return EU::MemoryTracker::Get().GetStats(EU::MemoryTag::ECS).NumAllocations;
+	}
+
+	uint64_t LiveBytes()
+	{
+		return EU::MemoryTracker::Get().GetStats(EU::MemoryTag::ECS).LiveBytes;
+	}
+}
+
+/**
+ * MakeShared hace una sola reserva (bloque y objeto juntos) y reenva los argumentos sin copias;
+ * el constructor desde puntero crudo reserva el bloque aparte.
+ */
+static void TestMakeShared()
+{
+	EU::FScopedMemoryTag Scope(EU::MemoryTag::ECS);
+	const uint64_t Baseline = LiveBytes();
+	const int Value = 42;
+	{
+		const uint64_t Before = Allocations();
+		TSharedPointer<FBinds> Shared = MakeShared<FBinds>(Value, std::unique_ptr<int>(new int(7)));
+		EU_CHECK(Allocations() - Before == 1);
+		EU_CHECK(LiveBytes() - Baseline >= sizeof(FBinds));
+		EU_CHECK(Shared->Seen == &Value && *Shared->Owned == 7);
+		EU_CHECK(Shared.useCount() == 1);
+	}
+	EU_CHECK(LiveBytes() == Baseline);
+	{
+		const uint64_t Before = Allocations();
+		TSharedPointer<int> Raw(new int(5));  ///< El int va por new global; el bloque, con la etiqueta.
+		EU_CHECK(Allocations() - Before == 1 && *Raw == 5);
+	}
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+/**
+ * Copias, asignaciones (tambin a s mismo), movimientos, conversin a la base y reset llevan
+ * bien la cuenta, y el objeto se destruye una vez con el ltimo puntero.
+ */
+static void TestCounting()
+{
+	FDerived::Destroyed = 0;
+	{
+		TSharedPointer<FDerived> Derived = MakeShared<FDerived>();
+		TSharedPointer<FDerived> Copy(Derived);
+		EU_CHECK(Derived.useCount() == 2);
+		Copy = Copy;
+		EU_CHECK(Derived.useCount() == 2 && Copy.get() == Derived.get());
+		TSharedPointer<FDerived> Moved(std::move(Copy));
+		EU_CHECK(Copy.isNull() && Derived.useCount() == 2);
+		TSharedPointer<FBase> Base = Moved;
+		EU_CHECK(Derived.useCount() == 3 && Base->BaseValue == 1);
+		Moved.reset();
+		Derived = TSharedPointer<FDerived>();
+		EU_CHECK(FDerived::Destroyed == 0 && Base.useCount() == 1);
+
+		// El ltimo puntero es a FBase (sin destructor virtual); se destruye como FDerived.
+		TSharedPointer<FDerived> Back = Base.dynamic_pointer_cast<FDerived>();
+		EU_CHECK(Back && Base.useCount() == 2);
+		Back.reset();
+	}
+	EU_CHECK(FDerived::Destroyed == 1);
+
+	// La variante no atmica cuenta igual.
+	{
+		TLocalSharedPointer<FDerived> Local = MakeShared<FDerived, EU::RefCountMode::NotThreadSafe>();
+		TLocalSharedPointer<FDerived> Copy = Local;
+		TLocalSharedPointer<FBase> Base = Copy;
+		EU_CHECK(Local.useCount() == 3);
+	}
+	EU_CHECK(FDerived::Destroyed == 2);
+}
+
+/**
+ * Varios hilos copian, asignan, mueven y sueltan sus propias copias del mismo puntero a la vez.
+ * Cada copia debe ver el objeto vivo; al terminar la cuenta vuelve exactamente a 1. En la segunda
+ * fase los hilos sueltan las ltimas referencias (el hilo principal ya solt la suya): el objeto
+ * se destruye una sola vez, en cualquiera de ellos, y ve las escrituras de todos.
+ */
+static void TestConcurrentCopyRelease()
+{
+	EU::FScopedMemoryTag Scope(EU::MemoryTag::ECS);
+	const uint64_t Baseline = LiveBytes();
+	constexpr int Rounds = 200;
+	constexpr int Iterations = 2000;
+	int BadCounts = 0;
+	int DeadObjects = 0;
+	for (int Round = 0; Round < Rounds; ++Round)
+	{
+		GDestroyed = 0;
+		TSharedPointer<FShared> Shared = MakeShared<FShared>();
+		std::atomic<int> Ready(0);
+		std::atomic<bool> Go(false);
+		std::atomic<int> Dead(0);
+		std::atomic<int> Finished(0);
+		std::atomic<bool> Release(false);
+
+		std::vector<std::thread> Workers;
+		for (int t = 0; t < Threads; ++t)
+		{
+			Workers.emplace_back([&, t, Mine = Shared]() mutable {
+				++Ready;
+				while (!Go.load()) std::this_thread::yield();
+				for (int i = 0; i < Iterations; ++i)
+				{
+					TSharedPointer<FShared> Copy(Mine);
+					TSharedPointer<FShared> Assigned;
+					Assigned = Copy;
+					TSharedPointer<FShared> Moved(std::move(Copy));
+					Mine = Assigned;
+					if (Moved->Magic.load(std::memory_order_relaxed) != FShared::AliveMagic) ++Dead;
+				}
+				++Finished;
+				while (!Release.load()) std::this_thread::yield();
+				Mine->Slots[t] = 1;
+				Mine.reset();
+			});
+		}
+		while (Ready.load() < Threads) std::this_thread::yield();
+		Go = true;
+		while (Finished.load() < Threads) std::this_thread::yield();
+
+		// Cada hilo tiene exactamente una referencia (Mine) ms la del hilo principal.
+		BadCounts += Shared.useCount() != Threads + 1;
+		Shared.reset();
+		Release = true;
+		for (std::thread& Worker : Workers) Worker.join();
+
+		DeadObjects += Dead.load();
+		EU_CHECK(GDestroyed == 1);
+	}
+	EU_CHECK(BadCounts == 0);
+	EU_CHECK(DeadObjects == 0);
+	EU_CHECK(FShared::MissingWrites == 0);
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+int main()
+{
+	TestMakeShared();
+	TestCounting();
+	TestConcurrentCopyRelease();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "EngineUtilities/Structures/TSlotMap.h"
+
+/**
+ * Churn de 1M inserciones y eliminaciones: se llena el mapa, se eliminan los elementos en orden
+ * aleatorio, se vuelve a llenar (reutilizando ranuras) y se recorre. Compara TSlotMap con
+ * std::unordered_map indexado por un contador, que es lo que sustituye.
+ */
+namespace {
+	constexpr size_t ElementCount = 1000000;
+
+	struct FPayload
+	{
+		float Position[3];
+		uint32_t Id;
+	};
+
+	using FClock = std::chrono::steady_clock;
+
+	double MillisecondsSince(FClock::time_point Start)
+	{
+		return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+	}
+
+	template<typename FInsert, typename FErase, typename FSum>
+	void RunChurn(const char* Name, const std::vector<uint32_t>& EraseOrder,
+		FInsert&& Insert, FErase&& Erase, FSum&& Sum)
+	{
+		FClock::time_point Start = FClock::now();
+		for (uint32_t i = 0; i < ElementCount; ++i) Insert(i);
+		const double InsertMs = MillisecondsSince(Start);
+
+		Start = FClock::now();
+		for (uint32_t i : EraseOrder) Erase(i);
+		const double EraseMs = MillisecondsSince(Start);
+
+		Start = FClock::now();
+		for (uint32_t i = 0; i < ElementCount; ++i) Insert(i);
+		const double ReinsertMs = MillisecondsSince(Start);
+
+		Start = FClock::now();
+		const uint64_t Total = Sum();
+		const double IterateMs = MillisecondsSince(Start);
+
+		std::printf("%-20s insert %8.2f ms  erase %8.2f ms  reinsert %8.2f ms  iterate %6.2f ms  (%llu)\n",
+			Name, InsertMs, EraseMs, ReinsertMs, IterateMs, static_cast<unsigned long long>(Total));
+	}
+}
+
+int main()
+{
+	std::vector<uint32_t> EraseOrder(ElementCount);
+	for (uint32_t i = 0; i < ElementCount; ++i) EraseOrder[i] = i;
+	std::shuffle(EraseOrder.begin(), EraseOrder.end(), std::mt19937(1234));
+
+	{
+		EU::TSlotMap<FPayload> Map;
+		std::vector<EU::TSlotMap<FPayload>::Handle> Handles(ElementCount);
+		RunChurn("TSlotMap", EraseOrder,
+			[&](uint32_t i) { Handles[i] = Map.Insert(FPayload{ { 0.0f, 0.0f, 0.0f }, i }); },
+			[&](uint32_t i) { Map.Remove(Handles[i]); },
+			[&]() {
+				uint64_t Total = 0;
+				for (const FPayload& Payload : Map) Total += Payload.Id;
+				return Total;
+			});
+	}
+
+	{
+		std::unordered_map<uint64_t, FPayload> Map;
+		std::vector<uint64_t> Keys(ElementCount);
+		uint64_t NextKey = 0;
+		RunChurn("std::unordered_map", EraseOrder,
+			[&](uint32_t i) { Keys[i] = NextKey++; Map.emplace(Keys[i], FPayload{ { 0.0f, 0.0f, 0.0f }, i }); },
+			[&](uint32_t i) { Map.erase(Keys[i]); },
+			[&]() {
+				uint64_t Total = 0;
+				for (const auto& Entry : Map) Total += Entry.second.Id;
+				return Total;
+			});
+	}
+
+	return 0;
+}
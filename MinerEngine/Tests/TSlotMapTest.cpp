@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <string>
+#include "EngineUtilities/Structures/TSlotMap.h"
+#include "EUTest.h"
+
+using EU::TSlotMap;
+
+static void TestInsertFind()
+{
+	TSlotMap<std::string> Map;
+	auto A = Map.Insert("Actor");
+	auto B = Map.Insert("Camera");
+
+	EU_CHECK(!A.IsNull() && !B.IsNull());
+	EU_CHECK(A != B);
+	EU_CHECK(Map.Num() == 2);
+	EU_CHECK(Map.Find(A) && *Map.Find(A) == "Actor");
+	EU_CHECK(Map.Find(B) && *Map.Find(B) == "Camera");
+	EU_CHECK(Map.Find(TSlotMap<std::string>::Handle()) == nullptr);
+}
+
+static void TestEraseCompacts()
+{
+	TSlotMap<int> Map;
+	auto A = Map.Insert(1);
+	auto B = Map.Insert(2);
+	auto C = Map.Insert(3);
+
+	EU_CHECK(Map.Remove(A));
+	EU_CHECK(!Map.Remove(A));
+	EU_CHECK(Map.Num() == 2);
+	// El ltimo elemento ocupa el hueco y su handle sigue resolviendo
+	EU_CHECK(Map.Find(B) && *Map.Find(B) == 2);
+	EU_CHECK(Map.Find(C) && *Map.Find(C) == 3);
+
+	int Sum = 0;
+	for (int Value : Map) Sum += Value;
+	EU_CHECK(Sum == 5);
+
+	for (size_t i = 0; i < Map.Num(); ++i)
+	{
+		EU_CHECK(*Map.Find(Map.GetHandle(i)) == Map.GetData()[i]);
+	}
+}
+
+static void TestStaleHandle()
+{
+	TSlotMap<int> Map;
+	auto A = Map.Insert(10);
+	Map.Remove(A);
+
+	// La ranura se reutiliza con otra generacin: el handle viejo no debe resolver al nuevo elemento
+	auto B = Map.Insert(20);
+	EU_CHECK(B.Index == A.Index);
+	EU_CHECK(B.Generation != A.Generation);
+	EU_CHECK(!Map.Contains(A));
+	EU_CHECK(Map.Find(A) == nullptr);
+	EU_CHECK(Map.Find(B) && *Map.Find(B) == 20);
+
+	Map.Clear();
+	EU_CHECK(Map.Num() == 0);
+	EU_CHECK(!Map.Contains(B));
+}
+
+static void TestGenerationRetirement()
+{
+	// Recorre los 2^31 ciclos de ocupar/liberar de una ranura hasta agotar su generacin
+	TSlotMap<int> Map;
+	auto First = Map.Insert(0);
+	auto Last = First;
+	for (uint32_t Cycle = 1; Cycle < 0x80000000u; ++Cycle)
+	{
+		Map.Remove(Last);
+		Last = Map.Insert(0);
+	}
+	EU_CHECK(Last.Index == First.Index);
+	EU_CHECK(Last.Generation == 0xFFFFFFFFu);
+
+	// Liberar la ltima generacin retira la ranura: el siguiente elemento usa otra
+	Map.Remove(Last);
+	auto Next = Map.Insert(1);
+	EU_CHECK(Next.Index != First.Index);
+	EU_CHECK(!Map.Contains(First));
+	EU_CHECK(!Map.Contains(Last));
+	EU_CHECK(Map.Find(Next) && *Map.Find(Next) == 1);
+}
+
+int main(int argc, char** argv)
+{
+	// La prueba de retirada recorre 2^31 ciclos; CTest la lanza como prueba aparte
+	if (argc > 1 && std::string(argv[1]) == "generation")
+	{
+		TestGenerationRetirement();
+		return EU_TEST_RESULT();
+	}
+	TestInsertFind();
+	TestEraseCompacts();
+	TestStaleHandle();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "EngineUtilities/Structures/TSoAArray.h"
+#include "EngineUtilities/Matrix/Matrix4x4.h"
+#include "EngineUtilities/Vectors/Quaternion.h"
+#include "EngineUtilities/Vectors/Vector3.h"
+#include "EUBenchmark.h"
+
+/**
+ * Actualizar posiciones (Position += Velocity * Dt) de 1M transformaciones guardadas como array
+ * de estructuras (un std::vector de objetos como Transform: posicin, orientacin, escala,
+ * velocidad y matriz de mundo, 128 bytes con el relleno) frente a TSoAArray con un flujo por campo, en ms por
+ * pasada.
+ *
+ * - AoS: el bucle arrastra por la cach el objeto entero para leer 24 bytes y escribir 12.
+ * - SoA GetField: dos TSpan<Vector3> recorridos en lnea.
+ * - SoA zip: for (auto [Position, Orientation, ...] : Array), el recorrido cmodo.
+ * - SoA floats: los mismos dos flujos como float[3N], el bucle que un kernel SIMD recorrera.
+ *
+ * Dos tamaos: 16K elementos (2 MB en AoS, 384 KB en los dos flujos SoA que se tocan) y 1M
+ * (128 MB frente a 24 MB), donde manda el ancho de banda.
+ */
+namespace {
+	constexpr float Dt = 1.0f / 60.0f;
+
+	struct FTransformAoS
+	{
+		EU::Vector3 Position;
+		EU::Quaternion Orientation;
+		EU::Vector3 Scale;
+		EU::Vector3 Velocity;
+		EU::Matrix4x4 World;
+	};
+
+	using FTransformSoA = EU::TSoAArray<EU::Vector3, EU::Quaternion, EU::Vector3, EU::Vector3, EU::Matrix4x4>;
+
+	constexpr int PositionField = 0;
+	constexpr int VelocityField = 3;
+
+	template<typename F>
+	double MsPerPass(size_t Count, F&& Body)
+	{
+		const int Passes = Count < 100000 ? 500 : 10;
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Pass = 0; Pass < Passes; ++Pass) Body();
+		});
+		return Ms / Passes;
+	}
+
+	void Run(size_t Count)
+	{
+		std::vector<FTransformAoS> AoS(Count);
+		FTransformSoA SoA;
+		SoA.Reserve(Count);
+		EUBench::FRandom Random(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const EU::Vector3 Velocity(float(Random.Next() % 100), float(Random.Next() % 100), float(Random.Next() % 100));
+			AoS[i].Velocity = Velocity;
+			SoA.Emplace(EU::Vector3(), EU::Quaternion(), EU::Vector3(1.0f, 1.0f, 1.0f), Velocity, EU::Matrix4x4());
+		}
+
+		const double AoSMs = MsPerPass(Count, [&]() {
+			for (FTransformAoS& Transform : AoS)
+			{
+				Transform.Position += Transform.Velocity * Dt;
+			}
+			EUBench::Consume(static_cast<uint64_t>(AoS[Count / 2].Position.x));
+		});
+		const double SpanMs = MsPerPass(Count, [&]() {
+			EU::TSpan<EU::Vector3> Positions = SoA.GetField<PositionField>();
+			EU::TSpan<EU::Vector3> Velocities = SoA.GetField<VelocityField>();
+			for (size_t i = 0; i < Positions.Num(); ++i)
+			{
+				Positions[i] += Velocities[i] * Dt;
+			}
+			EUBench::Consume(static_cast<uint64_t>(Positions[Count / 2].x));
+		});
+		const double ZipMs = MsPerPass(Count, [&]() {
+			for (auto [Position, Orientation, Scale, Velocity, World] : SoA)
+			{
+				Position += Velocity * Dt;
+			}
+			EUBench::Consume(static_cast<uint64_t>(SoA.Get<PositionField>(Count / 2).x));
+		});
+		const double FloatMs = MsPerPass(Count, [&]() {
+			float* Positions = &SoA.GetField<PositionField>()[0].x;
+			const float* Velocities = &SoA.GetField<VelocityField>()[0].x;
+			for (size_t i = 0; i < Count * 3; ++i)
+			{
+				Positions[i] += Velocities[i] * Dt;
+			}
+			EUBench::Consume(static_cast<uint64_t>(Positions[Count]));
+		});
+
+		std::printf("\n%zu elementos (AoS: %zu bytes por elemento)\n", Count, sizeof(FTransformAoS));
+		std::printf("%-18s %10s %10s\n", "", "ms/pasada", "x AoS");
+		auto Row = [AoSMs](const char* Name, double Ms) { std::printf("%-18s %10.3f %10.2f\n", Name, Ms, AoSMs / Ms); };
+		Row("AoS", AoSMs);
+		Row("SoA GetField", SpanMs);
+		Row("SoA zip", ZipMs);
+		Row("SoA floats", FloatMs);
+	}
+}
+
+int main()
+{
+	Run(16 * 1024);
+	Run(1024 * 1024);
+	return 0;
+}
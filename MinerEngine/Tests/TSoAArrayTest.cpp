@@ -0,0 +1,185 @@
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include "EngineUtilities/Structures/TSoAArray.h"
+#include "EngineUtilities/Vectors/Vector3.h"
+#include "EUTest.h"
+
+using EU::TSoAArray;
+
+namespace {
+	/**
+	 * @brief Registra la direccin de cada objeto vivo y cuenta las copias, movimientos y
+	 * asignaciones que leen de un objeto ya destruido. As un uso tras destruccin falla en
+	 * cualquier compilacin, sin depender de lo que quede en la memoria liberada.
+	 */
+	struct FChecked
+	{
+		static std::unordered_set<const FChecked*> Live;
+		static int UseAfterDestroy;
+		int Value;
+
+		FChecked(int InValue) : Value(InValue) { Live.insert(this); }
+		FChecked(const FChecked& Other) : Value(Read(Other)) { Live.insert(this); }
+		FChecked(FChecked&& Other) noexcept : Value(Read(Other)) { Other.Value = -1; Live.insert(this); }
+		FChecked& operator=(const FChecked& Other) { Value = Read(Other); return *this; }
+		FChecked& operator=(FChecked&& Other) noexcept { Value = Read(Other); Other.Value = -1; return *this; }
+		~FChecked() { UseAfterDestroy += Live.erase(this) == 0; }
+
+		static int Read(const FChecked& Other)
+		{
+			UseAfterDestroy += Live.count(&Other) == 0;
+			return Other.Value;
+		}
+
+		static int Alive() { return static_cast<int>(Live.size()); }
+	};
+	std::unordered_set<const FChecked*> FChecked::Live;
+	int FChecked::UseAfterDestroy = 0;
+
+	/**
+	 * @brief Campo con alineacin mayor que la lnea de cach.
+	 */
+	struct alignas(128) FWide
+	{
+		float Values[4];
+	};
+
+	template<typename T>
+	bool IsAligned(const T* Pointer, size_t Alignment)
+	{
+		return reinterpret_cast<uintptr_t>(Pointer) % Alignment == 0;
+	}
+}
+
+/**
+ * Regresin de b2d6c86: Emplace con argumentos que son referencias a elementos del propio array,
+ * justo cuando est lleno. Antes se reubicaban los flujos primero y el nuevo elemento se copiaba
+ * de objetos ya movidos, destruidos y liberados; ahora se construye mientras los bloques viejos
+ * siguen intactos.
+ */
+static void TestEmplaceFromSelf()
+{
+	{
+		TSoAArray<FChecked, std::string> Array;
+		Array.Emplace(0, std::string(40, 'a'));
+		size_t Growths = 0;
+		for (int i = 1; i < 200; ++i)
+		{
+			const size_t Capacity = Array.GetCapacity();
+			const size_t Source = static_cast<size_t>(i) / 2;
+			Array.Emplace(Array.Get<0>(Source), Array.Get<1>(Source));
+			Growths += Array.GetCapacity() != Capacity;
+		}
+		EU_CHECK(Growths == 4);  // 16, 32, 64, 128 -> 256.
+		EU_CHECK(FChecked::UseAfterDestroy == 0);
+
+		// El elemento i es copia del i / 2, y as hasta el 0.
+		bool bOk = true;
+		for (size_t i = 0; i < Array.Num(); ++i)
+		{
+			bOk = bOk && Array.Get<0>(i).Value == 0 && Array.Get<1>(i) == std::string(40, 'a');
+		}
+		EU_CHECK(bOk);
+
+		// Lo mismo con Add(tuple) construida desde el propio array, en el lmite de capacidad.
+		while (Array.Num() < Array.GetCapacity())
+		{
+			Array.Emplace(static_cast<int>(Array.Num()), std::to_string(Array.Num()));
+		}
+		const size_t Last = Array.Num() - 1;
+		Array.Add(std::make_tuple(Array.Get<0>(Last), Array.Get<1>(Last)));
+		EU_CHECK(Array.Get<0>(Last + 1).Value == static_cast<int>(Last) && Array.Get<1>(Last + 1) == std::to_string(Last));
+		EU_CHECK(FChecked::UseAfterDestroy == 0 && FChecked::Alive() == static_cast<int>(Array.Num()));
+	}
+	EU_CHECK(FChecked::Alive() == 0);
+}
+
+/**
+ * Cada flujo empieza alineado a StreamAlignment (o a la alineacin del campo si es mayor), y
+ * GetField devuelve una vista contigua del tamao del array.
+ */
+static void TestStreams()
+{
+	TSoAArray<char, double, FWide> Array;
+	for (int i = 0; i < 100; ++i)
+	{
+		Array.Emplace(char('a' + i % 26), double(i), FWide{ { float(i), 0.0f, 0.0f, 0.0f } });
+	}
+	EU_CHECK(IsAligned(Array.GetField<0>().Data, TSoAArray<char>::StreamAlignment));
+	EU_CHECK(IsAligned(Array.GetField<1>().Data, TSoAArray<char>::StreamAlignment));
+	EU_CHECK(IsAligned(Array.GetField<2>().Data, 128));
+	EU_CHECK(Array.GetField<0>().Num() == 100 && Array.GetField<2>().Num() == 100);
+
+	// Escribir por el flujo se ve desde Get y operator[].
+	EU::TSpan<double> Doubles = Array.GetField<1>();
+	for (size_t i = 0; i < Doubles.Num(); ++i) Doubles[i] *= 2.0;
+	EU_CHECK(Array.Get<1>(99) == 198.0 && std::get<1>(Array[50]) == 100.0 && std::get<0>(Array[27]) == 'b');
+	EU_CHECK(Array.Get<2>(42).Values[0] == 42.0f);
+}
+
+/**
+ * El recorrido zip escribe por referencia, y sobre un array const da referencias const.
+ */
+static void TestZip()
+{
+	TSoAArray<EU::Vector3, EU::Vector3> Particles;
+	for (int i = 0; i < 40; ++i)
+	{
+		Particles.Emplace(EU::Vector3(float(i), 0.0f, 0.0f), EU::Vector3(1.0f, 2.0f, 0.0f));
+	}
+	for (auto [Position, Velocity] : Particles)
+	{
+		Position += Velocity;
+	}
+	size_t Visited = 0;
+	bool bOk = true;
+	const TSoAArray<EU::Vector3, EU::Vector3>& ConstParticles = Particles;
+	for (auto [Position, Velocity] : ConstParticles)
+	{
+		static_assert(std::is_const<std::remove_reference_t<decltype(Position)>>::value, "zip const");
+		bOk = bOk && Position.x == float(Visited) + 1.0f && Position.y == 2.0f && Velocity.x == 1.0f;
+		++Visited;
+	}
+	EU_CHECK(bOk && Visited == 40);
+}
+
+/**
+ * RemoveAtSwap, Clear, copia y movimiento no dejan objetos vivos de ms ni de menos.
+ */
+static void TestLifetime()
+{
+	{
+		TSoAArray<FChecked, std::string> Array;
+		for (int i = 0; i < 50; ++i) Array.Emplace(i, std::to_string(i));
+		EU_CHECK(FChecked::Alive() == 50);
+
+		Array.RemoveAtSwap(10);
+		EU_CHECK(Array.Num() == 49 && Array.Get<0>(10).Value == 49 && Array.Get<1>(10) == "49");
+		Array.RemoveAtSwap(48);
+		EU_CHECK(Array.Num() == 48 && FChecked::Alive() == 48);
+
+		TSoAArray<FChecked, std::string> Copy(Array);
+		EU_CHECK(FChecked::Alive() == 96 && Copy.Get<1>(10) == "49" && Copy.Get<0>(47).Value == 47);
+		TSoAArray<FChecked, std::string> Moved(std::move(Copy));
+		EU_CHECK(FChecked::Alive() == 96 && Copy.Num() == 0 && Moved.Num() == 48);
+		Moved = Array;
+		EU_CHECK(FChecked::Alive() == 96 && Moved.Get<1>(0) == "0");
+		Moved.Clear();
+		EU_CHECK(FChecked::Alive() == 48 && Moved.Num() == 0);
+		Moved.Emplace(7, "siete");
+		EU_CHECK(Moved.Get<0>(0).Value == 7 && FChecked::Alive() == 49);
+	}
+	EU_CHECK(FChecked::Alive() == 0 && FChecked::UseAfterDestroy == 0);
+}
+
+int main()
+{
+	TestEmplaceFromSelf();
+	TestStreams();
+	TestZip();
+	TestLifetime();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <utility>
+#include <vector>
+#include "EngineUtilities/Structures/TMap.h"
+#include "EngineUtilities/Structures/TSortedMap.h"
+#include "Legacy/LegacyTMap.h"
+#include "EUBenchmark.h"
+
+/**
+ * TSortedMap frente a la TMap anterior (bsqueda lineal, la que haba cuando se pidi el mapa
+ * ordenado) y std::map, con claves uint32 aleatorias a 64, 1K y 100K claves: tablas que se
+ * construyen una vez y se leen cada frame. La TMap actual (Robin Hood) se aade como referencia
+ * para las bsquedas puntuales, que no son lo que TSortedMap optimiza.
+ *
+ * - construir: Build desde pares desordenados, Add uno a uno en la TMap anterior, insert en std::map.
+ * - acierto / fallo: 1M bsquedas al azar (en la TMap anterior a 100K, una muestra de 10K; la
+ *   TMap anterior no puede buscar fallos, y tampoco tiene rangos ni orden).
+ * - rango: sumar los valores de un rango de claves que cubre el 1 % de la tabla.
+ * - recorrer: sumar todos los valores en orden de clave.
+ */
+namespace {
+	constexpr size_t Lookups = 1000000;
+
+	struct FTable
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> Pairs;  ///< Desordenados.
+		std::vector<uint32_t> Hits;                         ///< Claves presentes, en orden aleatorio.
+		std::vector<uint32_t> Misses;                       ///< Claves ausentes.
+		std::vector<std::pair<uint32_t, uint32_t>> Ranges;  ///< [Desde, Hasta) con ~1 % de las claves.
+	};
+
+	FTable MakeTable(size_t Count)
+	{
+		EUBench::FRandom Random(Count);
+		FTable Table;
+		std::vector<uint32_t> Keys;
+		while (Keys.size() < Count)
+		{
+			Keys.push_back(static_cast<uint32_t>(Random.Next()) | 1);  ///< Impares: presentes.
+			if (Keys.size() == Count)
+			{
+				std::sort(Keys.begin(), Keys.end());
+				Keys.erase(std::unique(Keys.begin(), Keys.end()), Keys.end());
+			}
+		}
+		for (uint32_t Key : Keys) Table.Pairs.emplace_back(Key, Key / 2);
+		for (size_t i = Count; i > 1; --i) std::swap(Table.Pairs[i - 1], Table.Pairs[Random.Next() % i]);
+
+		const size_t Span = Count / 100 > 0 ? Count / 100 : 1;
+		for (size_t i = 0; i < Lookups; ++i)
+		{
+			Table.Hits.push_back(Keys[Random.Next() % Count]);
+			Table.Misses.push_back(static_cast<uint32_t>(Random.Next()) & ~1u);  ///< Pares: nunca presentes.
+		}
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			const size_t First = Random.Next() % (Count - Span + 1);
+			Table.Ranges.emplace_back(Keys[First], First + Span < Count ? Keys[First + Span] : ~0u);
+		}
+		return Table;
+	}
+
+	struct FRow
+	{
+		double Build = -1.0;   ///< ms
+		double Hit = -1.0;     ///< ns por bsqueda
+		double Miss = -1.0;    ///< ns por bsqueda
+		double Range = -1.0;   ///< ns por consulta
+		double Iterate = -1.0; ///< ns por elemento
+	};
+
+	void Print(const char* Name, const FRow& Row)
+	{
+		std::printf("%-18s", Name);
+		for (double Value : { Row.Build, Row.Hit, Row.Miss, Row.Range, Row.Iterate })
+		{
+			if (Value < 0.0) std::printf(" %10s", "-");
+			else std::printf(" %10.2f", Value);
+		}
+		std::printf("\n");
+	}
+
+	FRow RunSorted(const FTable& Table)
+	{
+		const size_t Count = Table.Pairs.size();
+		FRow Row;
+		EU::TSortedMap<uint32_t, uint32_t> Map;
+		Row.Build = EUBench::MeasureMs([&]() { Map.Build(Table.Pairs.begin(), Table.Pairs.end()); });
+		Row.Hit = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (uint32_t Key : Table.Hits) Sum += *Map.Find(Key);
+			EUBench::Consume(Sum);
+		}) * 1e6 / Lookups;
+		Row.Miss = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint32_t Key : Table.Misses) Found += Map.Contains(Key);
+			EUBench::Consume(Found);
+		}) * 1e6 / Lookups;
+		Row.Range = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (const auto& Range : Table.Ranges)
+			{
+				const size_t Last = Map.LowerBound(Range.second);
+				for (size_t i = Map.LowerBound(Range.first); i < Last; ++i) Sum += Map.ValueAt(i);
+			}
+			EUBench::Consume(Sum);
+		}) * 1e6 / Table.Ranges.size();
+		Row.Iterate = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (auto Entry : Map) Sum += Entry.Value;
+			EUBench::Consume(Sum);
+		}) * 1e6 / Count;
+		return Row;
+	}
+
+	FRow RunStdMap(const FTable& Table)
+	{
+		const size_t Count = Table.Pairs.size();
+		FRow Row;
+		std::map<uint32_t, uint32_t> Map;
+		Row.Build = EUBench::MeasureMs([&]() {
+			std::map<uint32_t, uint32_t> Fresh;
+			for (const auto& Pair : Table.Pairs) Fresh.insert(Pair);
+			Map = std::move(Fresh);
+		});
+		Row.Hit = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (uint32_t Key : Table.Hits) Sum += Map.find(Key)->second;
+			EUBench::Consume(Sum);
+		}) * 1e6 / Lookups;
+		Row.Miss = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint32_t Key : Table.Misses) Found += Map.count(Key);
+			EUBench::Consume(Found);
+		}) * 1e6 / Lookups;
+		Row.Range = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (const auto& Range : Table.Ranges)
+			{
+				const auto Last = Map.lower_bound(Range.second);
+				for (auto It = Map.lower_bound(Range.first); It != Last; ++It) Sum += It->second;
+			}
+			EUBench::Consume(Sum);
+		}) * 1e6 / Table.Ranges.size();
+		Row.Iterate = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (const auto& Pair : Map) Sum += Pair.second;
+			EUBench::Consume(Sum);
+		}) * 1e6 / Count;
+		return Row;
+	}
+
+	/**
+	 * @brief La TMap anterior: Add y operator[] recorren todo el array. Solo tiene bsquedas
+	 * puntuales: sin fallos (su operator[] termina el proceso si la clave no existe), sin rangos
+	 * y sin recorrido. Construir se mide una sola vez: repetirlo sobre el mismo mapa solo
+	 * actualizara valores.
+	 */
+	FRow RunLegacy(const FTable& Table)
+	{
+		const size_t Count = Table.Pairs.size();
+		const size_t Sample = Count < 10000 ? Lookups : 10000;
+		FRow Row;
+		EULegacy::TMap<uint32_t, uint32_t> Map;
+		Row.Build = EUBench::MeasureMs([&]() {
+			for (const auto& Pair : Table.Pairs) Map.Add(Pair.first, Pair.second);
+		}, 1);
+		Row.Hit = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (size_t i = 0; i < Sample; ++i) Sum += Map[Table.Hits[i]];
+			EUBench::Consume(Sum);
+		}, Count < 10000 ? 3 : 1) * 1e6 / Sample;
+		return Row;
+	}
+
+	FRow RunHashMap(const FTable& Table)
+	{
+		FRow Row;
+		EU::TMap<uint32_t, uint32_t> Map;
+		Row.Build = EUBench::MeasureMs([&]() {
+			EU::TMap<uint32_t, uint32_t> Fresh;
+			for (const auto& Pair : Table.Pairs) Fresh.Add(Pair.first, Pair.second);
+			Map = std::move(Fresh);
+		});
+		Row.Hit = EUBench::MeasureMs([&]() {
+			uint64_t Sum = 0;
+			for (uint32_t Key : Table.Hits) Sum += *Map.Find(Key);
+			EUBench::Consume(Sum);
+		}) * 1e6 / Lookups;
+		Row.Miss = EUBench::MeasureMs([&]() {
+			uint64_t Found = 0;
+			for (uint32_t Key : Table.Misses) Found += Map.Contains(Key);
+			EUBench::Consume(Found);
+		}) * 1e6 / Lookups;
+		return Row;
+	}
+}
+
+int main()
+{
+	for (size_t Count : { size_t(64), size_t(1000), size_t(100000) })
+	{
+		const FTable Table = MakeTable(Count);
+		std::printf("%zu claves\n", Count);
+		std::printf("%-18s %10s %10s %10s %10s %10s\n", "", "construir", "acierto", "fallo", "rango 1%", "recorrer");
+		std::printf("%-18s %10s %10s %10s %10s %10s\n", "", "ms", "ns", "ns", "ns", "ns/elem");
+		Print("EU::TSortedMap", RunSorted(Table));
+		Print("std::map", RunStdMap(Table));
+		Print("TMap anterior", RunLegacy(Table));
+		Print("EU::TMap (hash)", RunHashMap(Table));
+		std::printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,193 @@
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "EngineUtilities/Structures/TSortedMap.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using EU::TSortedMap;
+
+namespace {
+	/**
+	 * @brief Compara el mapa con la referencia: tamao, orden de recorrido, GetKeys/GetValues y
+	 * KeyAt/ValueAt.
+	 */
+	template<typename K, typename V, typename Less>
+	bool SameContents(const TSortedMap<K, V, Less>& Map, const std::map<K, V, Less>& Reference)
+	{
+		if (Map.Num() != Reference.size() || Map.GetKeys().Num() != Reference.size() ||
+			Map.GetValues().Num() != Reference.size())
+		{
+			return false;
+		}
+		size_t Index = 0;
+		auto It = Reference.begin();
+		for (auto Entry : Map)
+		{
+			if (!(Entry.Key == It->first) || !(Entry.Value == It->second)) return false;
+			if (!(Map.KeyAt(Index) == It->first) || !(Map.GetValues()[Index] == It->second)) return false;
+			++Index;
+			++It;
+		}
+		return Index == Reference.size();
+	}
+
+	/**
+	 * @brief Find, Contains, LowerBound y UpperBound de Key coinciden con los de std::map.
+	 */
+	template<typename K, typename V, typename Less>
+	bool SameLookup(const TSortedMap<K, V, Less>& Map, const std::map<K, V, Less>& Reference, const K& Key)
+	{
+		const auto It = Reference.find(Key);
+		const V* Value = Map.Find(Key);
+		if ((It == Reference.end()) != (Value == nullptr) || Map.Contains(Key) != (Value != nullptr)) return false;
+		if (Value != nullptr && !(*Value == It->second)) return false;
+		const size_t Lower = static_cast<size_t>(std::distance(Reference.begin(), Reference.lower_bound(Key)));
+		const size_t Upper = static_cast<size_t>(std::distance(Reference.begin(), Reference.upper_bound(Key)));
+		return Map.LowerBound(Key) == Lower && Map.UpperBound(Key) == Upper;
+	}
+}
+
+/**
+ * Diferencial contra std::map con claves en un rango pequeo (muchas repeticiones): Add,
+ * FindOrAdd y Remove al azar, y cada 97 operaciones el contenido completo y las bsquedas de
+ * claves presentes, ausentes, y por debajo y por encima de todas.
+ */
+static void TestDifferential()
+{
+	EUBench::FRandom Random(5);
+	TSortedMap<int, int> Map;
+	std::map<int, int> Reference;
+	bool bContents = true;
+	bool bLookups = true;
+	for (int Step = 0; Step < 20000; ++Step)
+	{
+		const int Key = static_cast<int>(Random.Next() % 600) - 300;
+		const int Value = static_cast<int>(Random.Next() % 1000);
+		switch (Random.Next() % 4)
+		{
+		case 0:
+		case 1:
+			EU_CHECK(Map.Add(Key, Value) == Value);
+			Reference[Key] = Value;
+			break;
+		case 2:
+			Map.FindOrAdd(Key) += Value;
+			Reference[Key] += Value;
+			break;
+		default:
+			EU_CHECK(Map.Remove(Key) == (Reference.erase(Key) == 1));
+			break;
+		}
+		if (Step % 97 == 0)
+		{
+			bContents = bContents && SameContents(Map, Reference);
+			for (int Probe = -302; Probe <= 302; ++Probe)
+			{
+				bLookups = bLookups && SameLookup(Map, Reference, Probe);
+			}
+		}
+	}
+	EU_CHECK(bContents && SameContents(Map, Reference));
+	EU_CHECK(bLookups);
+
+	// Vaciar del todo y volver a empezar.
+	while (Map.Num() > 0) Map.Remove(Map.KeyAt(Map.Num() / 2));
+	EU_CHECK(Map.LowerBound(0) == 0 && Map.UpperBound(0) == 0 && Map.Find(0) == nullptr);
+	Map.Add(1, 1);
+	EU_CHECK(Map.Num() == 1 && Map.LowerBound(1) == 0 && Map.UpperBound(1) == 1 && Map.LowerBound(2) == 1);
+}
+
+/**
+ * Build desde pares desordenados con claves repetidas: gana el ltimo valor de cada clave,
+ * igual que insertar en orden en std::map con operator[]. Todos los tamaos de 0 a 70 cubren
+ * cada longitud de la bsqueda binaria sin saltos.
+ */
+static void TestBuild()
+{
+	EUBench::FRandom Random(9);
+	for (size_t Count = 0; Count <= 70; ++Count)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> Raw;
+		std::map<uint32_t, uint32_t> Reference;
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const uint32_t Key = static_cast<uint32_t>(Random.Next() % (Count + 1)) * 10;
+			const uint32_t Value = static_cast<uint32_t>(i);
+			Raw.emplace_back(Key, Value);
+			Reference[Key] = Value;
+		}
+		TSortedMap<uint32_t, uint32_t> Map;
+		Map.Add(5, 5);  ///< Build sustituye el contenido anterior.
+		Map.Build(Raw.begin(), Raw.end());
+		EU_CHECK(SameContents(Map, Reference));
+		bool bOk = true;
+		for (uint32_t Probe = 0; Probe <= Count * 10 + 11; ++Probe)
+		{
+			bOk = bOk && SameLookup(Map, Reference, Probe);
+		}
+		EU_CHECK(bOk);
+	}
+}
+
+/**
+ * Comparador propio (orden descendente) y claves std::string: el orden y los rangos siguen al
+ * comparador, no a operator<.
+ */
+static void TestComparator()
+{
+	std::vector<std::pair<std::string, int>> Raw = {
+		{ "sampler.linear", 1 }, { "shader.pbr", 2 }, { "material.roughness", 3 }, { "shader.shadow", 4 },
+		{ "material.albedo", 5 }, { "sampler.point", 6 }, { "shader.pbr", 7 } };
+	TSortedMap<std::string, int, std::greater<std::string>> Map;
+	std::map<std::string, int, std::greater<std::string>> Reference;
+	Map.Build(Raw.begin(), Raw.end());
+	for (const auto& Pair : Raw) Reference[Pair.first] = Pair.second;
+	EU_CHECK(SameContents(Map, Reference));
+	EU_CHECK(Map.KeyAt(0) == "shader.shadow" && *Map.Find("shader.pbr") == 7);
+
+	bool bOk = true;
+	for (const char* Probe : { "", "material", "material.albedo", "sampler.z", "shader.pbr", "zzz" })
+	{
+		bOk = bOk && SameLookup(Map, Reference, std::string(Probe));
+	}
+	EU_CHECK(bOk);
+
+	// Todas las claves "shader.*": en orden descendente van de "shader/" (exclusive) a "shader.".
+	size_t Shaders = 0;
+	for (size_t i = Map.LowerBound("shader/"); i < Map.LowerBound("shader."); ++i) ++Shaders;
+	EU_CHECK(Shaders == 2);
+}
+
+/**
+ * Add con un valor que es referencia a otro valor del propio mapa, cuando los arrays tienen que
+ * crecer: TArray construye el nuevo elemento antes de reubicar, as que la copia es correcta.
+ */
+static void TestAddFromSelf()
+{
+	TSortedMap<int, std::string> Map;
+	Map.Add(0, std::string(40, 'x'));
+	for (int i = 1; i < 100; ++i)
+	{
+		Map.Add(-i, Map.ValueAt(Map.Num() - 1));  ///< Clave nueva al principio; el valor del ltimo.
+	}
+	bool bOk = Map.Num() == 100;
+	for (size_t i = 0; i < Map.Num(); ++i)
+	{
+		bOk = bOk && Map.ValueAt(i) == std::string(40, 'x');
+	}
+	EU_CHECK(bOk);
+}
+
+int main()
+{
+	TestDifferential();
+	TestBuild();
+	TestComparator();
+	TestAddFromSelf();
+	return EU_TEST_RESULT();
+}
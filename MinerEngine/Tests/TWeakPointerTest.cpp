@@ -0,0 +1,169 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Memory/TWeakPointer.h"
+#include "EUTest.h"
+
+using EU::MakeShared;
+using EU::TSharedPointer;
+using EU::TWeakPointer;
+
+namespace {
+	std::atomic<int> GDestroyed(0);
+
+	struct FTracked
+	{
+		static constexpr uint32_t AliveMagic = 0xC0FFEEu;
+		std::atomic<uint32_t> Magic{ AliveMagic };
+		int Value;
+
+		explicit FTracked(int InValue) : Value(InValue) {}
+		virtual ~FTracked()
+		{
+			Magic.store(0, std::memory_order_relaxed);
+			++GDestroyed;
+		}
+	};
+
+	struct FDerived : FTracked
+	{
+		explicit FDerived(int InValue) : FTracked(InValue) {}
+	};
+
+	uint64_t LiveBytes()
+	{
+		return EU::MemoryTracker::Get().GetStats(EU::MemoryTag::ECS).LiveBytes;
+	}
+}
+
+static void TestLockAndExpired()
+{
+	GDestroyed = 0;
+	TWeakPointer<FTracked> Empty;
+	EU_CHECK(Empty.expired());
+	EU_CHECK(!Empty.lock());
+
+	TSharedPointer<FTracked> Shared = MakeShared<FTracked>(7);
+	TWeakPointer<FTracked> Weak(Shared);
+	EU_CHECK(!Weak.expired());
+	{
+		TSharedPointer<FTracked> Locked = Weak.lock();
+		EU_CHECK(Locked && Locked->Value == 7);
+		EU_CHECK(Shared.useCount() == 2);
+	}
+	EU_CHECK(Shared.useCount() == 1);
+
+	// Copias, movimientos y asignaciones observan el mismo objeto.
+	TWeakPointer<FTracked> Copy(Weak);
+	TWeakPointer<FTracked> Moved(std::move(Copy));
+	TWeakPointer<FTracked> Assigned;
+	Assigned = Moved;
+	Assigned = Assigned;
+	EU_CHECK(Copy.expired());
+	EU_CHECK(Moved.lock().get() == Shared.get() && Assigned.lock().get() == Shared.get());
+
+	Shared.reset();
+	EU_CHECK(GDestroyed == 1);
+	EU_CHECK(Weak.expired() && Moved.expired() && Assigned.expired());
+	EU_CHECK(!Weak.lock() && !Assigned.lock());
+
+	// Desde un TSharedPointer a un tipo derivado.
+	TSharedPointer<FDerived> Derived = MakeShared<FDerived>(3);
+	TWeakPointer<FTracked> Base(Derived);
+	EU_CHECK(Base.lock() && Base.lock()->Value == 3);
+	Base.reset();
+	EU_CHECK(Base.expired() && !Derived.isNull());
+}
+
+/**
+ * El objeto se destruye con el ltimo TSharedPointer, pero el bloque (aqu el mismo bloque de
+ * MakeShared) sigue reservado hasta que se suelta el ltimo TWeakPointer.
+ */
+static void TestBlockOutlivesObject()
+{
+	EU::FScopedMemoryTag Scope(EU::MemoryTag::ECS);
+	GDestroyed = 0;
+	const uint64_t Baseline = LiveBytes();
+	TWeakPointer<FTracked> Weak;
+	{
+		TSharedPointer<FTracked> Shared = MakeShared<FTracked>(1);
+		Weak = Shared;
+		EU_CHECK(LiveBytes() > Baseline);
+	}
+	EU_CHECK(GDestroyed == 1);
+	EU_CHECK(Weak.expired());
+	EU_CHECK(LiveBytes() > Baseline);
+	TWeakPointer<FTracked> Second(Weak);
+	Weak.reset();
+	EU_CHECK(LiveBytes() > Baseline);
+	Second.reset();
+	EU_CHECK(LiveBytes() == Baseline);
+
+	// Sin punteros dbiles el bloque se libera junto con el objeto.
+	{
+		TSharedPointer<FTracked> Shared = MakeShared<FTracked>(2);
+	}
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+/**
+ * Varios hilos promueven y copian punteros dbiles mientras el hilo principal suelta la ltima
+ * referencia fuerte. Cada lock() que tiene xito debe ver un objeto vivo, el objeto se destruye
+ * exactamente una vez y, una vez expirado, ningn lock() vuelve a tener xito.
+ */
+static void TestLockRace()
+{
+	constexpr int Rounds = 2000;
+	constexpr int Threads = 4;
+	int DeadLocks = 0;
+	int LateLocks = 0;
+	for (int Round = 0; Round < Rounds; ++Round)
+	{
+		GDestroyed = 0;
+		TSharedPointer<FTracked> Shared = MakeShared<FTracked>(Round);
+		const TWeakPointer<FTracked> Weak(Shared);
+		std::atomic<int> Ready(0);
+		std::atomic<int> BadLocks(0);
+		std::atomic<int> AfterExpired(0);
+
+		std::vector<std::thread> Workers;
+		for (int t = 0; t < Threads; ++t)
+		{
+			Workers.emplace_back([&]() {
+				TWeakPointer<FTracked> Local(Weak);
+				++Ready;
+				for (int i = 0; i < 64; ++i)
+				{
+					const bool WasExpired = Local.expired();
+					TSharedPointer<FTracked> Locked = Local.lock();
+					if (Locked && Locked->Magic.load(std::memory_order_relaxed) != FTracked::AliveMagic) ++BadLocks;
+					if (Locked && WasExpired) ++AfterExpired;
+					TWeakPointer<FTracked> Copy(Local);
+					Local = Copy;
+				}
+			});
+		}
+		while (Ready.load() < Threads)
+		{
+			std::this_thread::yield();
+		}
+		Shared.reset();
+		for (std::thread& Worker : Workers) Worker.join();
+
+		DeadLocks += BadLocks.load();
+		LateLocks += AfterExpired.load();
+		EU_CHECK(GDestroyed == 1);
+		EU_CHECK(Weak.expired() && !Weak.lock());
+	}
+	EU_CHECK(DeadLocks == 0);
+	EU_CHECK(LateLocks == 0);
+}
+
+int main()
+{
+	TestLockAndExpired();
+	TestBlockOutlivesObject();
+	TestLockRace();
+	return EU_TEST_RESULT();
+}
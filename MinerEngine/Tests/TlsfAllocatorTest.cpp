@@ -0,0 +1,209 @@
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <vector>
+#include "EngineUtilities/Memory/TlsfAllocator.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using EU::TlsfAllocation;
+using EU::TlsfAllocator;
+
+namespace {
+	/**
+	 * @brief Modelo de referencia: las reservas vivas como intervalos [Offset, Offset + Size).
+	 *
+	 * Como TlsfAllocator fusiona siempre los libres contiguos, sus bloques libres son exactamente
+	 * los huecos entre intervalos, y las estadsticas se pueden recalcular a fuerza bruta.
+	 */
+	struct FIntervalModel
+	{
+		uint64_t TotalSize = 0;
+		std::map<uint64_t, uint64_t> Live;  ///< Offset -> tamao real de la reserva.
+
+		bool Overlaps(uint64_t Offset, uint64_t Size) const
+		{
+			auto Next = Live.lower_bound(Offset);
+			if (Next != Live.end() && Next->first < Offset + Size) return true;
+			if (Next != Live.begin())
+			{
+				auto Prev = std::prev(Next);
+				if (Prev->first + Prev->second > Offset) return true;
+			}
+			return false;
+		}
+
+		TlsfAllocator::FStats Expected() const
+		{
+			TlsfAllocator::FStats Stats;
+			Stats.TotalSize = TotalSize;
+			Stats.NumAllocations = static_cast<uint32_t>(Live.size());
+			uint64_t Cursor = 0;
+			auto AddGap = [&](uint64_t End) {
+				if (End > Cursor)
+				{
+					Stats.FreeSize += End - Cursor;
+					++Stats.NumFreeRegions;
+					Stats.LargestFreeRegion = End - Cursor > Stats.LargestFreeRegion ? End - Cursor : Stats.LargestFreeRegion;
+				}
+			};
+			for (const auto& Interval : Live)
+			{
+				AddGap(Interval.first);
+				Cursor = Interval.first + Interval.second;
+			}
+			AddGap(TotalSize);
+			return Stats;
+		}
+	};
+
+	bool SameStats(const TlsfAllocator::FStats& A, const TlsfAllocator::FStats& B)
+	{
+		return A.TotalSize == B.TotalSize && A.FreeSize == B.FreeSize
+			&& A.LargestFreeRegion == B.LargestFreeRegion && A.NumAllocations == B.NumAllocations
+			&& A.NumFreeRegions == B.NumFreeRegions;
+	}
+
+	/**
+	 * @brief Cota de FindFree: con un hueco de al menos este tamao la reserva no puede fallar.
+	 */
+	uint64_t GuaranteedFit(uint64_t Size, uint64_t Alignment)
+	{
+		uint64_t Needed = (Size == 0 ? 1 : Size) + Alignment - 1;
+		if (Needed >= 16)
+		{
+			uint32_t Log2 = 0;
+			while ((Needed >> (Log2 + 1)) != 0) ++Log2;
+			Needed += (uint64_t(1) << (Log2 - 4)) - 1;
+		}
+		return Needed;
+	}
+}
+
+/**
+ * Tres reservas contiguas liberadas en todos los rdenes: siempre queda un nico bloque libre.
+ */
+static void TestMergeOrders()
+{
+	const int Orders[6][3] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+	for (const auto& Order : Orders)
+	{
+		TlsfAllocator Allocator(300);
+		TlsfAllocation Blocks[3];
+		for (TlsfAllocation& Block : Blocks) Block = Allocator.Allocate(100);
+		EU_CHECK(Blocks[0].Offset == 0 && Blocks[1].Offset == 100 && Blocks[2].Offset == 200);
+		EU_CHECK(Allocator.GetStats().FreeSize == 0 && Allocator.GetStats().NumFreeRegions == 0);
+		for (int i : Order) Allocator.Free(Blocks[i]);
+
+		const TlsfAllocator::FStats Stats = Allocator.GetStats();
+		EU_CHECK(Stats.NumFreeRegions == 1 && Stats.FreeSize == 300 && Stats.LargestFreeRegion == 300);
+		EU_CHECK(Stats.NumAllocations == 0);
+	}
+}
+
+/**
+ * Liberar dos veces, o una reserva invlida, no toca el estado.
+ */
+static void TestDoubleFree()
+{
+	TlsfAllocator Allocator(1024);
+	const TlsfAllocation A = Allocator.Allocate(64);
+	const TlsfAllocation B = Allocator.Allocate(64);
+	Allocator.Free(A);
+	const TlsfAllocator::FStats Before = Allocator.GetStats();
+	Allocator.Free(A);
+	Allocator.Free(TlsfAllocation());
+	TlsfAllocation OutOfRange;
+	OutOfRange.NodeIndex = 1000;
+	Allocator.Free(OutOfRange);
+	EU_CHECK(SameStats(Allocator.GetStats(), Before));
+	EU_CHECK(Allocator.GetStats().NumAllocations == 1);
+
+	// B sigue viva y se libera una sola vez.
+	Allocator.Free(B);
+	Allocator.Free(B);
+	EU_CHECK(Allocator.GetStats().NumFreeRegions == 1 && Allocator.GetStats().FreeSize == 1024);
+}
+
+/**
+ * Reservas y liberaciones aleatorias (potencias de dos, strides de vrtice y tamaos grandes)
+ * comparadas paso a paso con FIntervalModel.
+ */
+static void TestRandomAgainstModel()
+{
+	constexpr uint64_t TotalSize = 1 << 20;
+	constexpr int Steps = 200000;
+	const uint64_t Strides[] = { 12, 20, 32, 36, 44 };
+
+	TlsfAllocator Allocator(TotalSize);
+	FIntervalModel Model;
+	Model.TotalSize = TotalSize;
+	std::vector<TlsfAllocation> Handles;
+	EUBench::FRandom Random(42);
+
+	int Misplaced = 0;
+	int Overlapping = 0;
+	int TooSmall = 0;
+	int BadFailures = 0;
+	int BadStats = 0;
+	int Failures = 0;
+	for (int Step = 0; Step < Steps; ++Step)
+	{
+		// Sesgo hacia reservar mientras hay poca ocupacin y hacia liberar cuando hay mucha.
+		const bool bAllocate = Handles.empty() || Random.Next() % 100 < (Handles.size() < 200 ? 60u : 40u);
+		if (bAllocate)
+		{
+			const uint64_t Kind = Random.Next() % 10;
+			uint64_t Size = Random.Next() % (Kind == 0 ? 65536 : 2048);
+			const bool bStrided = Kind < 3;
+			const uint64_t Alignment = bStrided ? Strides[Random.Next() % 5] : uint64_t(1) << (Random.Next() % 9);
+			const TlsfAllocation Allocation = bStrided ? Allocator.AllocateStrided(Size, Alignment)
+				: Allocator.Allocate(Size, Alignment);
+			if (!Allocation.IsValid())
+			{
+				++Failures;
+				if (Model.Expected().LargestFreeRegion >= GuaranteedFit(Size, Alignment)) ++BadFailures;
+			}
+			else
+			{
+				const uint64_t Real = Allocator.GetAllocationSize(Allocation);
+				if (Allocation.Offset % Alignment != 0 || Allocation.Offset + Real > TotalSize) ++Misplaced;
+				if (Real < (Size == 0 ? 1 : Size)) ++TooSmall;
+				if (Model.Overlaps(Allocation.Offset, Real)) ++Overlapping;
+				Model.Live[Allocation.Offset] = Real;
+				Handles.push_back(Allocation);
+			}
+		}
+		else
+		{
+			const size_t Index = Random.Next() % Handles.size();
+			const TlsfAllocation Allocation = Handles[Index];
+			Handles[Index] = Handles.back();
+			Handles.pop_back();
+			Model.Live.erase(Allocation.Offset);
+			Allocator.Free(Allocation);
+			if (Random.Next() % 16 == 0) Allocator.Free(Allocation);
+		}
+		if (!SameStats(Allocator.GetStats(), Model.Expected())) ++BadStats;
+	}
+	EU_CHECK(Misplaced == 0);
+	EU_CHECK(Overlapping == 0);
+	EU_CHECK(TooSmall == 0);
+	EU_CHECK(BadFailures == 0);
+	EU_CHECK(BadStats == 0);
+	// La semilla llega a llenar el rango: tambin se ejercitan las reservas que fallan.
+	EU_CHECK(Failures > 0);
+
+	for (const TlsfAllocation& Allocation : Handles) Allocator.Free(Allocation);
+	const TlsfAllocator::FStats Stats = Allocator.GetStats();
+	EU_CHECK(Stats.NumAllocations == 0 && Stats.NumFreeRegions == 1);
+	EU_CHECK(Stats.FreeSize == TotalSize && Stats.LargestFreeRegion == TotalSize);
+}
+
+int main()
+{
+	TestMergeOrders();
+	TestDoubleFree();
+	TestRandomAgainstModel();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "EngineUtilities/Utilities/TransformKernels.h"
+#include "EUBenchmark.h"
+
+/**
+ * Transformar puntos con TransformKernels frente a un bucle de Matrix4x4::transform, en ns por
+ * punto.
+ *
+ * Dos tamaos: 4K puntos (48 KB, en cach: mide el clculo) y 4M (48 MB: mide la memoria). Se
+ * comparan la ruta portable y la AVX2 en AoS (Vector3) y SoA, la versin con stride sobre vrtices
+ * de 20 bytes (SimpleVertex) y ParallelTransformPoints con todos los ncleos (con 4K puntos se
+ * queda en un hilo: solo mide lo que cuesta decidirlo).
+ */
+namespace {
+	constexpr size_t SmallCount = 4 * 1024;
+	constexpr size_t LargeCount = 4 * 1024 * 1024;
+
+	struct FSimpleVertex
+	{
+		EU::Vector3 Pos;
+		float Tex[2];
+	};
+
+	struct FData
+	{
+		std::vector<EU::Vector3> In, Out;
+		std::vector<float> InX, InY, InZ, OutX, OutY, OutZ;
+		std::vector<FSimpleVertex> Vertices;
+	};
+
+	FData MakeData(size_t Count)
+	{
+		FData Data;
+		Data.In.resize(Count);
+		Data.Out.resize(Count);
+		Data.InX.resize(Count);
+		Data.InY.resize(Count);
+		Data.InZ.resize(Count);
+		Data.OutX.resize(Count);
+		Data.OutY.resize(Count);
+		Data.OutZ.resize(Count);
+		Data.Vertices.resize(Count);
+		EUBench::FRandom Random(3);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const float x = static_cast<float>(Random.Next() % 2000) * 0.1f - 100.0f;
+			const float y = static_cast<float>(Random.Next() % 2000) * 0.1f - 100.0f;
+			const float z = static_cast<float>(Random.Next() % 2000) * 0.1f - 100.0f;
+			Data.In[i] = EU::Vector3(x, y, z);
+			Data.InX[i] = x;
+			Data.InY[i] = y;
+			Data.InZ[i] = z;
+			Data.Vertices[i] = FSimpleVertex{ EU::Vector3(x, y, z), { 0.0f, 0.0f } };
+		}
+		return Data;
+	}
+
+	/**
+	 * @brief ns por punto del mejor de varias pasadas; las pasadas pequeas se repiten para durar algo.
+	 */
+	template<typename F>
+	double NsPerPoint(size_t Count, F&& Body)
+	{
+		const int Passes = Count < 100000 ? 2000 : 5;
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Pass = 0; Pass < Passes; ++Pass) Body();
+		});
+		return Ms * 1.0e6 / (double(Count) * Passes);
+	}
+
+	void Run(size_t Count, const EU::Matrix4x4& Matrix)
+	{
+		FData Data = MakeData(Count);
+		const float* In = reinterpret_cast<const float*>(Data.In.data());
+		float* Out = reinterpret_cast<float*>(Data.Out.data());
+		auto Consume = [&]() { EUBench::Consume(static_cast<uint64_t>(Data.Out[Count / 2].x + Data.OutX[Count / 3])); };
+
+		const double Naive = NsPerPoint(Count, [&]() {
+			for (size_t i = 0; i < Count; ++i)
+			{
+				const EU::Vector3& P = Data.In[i];
+				const EU::Vector4 R = Matrix.transform(EU::Vector4(P.x, P.y, P.z, 1.0f));
+				Data.Out[i] = EU::Vector3(R.x, R.y, R.z);
+			}
+			Consume();
+		});
+		const double AoSPortable = NsPerPoint(Count, [&]() {
+			EU::TransformKernels::AoSPortable<true>(Matrix, In, Out, 0, Count);
+			Consume();
+		});
+		const double AoS = NsPerPoint(Count, [&]() {
+			EU::TransformPoints(Matrix, Data.In.data(), Data.Out.data(), Count);
+			Consume();
+		});
+		const double SoAPortable = NsPerPoint(Count, [&]() {
+			EU::TransformKernels::SoAPortable<true>(Matrix, Data.InX.data(), Data.InY.data(), Data.InZ.data(),
+			                                        Data.OutX.data(), Data.OutY.data(), Data.OutZ.data(), 0, Count);
+			Consume();
+		});
+		const double SoA = NsPerPoint(Count, [&]() {
+			EU::TransformPoints(Matrix, Data.InX.data(), Data.InY.data(), Data.InZ.data(),
+			                    Data.OutX.data(), Data.OutY.data(), Data.OutZ.data(), Count);
+			Consume();
+		});
+		const double Strided = NsPerPoint(Count, [&]() {
+			EU::TransformPointsStrided(Matrix, Data.Vertices.data(), sizeof(FSimpleVertex),
+			                           Data.Out.data(), sizeof(EU::Vector3), Count);
+			Consume();
+		});
+		const double Parallel = NsPerPoint(Count, [&]() {
+			EU::ParallelTransformPoints(Matrix, Data.In.data(), Data.Out.data(), Count);
+			Consume();
+		});
+
+		std::printf("\n%zu puntos (%zu KB de entrada)\n", Count, Count * sizeof(EU::Vector3) / 1024);
+		std::printf("%-34s %8s %8s\n", "", "ns/punto", "x naive");
+		auto Row = [Naive](const char* Name, double Ns) { std::printf("%-34s %8.3f %8.2f\n", Name, Ns, Naive / Ns); };
+		Row("Matrix4x4::transform", Naive);
+		Row("AoS portable", AoSPortable);
+		Row("AoS TransformPoints", AoS);
+		Row("SoA portable", SoAPortable);
+		Row("SoA TransformPoints", SoA);
+		Row("TransformPointsStrided (20 B)", Strided);
+		Row("ParallelTransformPoints (AoS)", Parallel);
+	}
+}
+
+int main()
+{
+	const EU::Matrix4x4 Matrix(0.8f, 0.1f, -0.5f, 0.0f,
+	                           -0.2f, 0.9f, 0.3f, 0.0f,
+	                           0.5f, -0.3f, 0.8f, 0.0f,
+	                           10.0f, -4.0f, 2.5f, 1.0f);
+#if EU_X86
+	const bool bAVX2 = EU::CpuSupportsAVX2FMA();
+#else
+	const bool bAVX2 = false;
+#endif
+	std::printf("TransformPoints usa la ruta %s; %u hilos para Parallel*\n", bAVX2 ? "AVX2 + FMA" : "portable",
+		std::thread::hardware_concurrency());
+	Run(SmallCount, Matrix);
+	Run(LargeCount, Matrix);
+	return 0;
+}
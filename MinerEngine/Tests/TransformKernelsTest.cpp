@@ -0,0 +1,343 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include "EngineUtilities/Utilities/TransformKernels.h"
+#include "EUBenchmark.h"
+#include "EUTest.h"
+
+using namespace EU;
+
+/**
+ * Los kernels de TransformKernels contra Matrix4x4::transform, que es la referencia.
+ *
+ * La ruta portable repite las operaciones de transform en el mismo orden y debe dar los mismos
+ * bits (salvo el signo de un cero en vectores: transform suma 0 * fila3 y -0 + 0 = +0). La ruta
+ * AVX2 usa FMA y otro orden de suma; se acota su diferencia con la portable en ULP de la suma de
+ * los valores absolutos de los trminos, que es lo que permite el anlisis de error: cada ruta se
+ * aleja del valor exacto como mucho 4u (portable) y 3u (FMA) por esa suma, as que entre ellas hay
+ * menos de 7u * Suma <= 7 ULP.
+ */
+namespace {
+	constexpr double MaxAVX2Ulps = 7.0;
+
+	struct FPoints
+	{
+		std::vector<Vector3> AoS;
+		std::vector<float> X, Y, Z;
+	};
+
+	float RandomFloat(EUBench::FRandom& Random, float Low, float High)
+	{
+		const float Unit = static_cast<float>(Random.Next() >> 40) / float(1 << 24);
+		return Low + (High - Low) * Unit;
+	}
+
+	Matrix4x4 RandomAffine(EUBench::FRandom& Random)
+	{
+		float m[4][3];
+		for (int Row = 0; Row < 3; ++Row)
+			for (int Column = 0; Column < 3; ++Column) m[Row][Column] = RandomFloat(Random, -2.0f, 2.0f);
+		for (int Column = 0; Column < 3; ++Column) m[3][Column] = RandomFloat(Random, -100.0f, 100.0f);
+		return Matrix4x4(m[0][0], m[0][1], m[0][2], 0.0f,
+		                 m[1][0], m[1][1], m[1][2], 0.0f,
+		                 m[2][0], m[2][1], m[2][2], 0.0f,
+		                 m[3][0], m[3][1], m[3][2], 1.0f);
+	}
+
+	FPoints RandomPoints(EUBench::FRandom& Random, size_t Count)
+	{
+		FPoints Points;
+		Points.AoS.resize(Count);
+		Points.X.resize(Count);
+		Points.Y.resize(Count);
+		Points.Z.resize(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			// Algunos ceros exactos para que aparezca el caso -0 / +0.
+			const bool bZero = Random.Next() % 16 == 0;
+			const float x = bZero ? -0.0f : RandomFloat(Random, -100.0f, 100.0f);
+			const float y = RandomFloat(Random, -100.0f, 100.0f);
+			const float z = bZero ? 0.0f : RandomFloat(Random, -100.0f, 100.0f);
+			Points.AoS[i] = Vector3(x, y, z);
+			Points.X[i] = x;
+			Points.Y[i] = y;
+			Points.Z[i] = z;
+		}
+		return Points;
+	}
+
+	bool SameBits(float A, float B)
+	{
+		uint32_t BitsA;
+		uint32_t BitsB;
+		std::memcpy(&BitsA, &A, sizeof(A));
+		std::memcpy(&BitsB, &B, sizeof(B));
+		return BitsA == BitsB;
+	}
+
+	/**
+	 * @brief Igualdad exacta; para vectores +0 y -0 cuentan como iguales (ver arriba).
+	 */
+	bool Matches(float Value, float Reference, bool bPoint)
+	{
+		return SameBits(Value, Reference) || (!bPoint && Value == 0.0f && Reference == 0.0f);
+	}
+
+	Vector3 Reference(const Matrix4x4& Matrix, const Vector3& Point, bool bPoint)
+	{
+		const Vector4 Result = Matrix.transform(Vector4(Point.x, Point.y, Point.z, bPoint ? 1.0f : 0.0f));
+		return Vector3(Result.x, Result.y, Result.z);
+	}
+
+	/**
+	 * @brief ULP de |x * m0| + |y * m1| + |z * m2| (+ |m3|), la escala del error de redondeo.
+	 */
+	double TermUlp(const Matrix4x4& Matrix, const Vector3& Point, int Column, bool bPoint)
+	{
+		double Sum = std::fabs(double(Point.x) * Matrix.m[0][Column]) +
+		             std::fabs(double(Point.y) * Matrix.m[1][Column]) +
+		             std::fabs(double(Point.z) * Matrix.m[2][Column]);
+		if (bPoint) Sum += std::fabs(double(Matrix.m[3][Column]));
+		const float Scale = static_cast<float>(Sum);
+		return double(std::nextafter(Scale, INFINITY)) - double(Scale);
+	}
+
+	/**
+	 * @brief Todos los elementos coinciden con transform (Exact) o quedan dentro de la cota de AVX2.
+	 */
+	bool CheckAgainstReference(const Matrix4x4& Matrix, const FPoints& Input, const float* X,
+	                           const float* Y, const float* Z, size_t Count, bool bPoint, bool bExact)
+	{
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const Vector3 Expected = Reference(Matrix, Input.AoS[i], bPoint);
+			const float Got[3] = { X[i], Y[i], Z[i] };
+			const float Want[3] = { Expected.x, Expected.y, Expected.z };
+			for (int Column = 0; Column < 3; ++Column)
+			{
+				if (bExact ? !Matches(Got[Column], Want[Column], bPoint)
+				           : std::fabs(double(Got[Column]) - Want[Column]) >
+				             MaxAVX2Ulps * TermUlp(Matrix, Input.AoS[i], Column, bPoint))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	bool CheckAoS(const Matrix4x4& Matrix, const FPoints& Input, const std::vector<Vector3>& Output,
+	              size_t Count, bool bPoint, bool bExact)
+	{
+		std::vector<float> X(Count), Y(Count), Z(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			X[i] = Output[i].x;
+			Y[i] = Output[i].y;
+			Z[i] = Output[i].z;
+		}
+		return CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, bPoint, bExact);
+	}
+
+	bool SameAoS(const std::vector<Vector3>& A, const std::vector<Vector3>& B)
+	{
+		return A.size() == B.size() && std::memcmp(A.data(), B.data(), A.size() * sizeof(Vector3)) == 0;
+	}
+
+	bool HasAVX2()
+	{
+#if EU_X86
+		return CpuSupportsAVX2FMA();
+#else
+		return false;
+#endif
+	}
+}
+
+/**
+ * La ruta portable (AoS, SoA y con stride) da los mismos bits que Matrix4x4::transform, con
+ * todos los tamaos de cola de 0 a 37 elementos.
+ */
+static void TestPortableMatchesTransform()
+{
+	EUBench::FRandom Random(11);
+	for (int Trial = 0; Trial < 20; ++Trial)
+	{
+		const Matrix4x4 Matrix = RandomAffine(Random);
+		const FPoints Input = RandomPoints(Random, 1000);
+		for (size_t Count = 0; Count <= 1000; Count = Count == 37 ? 1000 : Count + 1)
+		{
+			std::vector<Vector3> Points(Count), Vectors(Count);
+			TransformKernels::AoSPortable<true>(Matrix, reinterpret_cast<const float*>(Input.AoS.data()),
+			                                    reinterpret_cast<float*>(Points.data()), 0, Count);
+			TransformKernels::AoSPortable<false>(Matrix, reinterpret_cast<const float*>(Input.AoS.data()),
+			                                     reinterpret_cast<float*>(Vectors.data()), 0, Count);
+			EU_CHECK(CheckAoS(Matrix, Input, Points, Count, true, true));
+			EU_CHECK(CheckAoS(Matrix, Input, Vectors, Count, false, true));
+
+			std::vector<float> X(Count), Y(Count), Z(Count);
+			TransformKernels::SoAPortable<true>(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(),
+			                                    X.data(), Y.data(), Z.data(), 0, Count);
+			EU_CHECK(CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, true, true));
+			TransformKernels::SoAPortable<false>(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(),
+			                                     X.data(), Y.data(), Z.data(), 0, Count);
+			EU_CHECK(CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, false, true));
+
+			// Con stride: posiciones dentro de un vrtice de 20 bytes (SimpleVertex) y salida compacta.
+			std::vector<float> Vertices(Count * 5 + 1);
+			for (size_t i = 0; i < Count; ++i) std::memcpy(&Vertices[i * 5], &Input.AoS[i], sizeof(Vector3));
+			std::vector<Vector3> Strided(Count);
+			TransformPointsStrided(Matrix, Vertices.data(), 5 * sizeof(float), Strided.data(), sizeof(Vector3), Count);
+			EU_CHECK(CheckAoS(Matrix, Input, Strided, Count, true, true));
+		}
+	}
+}
+
+/**
+ * Las funciones pblicas (que eligen AVX2 si la CPU la tiene) coinciden bit a bit con la ruta
+ * portable si no hay AVX2, y quedan dentro de MaxAVX2Ulps si lo hay. Tambin se prueba el kernel
+ * AVX2 directamente, para que la cota se compruebe en toda mquina con AVX2.
+ */
+static void TestDispatchWithinBound()
+{
+	const bool bExact = !HasAVX2();
+	EUBench::FRandom Random(23);
+	for (int Trial = 0; Trial < 20; ++Trial)
+	{
+		const Matrix4x4 Matrix = RandomAffine(Random);
+		const FPoints Input = RandomPoints(Random, 4096);
+		for (size_t Count = 0; Count <= 4096; Count = Count == 37 ? 4096 : Count + 1)
+		{
+			std::vector<Vector3> Points(Count), Vectors(Count);
+			TransformPoints(Matrix, Input.AoS.data(), Points.data(), Count);
+			TransformVectors(Matrix, Input.AoS.data(), Vectors.data(), Count);
+			EU_CHECK(CheckAoS(Matrix, Input, Points, Count, true, bExact));
+			EU_CHECK(CheckAoS(Matrix, Input, Vectors, Count, false, bExact));
+
+			std::vector<float> X(Count), Y(Count), Z(Count);
+			TransformPoints(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(), X.data(), Y.data(), Z.data(), Count);
+			EU_CHECK(CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, true, bExact));
+			TransformVectors(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(), X.data(), Y.data(), Z.data(), Count);
+			EU_CHECK(CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, false, bExact));
+
+#if EU_X86
+			if (HasAVX2())
+			{
+				TransformKernels::AoSAVX2<true>(Matrix, reinterpret_cast<const float*>(Input.AoS.data()),
+				                                reinterpret_cast<float*>(Points.data()), 0, Count);
+				EU_CHECK(CheckAoS(Matrix, Input, Points, Count, true, false));
+				TransformKernels::SoAAVX2<false>(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(),
+				                                 X.data(), Y.data(), Z.data(), 0, Count);
+				EU_CHECK(CheckAgainstReference(Matrix, Input, X.data(), Y.data(), Z.data(), Count, false, false));
+			}
+#endif
+		}
+	}
+}
+
+/**
+ * Transformar en el sitio (Out == In) da lo mismo que a otro arreglo.
+ */
+static void TestInPlace()
+{
+	EUBench::FRandom Random(31);
+	const Matrix4x4 Matrix = RandomAffine(Random);
+	FPoints Input = RandomPoints(Random, 1003);
+
+	std::vector<Vector3> Expected(Input.AoS.size());
+	TransformPoints(Matrix, Input.AoS.data(), Expected.data(), Input.AoS.size());
+	std::vector<Vector3> InPlace = Input.AoS;
+	TransformPoints(Matrix, InPlace.data(), InPlace.data(), InPlace.size());
+	EU_CHECK(SameAoS(InPlace, Expected));
+
+	std::vector<float> X(Input.X.size()), Y(Input.Y.size()), Z(Input.Z.size());
+	TransformPoints(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(), X.data(), Y.data(), Z.data(), X.size());
+	TransformPoints(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(),
+	                Input.X.data(), Input.Y.data(), Input.Z.data(), X.size());
+	EU_CHECK(Input.X == X && Input.Y == Y && Input.Z == Z);
+
+	std::vector<float> Vertices(Input.AoS.size() * 5);
+	for (size_t i = 0; i < Input.AoS.size(); ++i) std::memcpy(&Vertices[i * 5], &Input.AoS[i], sizeof(Vector3));
+	TransformPointsStrided(Matrix, Vertices.data(), 5 * sizeof(float), Vertices.data(), 5 * sizeof(float), Input.AoS.size());
+	std::vector<Vector3> Portable(Input.AoS.size());
+	TransformKernels::AoSPortable<true>(Matrix, reinterpret_cast<const float*>(Input.AoS.data()),
+	                                    reinterpret_cast<float*>(Portable.data()), 0, Portable.size());
+	bool bSame = true;
+	for (size_t i = 0; i < Portable.size(); ++i) bSame = bSame && std::memcmp(&Vertices[i * 5], &Portable[i], sizeof(Vector3)) == 0;
+	EU_CHECK(bSame);
+}
+
+/**
+ * Las variantes Parallel* dan los mismos bits que la versin de un hilo con cualquier nmero de
+ * hilos: los bloques empiezan en mltiplos de 8 y cada elemento pasa por el mismo kernel.
+ */
+static void TestParallelMatchesSingleThread()
+{
+	EUBench::FRandom Random(47);
+	const Matrix4x4 Matrix = RandomAffine(Random);
+	const size_t Count = 3 * TransformKernels::MinElementsPerThread + 13;
+	const FPoints Input = RandomPoints(Random, Count);
+
+	std::vector<Vector3> Points(Count), Vectors(Count);
+	TransformPoints(Matrix, Input.AoS.data(), Points.data(), Count);
+	TransformVectors(Matrix, Input.AoS.data(), Vectors.data(), Count);
+	std::vector<float> X(Count), Y(Count), Z(Count);
+	TransformPoints(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(), X.data(), Y.data(), Z.data(), Count);
+	EU_CHECK(CheckAoS(Matrix, Input, Points, Count, true, !HasAVX2()));
+
+	for (uint32_t Threads = 0; Threads <= 5; ++Threads)
+	{
+		std::vector<Vector3> ParallelPoints(Count), ParallelVectors(Count);
+		ParallelTransformPoints(Matrix, Input.AoS.data(), ParallelPoints.data(), Count, Threads);
+		ParallelTransformVectors(Matrix, Input.AoS.data(), ParallelVectors.data(), Count, Threads);
+		EU_CHECK(SameAoS(ParallelPoints, Points));
+		EU_CHECK(SameAoS(ParallelVectors, Vectors));
+
+		std::vector<float> PX(Count), PY(Count), PZ(Count);
+		ParallelTransformPoints(Matrix, Input.X.data(), Input.Y.data(), Input.Z.data(),
+		                        PX.data(), PY.data(), PZ.data(), Count, Threads);
+		EU_CHECK(PX == X && PY == Y && PZ == Z);
+	}
+}
+
+/**
+ * Si el bloque del hilo que llama lanza, ParallelRanges espera a los dems hilos y deja salir la
+ * excepcin (antes se destruan std::thread an en marcha y el proceso acababa en std::terminate).
+ */
+static void TestParallelRangesJoinsBeforeRethrow()
+{
+	const size_t Count = 4 * TransformKernels::MinElementsPerThread;
+	std::atomic<uint32_t> Finished{ 0 };
+	bool bCaught = false;
+	try
+	{
+		TransformKernels::ParallelRanges(Count, 4, [&Finished](size_t Begin, size_t) {
+			if (Begin == 0)
+			{
+				throw std::runtime_error("bloque 0");
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			Finished.fetch_add(1);
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		bCaught = true;
+	}
+	EU_CHECK(bCaught);
+	EU_CHECK(Finished.load() == 3);
+}
+
+int main()
+{
+	TestPortableMatchesTransform();
+	TestDispatchWithinBound();
+	TestInPlace();
+	TestParallelMatchesSingleThread();
+	TestParallelRangesJoinsBeforeRethrow();
+	return EU_TEST_RESULT();
+}
@@ -0,0 +1,47 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "VectorMathCases.h"
+#include "EUBenchmark.h"
+
+/**
+ * Cada caso de VectorMathCases.h sobre 4096 elementos independientes, con el backend SIMD de la
+ * plataforma y con EU_MATH_SCALAR. Las entradas son las mismas en las dos versiones.
+ */
+namespace {
+	constexpr size_t ElementCount = 4096;
+	constexpr int Rounds = 64;
+
+	double MeasureNsPerOp(const EUTest::FMathCase& Case, const std::vector<float>& A,
+		const std::vector<float>& B, std::vector<float>& Out)
+	{
+		const double Ms = EUBench::MeasureMs([&]() {
+			for (int Round = 0; Round < Rounds; ++Round)
+			{
+				Case.Kernel(A.data(), B.data(), Out.data(), ElementCount);
+			}
+			EUBench::Consume(static_cast<uint64_t>(Out[0]));
+		});
+		return Ms * 1e6 / (double(ElementCount) * Rounds);
+	}
+}
+
+int main()
+{
+	const std::vector<EUTest::FMathCase> Simd = EU::VectorMathCases::GetCases();
+	const std::vector<EUTest::FMathCase> Scalar = EUTest::GetScalarMathCases();
+
+	std::printf("%-28s %10s %10s\n", "ns/op", EU_VECTOR_SSE ? "SSE2" : EU_VECTOR_NEON ? "NEON" : "escalar",
+		"escalar");
+	for (size_t c = 0; c < Simd.size() && c < Scalar.size(); ++c)
+	{
+		const EUTest::FMathCase& Case = Simd[c];
+		const std::vector<float> A = EUTest::MakeMathInput(Case.AInput, Case.ASize, ElementCount, 1 + c);
+		const std::vector<float> B = EUTest::MakeMathInput(Case.BInput, Case.BSize, ElementCount, 1001 + c);
+		std::vector<float> Out(Case.OutSize * ElementCount);
+		const double SimdNs = MeasureNsPerOp(Case, A, B, Out);
+		const double ScalarNs = MeasureNsPerOp(Scalar[c], A, B, Out);
+		std::printf("%-28s %10.2f %10.2f\n", Case.Name, SimdNs, ScalarNs);
+	}
+	return 0;
+}
@@ -0,0 +1,234 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "EngineUtilities/Matrix/Matrix4x4.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
+#include "EngineUtilities/Vectors/Quaternion.h"
+#include "EngineUtilities/Vectors/Vector3.h"
+#include "EngineUtilities/Vectors/Vector4.h"
+#include "EUBenchmark.h"
+
+/**
+ * @brief Casos de la biblioteca matemtica que se compilan dos veces: con el backend SIMD de la
+ * plataforma y con EU_MATH_SCALAR. Incluye las funciones de EngineMath y sus versiones por lotes.
+ *
+ * VectorMathScalar.cpp incluye esta cabecera con EU_MATH_SCALAR y con la macro EU renombrada a
+ * EUScalar, as que las dos versiones de cada funcin inline conviven en el mismo ejecutable sin
+ * violar la ODR. VectorMathTest compara sus salidas bit a bit y VectorMathBenchmark las cronometra.
+ */
+namespace EUTest {
+	/**
+	 * @brief Qu valores recibe cada operando.
+	 */
+	enum class EMathInput
+	{
+		None,        ///< El caso no usa el operando.
+		Any,         ///< Floats en [-2, 2].
+		UnitQuat,    ///< Cuaternios normalizados.
+		Affine,      ///< Matrices afines: columna 3 = (0, 0, 0, 1).
+		Angle,       ///< ngulos en [-100, 100] (varias vueltas para la reduccin de rango).
+		Positive,    ///< Floats en (0, 1e6].
+	};
+
+	/**
+	 * @brief Un caso: Kernel aplica la operacin a Count elementos de A y B.
+	 */
+	struct FMathCase
+	{
+		const char* Name;
+		void (*Kernel)(const float* A, const float* B, float* Out, size_t Count);
+		size_t ASize;       ///< Floats por elemento de A.
+		size_t BSize;       ///< Floats por elemento de B.
+		size_t OutSize;     ///< Floats por elemento de Out.
+		EMathInput AInput;
+		EMathInput BInput;
+	};
+
+	inline float RandomMathFloat(EUBench::FRandom& Random, float Low, float High)
+	{
+		const float Unit = static_cast<float>(Random.Next() >> 40) / 16777216.0f;
+		return Low + (High - Low) * Unit;
+	}
+
+	/**
+	 * @brief Rellena Count elementos de Size floats segn el tipo de operando.
+	 */
+	inline std::vector<float> MakeMathInput(EMathInput Input, size_t Size, size_t Count, uint64_t Seed)
+	{
+		std::vector<float> Data(Size * Count);
+		EUBench::FRandom Random(Seed);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			float* Element = Data.data() + i * Size;
+			for (size_t j = 0; j < Size; ++j)
+			{
+				Element[j] = Input == EMathInput::Angle ? RandomMathFloat(Random, -100.0f, 100.0f)
+					: Input == EMathInput::Positive ? RandomMathFloat(Random, 0.0f, 1e6f) + 1e-3f
+					: RandomMathFloat(Random, -2.0f, 2.0f);
+			}
+			if (Input == EMathInput::UnitQuat)
+			{
+				double LengthSq = 0.0;
+				for (size_t j = 0; j < 4; ++j) LengthSq += double(Element[j]) * Element[j];
+				const double Length = std::sqrt(LengthSq);
+				for (size_t j = 0; j < 4; ++j) Element[j] = static_cast<float>(Element[j] / Length);
+			}
+			else if (Input == EMathInput::Affine)
+			{
+				Element[3] = 0.0f;
+				Element[7] = 0.0f;
+				Element[11] = 0.0f;
+				Element[15] = 1.0f;
+			}
+		}
+		return Data;
+	}
+
+	/**
+	 * @brief Casos de la versin escalar (definida en VectorMathScalar.cpp).
+	 */
+	std::vector<FMathCase> GetScalarMathCases();
+}
+
+namespace EU {
+	namespace VectorMathCases {
+		using EUTest::EMathInput;
+		using EUTest::FMathCase;
+
+		template<typename T>
+		inline T LoadAs(const float* Source)
+		{
+			T Value;
+			std::memcpy(&Value, Source, sizeof(T));
+			return Value;
+		}
+
+		template<typename T>
+		inline void StoreAs(const T& Value, float* Dest)
+		{
+			std::memcpy(Dest, &Value, sizeof(T));
+		}
+
+		/**
+		 * @brief Factor de interpolacin del elemento Index: recorre [0, 1] en pasos de 1/16.
+		 */
+		inline float InterpolationFactor(size_t Index)
+		{
+			return static_cast<float>(Index % 17) / 16.0f;
+		}
+
+		inline std::vector<FMathCase> GetCases()
+		{
+			return {
+				{ "Vector4 + Vector4", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Vector4>(A + i * 4) + LoadAs<Vector4>(B + i * 4), Out + i * 4);
+				}, 4, 4, 4, EMathInput::Any, EMathInput::Any },
+				{ "Vector4 - Vector4", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Vector4>(A + i * 4) - LoadAs<Vector4>(B + i * 4), Out + i * 4);
+				}, 4, 4, 4, EMathInput::Any, EMathInput::Any },
+				{ "Vector4 * Vector4", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Vector4>(A + i * 4) * LoadAs<Vector4>(B + i * 4), Out + i * 4);
+				}, 4, 4, 4, EMathInput::Any, EMathInput::Any },
+				{ "Vector4 * float", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Vector4>(A + i * 4) * B[i], Out + i * 4);
+				}, 4, 1, 4, EMathInput::Any, EMathInput::Any },
+				{ "Vector4::dot", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						Out[i] = LoadAs<Vector4>(A + i * 4).dot(LoadAs<Vector4>(B + i * 4));
+				}, 4, 4, 1, EMathInput::Any, EMathInput::Any },
+				{ "Vector4::normalize", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Vector4>(A + i * 4).normalize(), Out + i * 4);
+				}, 4, 0, 4, EMathInput::Any, EMathInput::None },
+				{ "Matrix4x4 + Matrix4x4", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Matrix4x4>(A + i * 16) + LoadAs<Matrix4x4>(B + i * 16), Out + i * 16);
+				}, 16, 16, 16, EMathInput::Any, EMathInput::Any },
+				{ "Matrix4x4 * Matrix4x4", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Matrix4x4>(A + i * 16) * LoadAs<Matrix4x4>(B + i * 16), Out + i * 16);
+				}, 16, 16, 16, EMathInput::Any, EMathInput::Any },
+				{ "Matrix4x4::transform", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Matrix4x4>(A + i * 16).transform(LoadAs<Vector4>(B + i * 4)), Out + i * 4);
+				}, 16, 4, 4, EMathInput::Any, EMathInput::Any },
+				{ "Matrix4x4::transpose", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Matrix4x4>(A + i * 16).transpose(), Out + i * 16);
+				}, 16, 0, 16, EMathInput::Any, EMathInput::None },
+				{ "Matrix4x4::inverseAffine", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Matrix4x4>(A + i * 16).inverseAffine(), Out + i * 16);
+				}, 16, 0, 16, EMathInput::Affine, EMathInput::None },
+				{ "Quaternion * Quaternion", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Quaternion>(A + i * 4) * LoadAs<Quaternion>(B + i * 4), Out + i * 4);
+				}, 4, 4, 4, EMathInput::UnitQuat, EMathInput::UnitQuat },
+				{ "Quaternion::normalize", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Quaternion>(A + i * 4).normalize(), Out + i * 4);
+				}, 4, 0, 4, EMathInput::Any, EMathInput::None },
+				{ "Quaternion::inverse", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Quaternion>(A + i * 4).inverse(), Out + i * 4);
+				}, 4, 0, 4, EMathInput::Any, EMathInput::None },
+				{ "Quaternion::rotate", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+					{
+						const Vector3 Rotated = LoadAs<Quaternion>(A + i * 4).rotate(Vector3(B[i * 4], B[i * 4 + 1], B[i * 4 + 2]));
+						Out[i * 3] = Rotated.x;
+						Out[i * 3 + 1] = Rotated.y;
+						Out[i * 3 + 2] = Rotated.z;
+					}
+				}, 4, 4, 3, EMathInput::UnitQuat, EMathInput::Any },
+				{ "Quaternion::toMatrix", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(LoadAs<Quaternion>(A + i * 4).toMatrix(), Out + i * 16);
+				}, 4, 0, 16, EMathInput::UnitQuat, EMathInput::None },
+				{ "Quaternion::nlerp", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(Quaternion::nlerp(LoadAs<Quaternion>(A + i * 4), LoadAs<Quaternion>(B + i * 4),
+							InterpolationFactor(i)), Out + i * 4);
+				}, 4, 4, 4, EMathInput::UnitQuat, EMathInput::UnitQuat },
+				{ "Quaternion::slerp", [](const float* A, const float* B, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i)
+						StoreAs(Quaternion::slerp(LoadAs<Quaternion>(A + i * 4), LoadAs<Quaternion>(B + i * 4),
+							InterpolationFactor(i)), Out + i * 4);
+				}, 4, 4, 4, EMathInput::UnitQuat, EMathInput::UnitQuat },
+				{ "EU::sin", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::sin(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::sin8", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i + 8 <= Count; i += 8) sin8(A + i, Out + i);
+					for (size_t i = Count & ~size_t(7); i < Count; ++i) Out[i] = EU::sin(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::cos", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::cos(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::cos8", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i + 8 <= Count; i += 8) cos8(A + i, Out + i);
+					for (size_t i = Count & ~size_t(7); i < Count; ++i) Out[i] = EU::cos(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::tan", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::tan(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::exp", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::exp(A[i]);
+				}, 1, 0, 1, EMathInput::Angle, EMathInput::None },
+				{ "EU::log", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::log(A[i]);
+				}, 1, 0, 1, EMathInput::Positive, EMathInput::None },
+				{ "EU::sqrt", [](const float* A, const float*, float* Out, size_t Count) {
+					for (size_t i = 0; i < Count; ++i) Out[i] = EU::sqrt(A[i]);
+				}, 1, 0, 1, EMathInput::Positive, EMathInput::None },
+			};
+		}
+	}
+}
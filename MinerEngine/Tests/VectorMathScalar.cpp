@@ -0,0 +1,17 @@
+// Versin EU_MATH_SCALAR de VectorMathCases.h. EU se renombra a EUScalar para que las funciones
+// inline de esta unidad no se mezclen con las de la ruta SIMD al enlazar.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#define EU_MATH_SCALAR
+#define EU EUScalar
+#include "VectorMathCases.h"
+
+static_assert(!EU_VECTOR_SSE && !EU_VECTOR_NEON, "VectorMathScalar.cpp debe compilar la ruta escalar");
+
+std::vector<EUTest::FMathCase> EUTest::GetScalarMathCases()
+{
+	return EU::VectorMathCases::GetCases();
+}
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "VectorMathCases.h"
+#include "EUTest.h"
+
+namespace {
+	constexpr size_t ElementCount = 20000;
+
+	uint32_t Bits(float Value)
+	{
+		uint32_t Result;
+		std::memcpy(&Result, &Value, sizeof(Result));
+		return Result;
+	}
+}
+
+/**
+ * La ruta SIMD de la plataforma y la de EU_MATH_SCALAR deben dar exactamente los mismos bits
+ * en todas las operaciones de Vector4, Matrix4x4, Quaternion y EngineMath.
+ */
+static void TestSimdMatchesScalar()
+{
+	const std::vector<EUTest::FMathCase> Simd = EU::VectorMathCases::GetCases();
+	const std::vector<EUTest::FMathCase> Scalar = EUTest::GetScalarMathCases();
+	EU_CHECK(Simd.size() == Scalar.size());
+	if (Simd.size() != Scalar.size()) return;
+
+	std::printf("Backend: %s\n", EU_VECTOR_SSE ? "SSE2" : EU_VECTOR_NEON ? "NEON" : "escalar");
+	for (size_t c = 0; c < Simd.size(); ++c)
+	{
+		const EUTest::FMathCase& Case = Simd[c];
+		EU_CHECK(std::strcmp(Case.Name, Scalar[c].Name) == 0);
+		const std::vector<float> A = EUTest::MakeMathInput(Case.AInput, Case.ASize, ElementCount, 0x9E3779B97F4A7C15ull + c);
+		const std::vector<float> B = EUTest::MakeMathInput(Case.BInput, Case.BSize, ElementCount, 0xD1B54A32D192ED03ull + c);
+		std::vector<float> SimdOut(Case.OutSize * ElementCount);
+		std::vector<float> ScalarOut(Case.OutSize * ElementCount);
+		Case.Kernel(A.data(), B.data(), SimdOut.data(), ElementCount);
+		Scalar[c].Kernel(A.data(), B.data(), ScalarOut.data(), ElementCount);
+
+		size_t Mismatches = 0;
+		for (size_t i = 0; i < SimdOut.size(); ++i)
+		{
+			if (Bits(SimdOut[i]) != Bits(ScalarOut[i]))
+			{
+				if (Mismatches == 0)
+				{
+					std::printf("%s: primer resultado distinto en %zu: %.9g (SIMD) vs %.9g (escalar)\n",
+						Case.Name, i, SimdOut[i], ScalarOut[i]);
+				}
+				++Mismatches;
+			}
+		}
+		std::printf("%-28s %zu/%zu valores distintos\n", Case.Name, Mismatches, SimdOut.size());
+		EU_CHECK(Mismatches == 0);
+	}
+}
+
+/**
+ * sin8/cos8 (VectorSinCos) repiten las operaciones de sinCos: mismos bits que EU::sin y EU::cos
+ * dentro de un mismo backend.
+ */
+static void TestBatchedMatchesScalarFunctions()
+{
+	const std::vector<EUTest::FMathCase> Cases = EU::VectorMathCases::GetCases();
+	const auto Find = [&](const char* Name) -> const EUTest::FMathCase* {
+		for (const EUTest::FMathCase& Case : Cases)
+		{
+			if (std::strcmp(Case.Name, Name) == 0) return &Case;
+		}
+		return nullptr;
+	};
+	const char* Pairs[][2] = { { "EU::sin", "EU::sin8" }, { "EU::cos", "EU::cos8" } };
+	for (const auto& Pair : Pairs)
+	{
+		const EUTest::FMathCase* Scalar = Find(Pair[0]);
+		const EUTest::FMathCase* Batched = Find(Pair[1]);
+		EU_CHECK(Scalar != nullptr && Batched != nullptr);
+		if (Scalar == nullptr || Batched == nullptr) continue;
+
+		const std::vector<float> Angles = EUTest::MakeMathInput(EUTest::EMathInput::Angle, 1, ElementCount, 77);
+		std::vector<float> ScalarOut(ElementCount);
+		std::vector<float> BatchedOut(ElementCount);
+		Scalar->Kernel(Angles.data(), nullptr, ScalarOut.data(), ElementCount);
+		Batched->Kernel(Angles.data(), nullptr, BatchedOut.data(), ElementCount);
+		EU_CHECK(std::memcmp(ScalarOut.data(), BatchedOut.data(), ElementCount * sizeof(float)) == 0);
+	}
+}
+
+int main()
+{
+	TestSimdMatchesScalar();
+	TestBatchedMatchesScalarFunctions();
+	return EU_TEST_RESULT();
+}
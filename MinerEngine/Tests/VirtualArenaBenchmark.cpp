@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "EngineUtilities/Memory/VirtualArena.h"
+#include "EUBenchmark.h"
+
+/**
+ * Llenar un array de 100M vrtices (SimpleVertex: posicin y UV, 20 bytes) con TVirtualArray frente
+ * a std::vector sin reserve, que es como crecan los buffers de vrtices del cargador.
+ *
+ * Para std::vector se cuenta el nmero de reubicaciones, los bytes copiados y el pico de memoria
+ * (bloque viejo + nuevo durante la ltima copia); para TVirtualArray, lo confirmado al final. Un
+ * primer argumento opcional cambia el nmero de vrtices.
+ */
+namespace {
+	struct FSimpleVertex
+	{
+		float Position[3];
+		float Tex[2];
+	};
+
+	FSimpleVertex MakeVertex(size_t i)
+	{
+		const float f = static_cast<float>(i & 1023);
+		return FSimpleVertex{ { f, f + 1.0f, f + 2.0f }, { f * 0.5f, f * 0.25f } };
+	}
+
+	struct FGrowth
+	{
+		double Ms = 0.0;
+		uint64_t PeakBytes = 0;
+		uint64_t CopiedBytes = 0;
+		uint32_t Relocations = 0;
+	};
+
+	FGrowth FillVector(size_t Count, bool bReserve)
+	{
+		FGrowth Growth;
+		Growth.Ms = EUBench::MeasureMs([&]() {
+			std::vector<FSimpleVertex> Vertices;
+			if (bReserve) Vertices.reserve(Count);
+			Growth = FGrowth();
+			for (size_t i = 0; i < Count; ++i)
+			{
+				const size_t OldCapacity = Vertices.capacity();
+				Vertices.push_back(MakeVertex(i));
+				if (Vertices.capacity() != OldCapacity)
+				{
+					// El bloque viejo y el nuevo convivieron durante la copia.
+					const uint64_t Both = (OldCapacity + Vertices.capacity()) * sizeof(FSimpleVertex);
+					Growth.PeakBytes = Both > Growth.PeakBytes ? Both : Growth.PeakBytes;
+					Growth.CopiedBytes += i * sizeof(FSimpleVertex);
+					Growth.Relocations += OldCapacity > 0 ? 1 : 0;
+				}
+			}
+			const uint64_t Final = Vertices.capacity() * sizeof(FSimpleVertex);
+			Growth.PeakBytes = Final > Growth.PeakBytes ? Final : Growth.PeakBytes;
+			EUBench::Consume(static_cast<uint64_t>(Vertices[Count / 2].Position[0]));
+		}, 1);
+		return Growth;
+	}
+
+	FGrowth FillVirtual(size_t Count, bool bHugePages)
+	{
+		FGrowth Growth;
+		Growth.Ms = EUBench::MeasureMs([&]() {
+			EU::TVirtualArray<FSimpleVertex> Vertices(Count, EU::MemoryTag::Mesh, bHugePages);
+			for (size_t i = 0; i < Count; ++i) Vertices.Emplace(MakeVertex(i));
+			Growth.PeakBytes = EU::MemoryTracker::Get().GetStats(EU::MemoryTag::Mesh).LiveBytes;
+			EUBench::Consume(static_cast<uint64_t>(Vertices[Count / 2].Position[0]));
+		}, 1);
+		return Growth;
+	}
+
+	void Report(const char* Name, const FGrowth& Growth)
+	{
+		std::printf("%-28s %9.1f %10.1f %11.1f %6u\n", Name, Growth.Ms, Growth.PeakBytes / 1048576.0,
+			Growth.CopiedBytes / 1048576.0, Growth.Relocations);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const size_t Count = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : size_t(100000000);
+	std::printf("%zu vrtices de %zu bytes\n", Count, sizeof(FSimpleVertex));
+	std::printf("%-28s %9s %10s %11s %6s\n", "", "ms", "pico MB", "copiado MB", "reub.");
+	Report("std::vector", FillVector(Count, false));
+	Report("std::vector + reserve", FillVector(Count, true));
+	Report("TVirtualArray", FillVirtual(Count, false));
+	Report("TVirtualArray (huge pages)", FillVirtual(Count, true));
+	return 0;
+}
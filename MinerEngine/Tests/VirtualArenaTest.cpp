@@ -0,0 +1,210 @@
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "EngineUtilities/Memory/VirtualArena.h"
+#include "EUTest.h"
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+using namespace EU;
+
+namespace {
+	constexpr size_t Granularity = 64 * 1024;
+	constexpr MemoryTag ArenaTag = MemoryTag::Loader;
+
+	uint64_t LiveBytes()
+	{
+		return MemoryTracker::Get().GetStats(ArenaTag).LiveBytes;
+	}
+
+	/**
+	 * @brief Pginas de [Address, Address + Size) que tienen memoria fsica detrs.
+	 */
+	size_t ResidentPages(const uint8_t* Address, size_t Size)
+	{
+#if defined(_WIN32)
+		(void)Address;
+		(void)Size;
+		return 0;
+#else
+		const size_t PageSize = VirtualMemory::GetPageSize();
+		std::vector<unsigned char> Pages((Size + PageSize - 1) / PageSize);
+		if (mincore(const_cast<uint8_t*>(Address), Size, Pages.data()) != 0) return 0;
+		size_t Resident = 0;
+		for (unsigned char Page : Pages) Resident += Page & 1;
+		return Resident;
+#endif
+	}
+
+	struct FCounted
+	{
+		static int Alive;
+		uint64_t Value;
+
+		explicit FCounted(uint64_t InValue) : Value(InValue) { ++Alive; }
+		~FCounted() { --Alive; }
+	};
+	int FCounted::Alive = 0;
+}
+
+/**
+ * Lo confirmado crece de 64 KB en 64 KB y el MemoryTracker lo sigue paso a paso.
+ */
+static void TestCommitAccounting()
+{
+	const uint64_t Baseline = LiveBytes();
+	{
+		VirtualArena Arena(size_t(64) << 20, ArenaTag);
+		EU_CHECK(Arena.GetBase() != nullptr && Arena.GetReserved() == size_t(64) << 20);
+		EU_CHECK(Arena.GetCommitted() == 0 && LiveBytes() == Baseline);
+
+		EU_CHECK(Arena.Allocate(1) == Arena.GetBase());
+		EU_CHECK(Arena.GetCommitted() == Granularity);
+		EU_CHECK(LiveBytes() == Baseline + Granularity);
+
+		// Dentro de lo confirmado no se confirma nada ms.
+		Arena.Allocate(Granularity - 64);
+		EU_CHECK(Arena.GetCommitted() == Granularity);
+
+		uint8_t* Big = static_cast<uint8_t*>(Arena.Allocate(size_t(1) << 20, 256));
+		EU_CHECK(Big != nullptr && reinterpret_cast<uintptr_t>(Big) % 256 == 0);
+		const size_t Expected = (Arena.GetUsed() + Granularity - 1) / Granularity * Granularity;
+		EU_CHECK(Arena.GetCommitted() == Expected);
+		EU_CHECK(LiveBytes() == Baseline + Expected);
+		std::memset(Big, 0x5A, size_t(1) << 20);
+
+		// Ms all del rango reservado falla sin tocar nada.
+		EU_CHECK(Arena.Allocate(size_t(64) << 20) == nullptr);
+		EU_CHECK(!Arena.EnsureCommitted((size_t(64) << 20) + 1));
+		EU_CHECK(Arena.GetCommitted() == Expected && LiveBytes() == Baseline + Expected);
+
+		// Rewind y Reset mueven el cursor pero conservan las pginas.
+		Arena.Rewind(100);
+		EU_CHECK(Arena.GetUsed() == 100 && Arena.GetCommitted() == Expected);
+		Arena.Reset();
+		EU_CHECK(Arena.GetUsed() == 0 && LiveBytes() == Baseline + Expected);
+	}
+	// El destructor descuenta todo lo confirmado.
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+/**
+ * Shrink devuelve las pginas al sistema (dejan de estar residentes) y al volver a crecer se
+ * confirman de nuevo, a cero.
+ */
+static void TestShrinkDecommits()
+{
+	const uint64_t Baseline = LiveBytes();
+	VirtualArena Arena(size_t(64) << 20, ArenaTag);
+	const size_t Size = size_t(4) << 20;
+	uint8_t* Memory = static_cast<uint8_t*>(Arena.Allocate(Size));
+	std::memset(Memory, 0xCD, Size);
+	EU_CHECK(Arena.GetCommitted() == Size && LiveBytes() == Baseline + Size);
+#if !defined(_WIN32)
+	const size_t PageSize = VirtualMemory::GetPageSize();
+	EU_CHECK(ResidentPages(Memory, Size) == Size / PageSize);
+#endif
+
+	Arena.Shrink(100);
+	EU_CHECK(Arena.GetUsed() == 100 && Arena.GetCommitted() == Granularity);
+	EU_CHECK(LiveBytes() == Baseline + Granularity);
+#if !defined(_WIN32)
+	EU_CHECK(ResidentPages(Memory + Granularity, Size - Granularity) == 0);
+	EU_CHECK(ResidentPages(Memory, Granularity) == Granularity / PageSize);
+#endif
+	EU_CHECK(Memory[99] == 0xCD);
+
+	// Shrink con un tamao mayor que el usado solo recorta pginas, no mueve el cursor.
+	Arena.Shrink(size_t(1) << 30);
+	EU_CHECK(Arena.GetUsed() == 100 && Arena.GetCommitted() == Granularity);
+
+	uint8_t* Again = static_cast<uint8_t*>(Arena.Allocate(Size - 100, 1));
+	EU_CHECK(Again == Memory + 100);
+	EU_CHECK(Arena.GetCommitted() == Size && LiveBytes() == Baseline + Size);
+	bool bZero = true;
+	for (size_t i = Granularity; i < Size; i += 4096) bZero = bZero && Memory[i] == 0;
+	EU_CHECK(bZero);
+
+	Arena.Shrink(0);
+	EU_CHECK(Arena.GetCommitted() == 0 && LiveBytes() == Baseline);
+}
+
+/**
+ * Mover una arena traspasa sus pginas: solo la de destino las descuenta al destruirse.
+ */
+static void TestMoveAccounting()
+{
+	const uint64_t Baseline = LiveBytes();
+	{
+		VirtualArena Source(size_t(16) << 20, ArenaTag);
+		Source.Allocate(3 * Granularity);
+		VirtualArena Target(std::move(Source));
+		EU_CHECK(Source.GetBase() == nullptr && Source.GetCommitted() == 0);
+		EU_CHECK(Target.GetCommitted() == 3 * Granularity);
+		EU_CHECK(LiveBytes() == Baseline + 3 * Granularity);
+
+		VirtualArena Other(size_t(16) << 20, ArenaTag);
+		Other.Allocate(Granularity);
+		Other = std::move(Target);
+		EU_CHECK(Other.GetCommitted() == 3 * Granularity && Target.GetCommitted() == Granularity);
+		EU_CHECK(LiveBytes() == Baseline + 4 * Granularity);
+	}
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+/**
+ * Con pginas grandes se confirma de 2 MB en 2 MB.
+ */
+static void TestHugePageGranularity()
+{
+	const uint64_t Baseline = LiveBytes();
+	VirtualArena Arena(size_t(64) << 20, ArenaTag, true);
+	Arena.Allocate(1);
+	EU_CHECK(Arena.GetCommitted() == size_t(2) << 20);
+	EU_CHECK(LiveBytes() == Baseline + (size_t(2) << 20));
+	Arena.Shrink(0);
+	EU_CHECK(LiveBytes() == Baseline);
+}
+
+/**
+ * TVirtualArray: punteros estables al crecer, destructores al recortar y pginas devueltas.
+ */
+static void TestVirtualArray()
+{
+	const uint64_t Baseline = LiveBytes();
+	{
+		TVirtualArray<FCounted> Array(size_t(10) << 20, ArenaTag);
+		FCounted* First = &Array.Emplace(uint64_t(0));
+		for (uint64_t i = 1; i < 200000; ++i) Array.Emplace(i);
+		EU_CHECK(&Array[0] == First && Array.Num() == 200000 && FCounted::Alive == 200000);
+		EU_CHECK(Array[123456].Value == 123456);
+		const size_t Bytes = 200000 * sizeof(FCounted);
+		EU_CHECK(LiveBytes() == Baseline + (Bytes + Granularity - 1) / Granularity * Granularity);
+
+		Array.Shrink(1000);
+		EU_CHECK(Array.Num() == 1000 && FCounted::Alive == 1000);
+		EU_CHECK(LiveBytes() == Baseline + Granularity);
+
+		EU_CHECK(Array.Reserve(500000));
+		EU_CHECK(LiveBytes() >= Baseline + 500000 * sizeof(FCounted));
+		EU_CHECK(Array.Num() == 1000);
+
+		Array.Clear();
+		EU_CHECK(Array.Num() == 0 && FCounted::Alive == 0 && LiveBytes() == Baseline);
+		Array.Emplace(uint64_t(7));
+	}
+	EU_CHECK(FCounted::Alive == 0 && LiveBytes() == Baseline);
+}
+
+int main()
+{
+	TestCommitAccounting();
+	TestShrinkDecommits();
+	TestMoveAccounting();
+	TestHugePageGranularity();
+	TestVirtualArray();
+	return EU_TEST_RESULT();
+}